@@ -2,13 +2,54 @@
 #include "GUID.h"
 #include "Reflection.h"
 using AssetHandle = Rebel::Core::GUID;
+
+// Told about every asset pointer that starts or stops holding a handle, so
+// whoever owns the assets knows which ones are still in use. Core only sees
+// this interface; the engine's AssetManager implements it.
+class IAssetReferenceTracker
+{
+public:
+	virtual ~IAssetReferenceTracker() = default;
+	virtual void AddAssetReference(AssetHandle handle) = 0;
+	virtual void ReleaseAssetReference(AssetHandle handle) = 0;
+};
+
 class AssetPtrBase
 {
 public:
-	virtual ~AssetPtrBase() = default;
+	AssetPtrBase() = default;
+	AssetPtrBase(const AssetPtrBase& other) : Handle(other.Handle) { AddReference(); }
+	AssetPtrBase& operator=(const AssetPtrBase& other)
+	{
+		SetHandle(other.Handle);
+		return *this;
+	}
+	virtual ~AssetPtrBase() { ReleaseReference(); }
+
 	virtual const Rebel::Core::Reflection::TypeInfo* GetAssetType() const = 0;
 	AssetHandle GetHandle() const { return Handle; }
-	void SetHandle(AssetHandle h) { Handle = h; }
+	void SetHandle(AssetHandle h)
+	{
+		if (h == Handle)
+			return;
+		ReleaseReference();
+		Handle = h;
+		AddReference();
+	}
+
+	// Set once at startup and cleared at shutdown, not while pointers are
+	// being copied on other threads. References taken under an earlier
+	// tracker are never released into a later one.
+	static void SetReferenceTracker(IAssetReferenceTracker* tracker);
+	static IAssetReferenceTracker* GetReferenceTracker();
+
 protected:
 	AssetHandle Handle = 0;
-};
\ No newline at end of file
+
+private:
+	void AddReference();
+	void ReleaseReference();
+
+	// Tracker generation this pointer's reference went to; 0 = none held.
+	uint32 TrackedGeneration = 0;
+};
@@ -57,7 +57,7 @@ namespace Rebel::Core::Memory {
         // Move constructor
         TArray(TArray&& other) noexcept
             : allocator(other.allocator), data(other.data), count(other.count),
-              capacity(other.capacity), usingHeap(other.usingHeap)
+              capacity(other.capacity), usingHeap(other.usingHeap), borrowed(other.borrowed)
         {
             if constexpr (InlineCapacity > 0) {
                 if (!other.usingHeap) {
@@ -77,6 +77,7 @@ namespace Rebel::Core::Memory {
             other.count = 0;
             other.capacity = 0;
             other.usingHeap = false;
+            other.borrowed = false;
         }
 
         // Move assignment
@@ -90,6 +91,7 @@ namespace Rebel::Core::Memory {
                 allocator = other.allocator;
                 count = other.count;
                 usingHeap = other.usingHeap;
+                borrowed = other.borrowed;
 
                 if constexpr (InlineCapacity > 0) {
                     if (!other.usingHeap) {
@@ -119,13 +121,16 @@ namespace Rebel::Core::Memory {
                 other.count = 0;
                 other.capacity = 0;
                 other.usingHeap = false;
+                other.borrowed = false;
             }
             return *this;
         }
 
-        // Element access
+        // Element access. Mutable access never copies a view behind the
+        // caller's back: writers call DetachView() first (see AdoptView).
         T& operator[](MemSize idx) {
             assert(idx < count && "TArray index out of range");
+            assert(!borrowed && "TArray view is read-only; DetachView() before writing");
             return data[idx];
         }
         const T& operator[](MemSize idx) const {
@@ -133,8 +138,10 @@ namespace Rebel::Core::Memory {
             return data[idx];
         }
 
-        T& Front() { assert(count > 0); return data[0]; }       // First element
-        T& Back() const { assert(count > 0); return data[count-1]; } // Last element
+        T& Front() { assert(count > 0 && !borrowed); return data[0]; }       // First element
+        const T& Front() const { assert(count > 0); return data[0]; }
+        T& Back() { assert(count > 0 && !borrowed); return data[count-1]; }  // Last element
+        const T& Back() const { assert(count > 0); return data[count-1]; }
 
         // Modifiers push_back
         void Add(const T& value) {
@@ -183,6 +190,7 @@ namespace Rebel::Core::Memory {
 
             --count;*/
             assert(idx < count && "TArray RemoveAt out of range");
+            DetachView();
             data[idx].~T();
             for (MemSize i = idx; i < count-1; i++) {
                 new(&data[i]) T(std::move(data[i+1]));
@@ -194,6 +202,7 @@ namespace Rebel::Core::Memory {
         void EraseAtSwap(MemSize idx)
         {
             assert(idx < count && "TArray EraseAtSwap out of range");
+            DetachView();
             MemSize last = count - 1;
 
             if (idx != last)
@@ -217,6 +226,7 @@ namespace Rebel::Core::Memory {
         // Remove last element
         void PopBack() {
             assert(count > 0);
+            DetachView();
             data[--count].~T();
         }
 
@@ -258,8 +268,15 @@ namespace Rebel::Core::Memory {
             ++count;
         }
 
-        // Destroy all elements but keep capacity
+        // Destroy all elements but keep capacity (a borrowed view is dropped)
         void Clear() {
+            if (borrowed) {
+                data = nullptr;
+                count = 0;
+                capacity = 0;
+                borrowed = false;
+                return;
+            }
             for (MemSize i = 0; i < count; i++) {
                 data[i].~T();
             }
@@ -268,6 +285,7 @@ namespace Rebel::Core::Memory {
 
         void Fill(const T& value)
         {
+            DetachView();
             for (MemSize i = 0; i < count; i++)
                 data[i] = value;
         }
@@ -281,6 +299,7 @@ namespace Rebel::Core::Memory {
 
         // Resize array, constructing or destroying elements as needed
         void Resize(MemSize newSize) {
+            DetachView();
             if (newSize < count) {
                 for (MemSize i = newSize; i < count; i++) {
                     data[i].~T();
@@ -297,22 +316,66 @@ namespace Rebel::Core::Memory {
         // Info
         MemSize Num() const { return count; }
         MemSize Capacity() const { return capacity; }
+        // Element storage outside the array object; views count what they borrow
+        MemSize GetAllocatedSize() const { return (usingHeap || borrowed) ? capacity * sizeof(T) : 0; }
         Bool IsEmpty() const { return count == 0; }
 
-        T* Data() { return data; }
+        T* Data() { assert(!borrowed); return data; }
         const T* Data() const { return data; }
 
-        T* begin() { return data; }
-        T* end()   { return data + count; }
+        T* begin() { assert(!borrowed); return data; }
+        T* end()   { assert(!borrowed); return data + count; }
 
         const T* begin() const { return data; }
         const T* end()   const { return data + count; }
-    
+
+        // Point the array at 'num' elements it does not own (e.g. a memory-mapped
+        // file) instead of copying them. The view is read-only: const access
+        // reads it in place, and mutable element access asserts until the
+        // owner calls DetachView(). Copying is explicit so a shared asset read
+        // from several jobs is never detached by one of them; structural
+        // modifiers (Add, Resize, ...) still copy first since they are writes
+        // by definition. Whoever lends the memory must keep it alive while
+        // IsView().
+        void AdoptView(const T* viewData, MemSize num) {
+            static_assert(std::is_trivially_copyable_v<T> && InlineCapacity == 0,
+                "TArray views are limited to trivially copyable heap arrays");
+            Clear();
+            if (usingHeap && data) {
+                allocator.Free(data, sizeof(*data) * capacity);
+            }
+            usingHeap = false;
+            if (num == 0) {
+                data = nullptr;
+                count = 0;
+                capacity = 0;
+                return;
+            }
+            data = const_cast<T*>(viewData);
+            count = num;
+            capacity = num;
+            borrowed = true;
+        }
+
+        Bool IsView() const { return borrowed; }
+
+        // Copy a borrowed view into owned storage; no-op for owned arrays
+        void DetachView() {
+            if (!borrowed) return;
+            if (count == 0) {
+                data = nullptr;
+                capacity = 0;
+                borrowed = false;
+                return;
+            }
+            Reallocate(count);
+        }
+
 
     private:
         // Ensure enough capacity, growing as needed
         void EnsureCapacity(MemSize needed) {
-            if (needed > capacity) {
+            if (needed > capacity || borrowed) {
                 MemSize newCap = capacity == 0 ? 4 : capacity * 2;
                 newCap = std::max(newCap, needed);
                 Reallocate(newCap);
@@ -344,6 +407,7 @@ namespace Rebel::Core::Memory {
             data = newData;
             capacity = newCap;
             usingHeap = true;
+            borrowed = false;
         }
 
         /*IAllocator* allocator = nullptr;                 // Memory allocator
@@ -353,6 +417,7 @@ namespace Rebel::Core::Memory {
         MemSize count = 0;                              // Number of elements
         MemSize capacity = 0;                           // Allocated capacity
         Bool usingHeap = false;                          // Are we using heap memory?
+        Bool borrowed = false;                           // Is data a read-only view (see AdoptView)?
 
         // Inline buffer for small arrays
         alignas(T) char inlineBuffer[sizeof(T) * (InlineCapacity > 0 ? InlineCapacity : 1)];
@@ -1,7 +1,13 @@
 #pragma once
-#include <utility>
+#include <cstring>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <emmintrin.h> // SSE2
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include "TArray.h"
 #include "Core/CoreTypes.h"
 #include "Core/CoreMemory.h"
@@ -12,188 +18,355 @@ template<typename K, typename V>
 struct TPair {
     K Key;
     V Value;
-    uint8 TopHash = 0; // 0 = empty, 1 = tombstone, 2-255 = valid
 
     TPair() = default;
-    TPair(const K& k, const V& v, uint8 th) : Key(k), Value(v), TopHash(th) {}
-    TPair(K&& k, V&& v, uint8 th) : Key(std::move(k)), Value(std::move(v)), TopHash(th) {}
+    TPair(const K& k, const V& v) : Key(k), Value(v) {}
+    TPair(K&& k, V&& v) : Key(std::move(k)), Value(std::move(v)) {}
+    template<typename KArg, typename VArg>
+    TPair(KArg&& k, VArg&& v) : Key(std::forward<KArg>(k)), Value(std::forward<VArg>(v)) {}
 };
 
+// Open-addressing hash map in the "Swiss table" layout:
+//  - one control byte per slot, stored in its own array: kEmpty, kDeleted or the
+//    low 7 bits of the key hash (H2) for a full slot
+//  - slots are probed 16 at a time by comparing a whole control group with SSE2
+//  - groups are visited in triangular order (g, g+1, g+3, ...) which covers every
+//    group once because the group count is a power of two
+// Keys are hashed with std::hash and then remixed, since std::hash is the identity
+// for integers/enums (entt::entity, AssetHandle, GUID) and those keys are sequential.
 template<typename Key, typename Value>
 class TMap {
 public:
     using PairType = TPair<Key, Value>;
 
-    TMap() {
-        capacity = 16; // start with 16 for SIMD alignment
-        buckets.Resize(capacity);
-        count = 0;
+    static constexpr MemSize kGroupWidth = 16;
+    static constexpr Float kDefaultMaxLoadFactor = 0.875f;
+    static constexpr Float kMinMaxLoadFactor = 0.25f;
+
+    TMap() = default;
+    explicit TMap(Float maxLoadFactor) { SetMaxLoadFactor(maxLoadFactor); }
+
+    ~TMap() { ReleaseStorage(); }
+
+    TMap(const TMap& other) : maxLoadFactor(other.maxLoadFactor) { CopyFrom(other); }
+
+    TMap& operator=(const TMap& other) {
+        if (this != &other) {
+            ReleaseStorage();
+            maxLoadFactor = other.maxLoadFactor;
+            CopyFrom(other);
+        }
+        return *this;
     }
 
-    ~TMap() = default;
-    TMap(const TMap&) = default;
-    TMap& operator=(const TMap&) = default;
-    TMap(TMap&&) noexcept = default;
-    TMap& operator=(TMap&&) noexcept = default;
+    TMap(TMap&& other) noexcept { StealFrom(other); }
 
-    Bool Add(const Key& key, const Value& value) { if (NeedsGrow()) Grow(); return InsertInternal(key, value); }
-    Bool Add(Key&& key, Value&& value) { if (NeedsGrow()) Grow(); return InsertInternal(std::move(key), std::move(value)); }
+    TMap& operator=(TMap&& other) noexcept {
+        if (this != &other) {
+            ReleaseStorage();
+            StealFrom(other);
+        }
+        return *this;
+    }
+
+    Bool Add(const Key& key, const Value& value) { return Emplace(key, value); }
+    Bool Add(Key&& key, Value&& value) { return Emplace(std::move(key), std::move(value)); }
+
+    // Inserts when the key is not present yet; returns false (and leaves the map untouched) otherwise.
+    template<typename KArg, typename VArg>
+    Bool Emplace(KArg&& key, VArg&& value) {
+        const uint64 hash = HashKey(key);
+        if (FindSlot(key, hash) != kInvalidSlot) return false;
+        InsertNew(hash, std::forward<KArg>(key), std::forward<VArg>(value));
+        return true;
+    }
 
     Value& operator[](const Key& key) {
-        size_t idx;
-        if (FindIndex(key, idx)) return buckets[idx].Value;
-        Add(key, Value());
-        FindIndex(key, idx);
-        return buckets[idx].Value;
+        const uint64 hash = HashKey(key);
+        MemSize slot = FindSlot(key, hash);
+        if (slot == kInvalidSlot) slot = InsertNew(hash, key, Value());
+        return slots[slot].Value;
     }
 
     Value* Find(const Key& key) {
-        size_t idx;
-        if (!FindIndex(key, idx)) return nullptr;
-        return &buckets[idx].Value;
+        const MemSize slot = FindSlot(key, HashKey(key));
+        return slot != kInvalidSlot ? &slots[slot].Value : nullptr;
     }
 
     const Value* Find(const Key& key) const {
-        size_t idx;
-        if (!FindIndex(key, idx)) return nullptr;
-        return &buckets[idx].Value;
+        const MemSize slot = FindSlot(key, HashKey(key));
+        return slot != kInvalidSlot ? &slots[slot].Value : nullptr;
     }
 
-    Bool Contains(const Key& key) const
-    {
-        size_t idx;
-        return FindIndex(key, idx);   // or: return Find(key) != nullptr;
-    }
+    Bool Contains(const Key& key) const { return FindSlot(key, HashKey(key)) != kInvalidSlot; }
 
     Bool Remove(const Key& key) {
-        size_t idx;
-        if (!FindIndex(key, idx)) return false;
-        buckets[idx].TopHash = 1; // tombstone
+        const MemSize slot = FindSlot(key, HashKey(key));
+        if (slot == kInvalidSlot) return false;
+
+        slots[slot].~PairType();
         count--;
+
+        // A group that still holds an empty byte has never been full since the last
+        // rehash, so no probe sequence continued past it: the slot can go straight
+        // back to empty instead of becoming a tombstone.
+        const MemSize groupStart = slot & ~(kGroupWidth - 1);
+        if (MatchEmpty(groupStart) != 0) {
+            control[slot] = kEmpty;
+        } else {
+            control[slot] = kDeleted;
+            tombstones++;
+        }
         return true;
     }
-    void Clear()
-    {
-        buckets.Clear();
-        capacity = 16;
-        buckets.Resize(capacity);
+
+    // Destroys every element but keeps the allocation for reuse.
+    void Clear() {
+        DestroyElements();
+        if (capacity != 0) std::memset(control, kEmpty, capacity);
         count = 0;
+        tombstones = 0;
+    }
+
+    // Makes room for at least n elements without exceeding the max load factor.
+    void Reserve(MemSize n) {
+        const MemSize wanted = CapacityFor(n);
+        if (wanted > capacity) Rehash(wanted);
+    }
+
+    // Clamped to [0.25, 0.875]. Takes effect on the next insertion.
+    void SetMaxLoadFactor(Float factor) {
+        if (factor < kMinMaxLoadFactor) factor = kMinMaxLoadFactor;
+        if (factor > kDefaultMaxLoadFactor) factor = kDefaultMaxLoadFactor;
+        maxLoadFactor = factor;
     }
 
+    Float GetMaxLoadFactor() const { return maxLoadFactor; }
+    MemSize Capacity() const { return capacity; }
+    MemSize NumTombstones() const { return tombstones; }
+
     MemSize Num() const { return count; }
     Bool IsEmpty() const { return count == 0; }
 
     class iterator {
     public:
-        iterator(TArray<PairType>* b, size_t i) : buckets(b), idx(i) { Advance(); }
-        PairType& operator*() { return (*buckets)[idx]; }
-        PairType* operator->() { return &(*buckets)[idx]; }
+        iterator(TMap* m, size_t i) : map(m), idx(i) { Advance(); }
+        PairType& operator*() { return map->slots[idx]; }
+        PairType* operator->() { return &map->slots[idx]; }
         iterator& operator++() { ++idx; Advance(); return *this; }
+        bool operator==(const iterator& other) const { return idx == other.idx; }
         bool operator!=(const iterator& other) const { return idx != other.idx; }
     private:
-        void Advance() { while (idx < buckets->Num() && (*buckets)[idx].TopHash < 2) idx++; }
-        TArray<PairType>* buckets;
+        void Advance() { while (idx < map->capacity && !IsFull(map->control[idx])) idx++; }
+        TMap* map;
         size_t idx;
     };
 
     class const_iterator {
     public:
-        const_iterator(const TArray<PairType>* b, size_t i) : buckets(b), idx(i) { Advance(); }
-        const PairType& operator*() const { return (*buckets)[idx]; }
-        const PairType* operator->() const { return &(*buckets)[idx]; }
+        const_iterator(const TMap* m, size_t i) : map(m), idx(i) { Advance(); }
+        const PairType& operator*() const { return map->slots[idx]; }
+        const PairType* operator->() const { return &map->slots[idx]; }
         const_iterator& operator++() { ++idx; Advance(); return *this; }
+        bool operator==(const const_iterator& other) const { return idx == other.idx; }
         bool operator!=(const const_iterator& other) const { return idx != other.idx; }
 
     private:
-        void Advance() { while (idx < buckets->Num() && (*buckets)[idx].TopHash < 2) idx++; }
-        const TArray<PairType>* buckets;
+        void Advance() { while (idx < map->capacity && !IsFull(map->control[idx])) idx++; }
+        const TMap* map;
         size_t idx;
     };
 
-    iterator begin() { return iterator(&buckets, 0); }
-    iterator end() { return iterator(&buckets, buckets.Num()); }
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity); }
 
-    const_iterator begin() const { return const_iterator(&buckets, 0); }
-    const_iterator end() const { return const_iterator(&buckets, buckets.Num()); }
-    const_iterator cbegin() const { return const_iterator(&buckets, 0); }
-    const_iterator cend() const { return const_iterator(&buckets, buckets.Num()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity); }
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    const_iterator cend() const { return const_iterator(this, capacity); }
 
 private:
-    TArray<PairType> buckets;
-    MemSize capacity = 0;
+    static constexpr int8 kEmpty = -128;  // 0b10000000
+    static constexpr int8 kDeleted = -2;  // 0b11111110
+    static constexpr MemSize kInvalidSlot = static_cast<MemSize>(-1);
+    static constexpr MemSize kSlotAlignment = alignof(PairType) > kGroupWidth ? alignof(PairType) : kGroupWidth;
+
+    int8* control = nullptr;    // capacity bytes, full slots hold H2 (0..127)
+    PairType* slots = nullptr;  // capacity slots, constructed only where control is full
+    MemSize capacity = 0;       // 0 or a power of two >= kGroupWidth
     MemSize count = 0;
+    MemSize tombstones = 0;
+    Float maxLoadFactor = kDefaultMaxLoadFactor;
 
-    size_t HashKey(const Key& key) const { return std::hash<Key>{}(key); }
-    uint8 TopHash(size_t hash) const { return static_cast<uint8>((hash >> (sizeof(size_t)*8 - 8)) | 0x80); }
-    Bool NeedsGrow() const { return count * 2 >= capacity; }
+    static Bool IsFull(int8 ctrl) { return ctrl >= 0; }
 
-    void Grow() {
-        size_t newCap = capacity * 2;
-        TArray<PairType> old = std::move(buckets);
-        buckets.Resize(newCap);
-        capacity = newCap;
-        count = 0;
-        for (size_t i = 0; i < old.Num(); i++) {
-            if (old[i].TopHash >= 2) InsertInternal(std::move(old[i].Key), std::move(old[i].Value));
+    // fmix64 finalizer from MurmurHash3: every input bit affects every output bit.
+    static uint64 Mix(uint64 h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static uint64 HashKey(const Key& key) { return Mix(static_cast<uint64>(std::hash<Key>{}(key))); }
+    static int8 H2(uint64 hash) { return static_cast<int8>(hash & 0x7F); }
+    static MemSize H1(uint64 hash) { return static_cast<MemSize>(hash >> 7); }
+
+    uint32 MatchByte(MemSize groupStart, int8 value) const {
+        const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control + groupStart));
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+    }
+
+    uint32 MatchEmpty(MemSize groupStart) const { return MatchByte(groupStart, kEmpty); }
+
+    // Empty or deleted: both have the top bit set.
+    uint32 MatchAvailable(MemSize groupStart) const {
+        const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control + groupStart));
+        return static_cast<uint32>(_mm_movemask_epi8(group));
+    }
+
+    static uint32 CountTrailingZeros(uint32 mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<uint32>(index);
+#else
+        return static_cast<uint32>(__builtin_ctz(mask));
+#endif
+    }
+
+    MemSize MaxFilled() const { return static_cast<MemSize>(static_cast<Float>(capacity) * maxLoadFactor); }
+
+    MemSize CapacityFor(MemSize n) const {
+        MemSize wanted = kGroupWidth;
+        while (static_cast<MemSize>(static_cast<Float>(wanted) * maxLoadFactor) < n) wanted *= 2;
+        return wanted;
+    }
+
+    MemSize FindSlot(const Key& key, uint64 hash) const {
+        if (count == 0) return kInvalidSlot;
+
+        const int8 h2 = H2(hash);
+        const MemSize groupMask = capacity / kGroupWidth - 1;
+        MemSize group = H1(hash) & groupMask;
+
+        for (MemSize probe = 1; ; ++probe) {
+            const MemSize groupStart = group * kGroupWidth;
+            for (uint32 match = MatchByte(groupStart, h2); match != 0; match &= match - 1) {
+                const MemSize slot = groupStart + CountTrailingZeros(match);
+                if (slots[slot].Key == key) return slot;
+            }
+            if (MatchEmpty(groupStart) != 0) return kInvalidSlot;
+            if (probe > groupMask) return kInvalidSlot; // visited every group
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    // First empty or deleted slot along the probe sequence. The table always keeps
+    // at least one available slot, so this terminates.
+    MemSize FindInsertSlot(uint64 hash) const {
+        const MemSize groupMask = capacity / kGroupWidth - 1;
+        MemSize group = H1(hash) & groupMask;
+
+        for (MemSize probe = 1; ; ++probe) {
+            const MemSize groupStart = group * kGroupWidth;
+            const uint32 available = MatchAvailable(groupStart);
+            if (available != 0) return groupStart + CountTrailingZeros(available);
+            group = (group + probe) & groupMask;
         }
     }
 
     template<typename KArg, typename VArg>
-    Bool InsertInternal(KArg&& key, VArg&& value) {
-        size_t hash = HashKey(key);
-        uint8 th = TopHash(hash);
-        size_t idx = hash & (capacity - 1);
-        size_t firstTombstone = SIZE_MAX;
-
-        while (true) {
-            auto& slot = buckets[idx];
-            if (slot.TopHash == 0) {
-                if (firstTombstone != SIZE_MAX) idx = firstTombstone;
-                buckets[idx] = PairType(std::forward<KArg>(key), std::forward<VArg>(value), th);
-                count++;
-                return true;
-            }
-            if (slot.TopHash == 1) { if (firstTombstone == SIZE_MAX) firstTombstone = idx; }
-            else if (slot.TopHash == th && slot.Key == key) return false;
-            idx = (idx + 1) & (capacity - 1);
+    MemSize InsertNew(uint64 hash, KArg&& key, VArg&& value) {
+        if (count + tombstones + 1 > MaxFilled()) {
+            // Enough of the budget is tombstones: compact in place. Otherwise grow.
+            // The 7/8 margin guarantees at least MaxFilled()/8 inserts before the next rehash.
+            if (capacity != 0 && (count + 1) * 8 <= MaxFilled() * 7) Rehash(capacity);
+            else Rehash(capacity == 0 ? CapacityFor(count + 1) : capacity * 2);
         }
+
+        const MemSize slot = FindInsertSlot(hash);
+        if (control[slot] == kDeleted) tombstones--;
+        new (&slots[slot]) PairType(std::forward<KArg>(key), std::forward<VArg>(value));
+        control[slot] = H2(hash);
+        count++;
+        return slot;
     }
 
-    Bool FindIndex(const Key& key, size_t& outIdx) const {
-
-        ENSURE(this != nullptr);
-        ENSURE(capacity != 0);
-        ENSURE(buckets.Num() == capacity);          // veya >= capacity, tasarımına göre
-        ENSURE(buckets.Data() != nullptr); 
-
-        size_t hash = HashKey(key);
-        uint8 th = TopHash(hash);
-        size_t idx = hash & (capacity - 1);
-
-        while (true) {
-            // SIMD check 16 TopHash bytes at a time
-            size_t step = 16;
-            for (size_t i = 0; i < step; i += 16) {
-                if (idx + i >= capacity) break;
-                __m128i topHashes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&buckets[idx + i].TopHash));
-                __m128i target = _mm_set1_epi8(th);
-                __m128i cmp = _mm_cmpeq_epi8(topHashes, target);
-                int mask = _mm_movemask_epi8(cmp);
-                if (mask != 0) {
-                    // At least one candidate, check Key equality
-                    for (int j = 0; j < 16; j++) {
-                        if ((mask >> j) & 1) {
-                            size_t checkIdx = (idx + i + j) & (capacity - 1);
-                            const auto& slot = buckets[checkIdx];
-                            if (slot.TopHash >= 2 && slot.Key == key) { outIdx = checkIdx; return true; }
-                        }
-                    }
-                }
-            }
-            // fallback linear probe
-            if (buckets[idx].TopHash == 0) return false;
-            idx = (idx + 1) & (capacity - 1);
+    void Allocate(MemSize newCapacity) {
+        const MemSize slotsOffset = (newCapacity + kSlotAlignment - 1) & ~(kSlotAlignment - 1);
+        const MemSize bytes = slotsOffset + newCapacity * sizeof(PairType);
+        uint8* memory = static_cast<uint8*>(::operator new(bytes, std::align_val_t(kSlotAlignment)));
+        control = reinterpret_cast<int8*>(memory);
+        slots = reinterpret_cast<PairType*>(memory + slotsOffset);
+        capacity = newCapacity;
+        std::memset(control, kEmpty, capacity);
+    }
+
+    // Moves every live element into a fresh table of newCapacity; tombstones are dropped.
+    void Rehash(MemSize newCapacity) {
+        int8* oldControl = control;
+        PairType* oldSlots = slots;
+        const MemSize oldCapacity = capacity;
+
+        Allocate(newCapacity);
+        tombstones = 0;
+
+        for (MemSize i = 0; i < oldCapacity; ++i) {
+            if (!IsFull(oldControl[i])) continue;
+            PairType& pair = oldSlots[i];
+            const uint64 hash = HashKey(pair.Key);
+            const MemSize slot = FindInsertSlot(hash);
+            new (&slots[slot]) PairType(std::move(pair));
+            control[slot] = H2(hash);
+            pair.~PairType();
         }
+
+        if (oldControl) ::operator delete(oldControl, std::align_val_t(kSlotAlignment));
+    }
+
+    void DestroyElements() {
+        if constexpr (!std::is_trivially_destructible_v<PairType>) {
+            for (MemSize i = 0; i < capacity; ++i)
+                if (IsFull(control[i])) slots[i].~PairType();
+        }
+    }
+
+    void ReleaseStorage() {
+        if (!control) return;
+        DestroyElements();
+        ::operator delete(control, std::align_val_t(kSlotAlignment));
+        control = nullptr;
+        slots = nullptr;
+        capacity = 0;
+        count = 0;
+        tombstones = 0;
+    }
+
+    void CopyFrom(const TMap& other) {
+        if (other.count == 0) return;
+        Allocate(other.capacity);
+        std::memcpy(control, other.control, capacity);
+        for (MemSize i = 0; i < capacity; ++i)
+            if (IsFull(control[i])) new (&slots[i]) PairType(other.slots[i]);
+        count = other.count;
+        tombstones = other.tombstones;
+    }
+
+    void StealFrom(TMap& other) {
+        control = other.control;
+        slots = other.slots;
+        capacity = other.capacity;
+        count = other.count;
+        tombstones = other.tombstones;
+        maxLoadFactor = other.maxLoadFactor;
+        other.control = nullptr;
+        other.slots = nullptr;
+        other.capacity = 0;
+        other.count = 0;
+        other.tombstones = 0;
     }
 };
 
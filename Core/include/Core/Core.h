@@ -9,10 +9,11 @@
 #include "Log.h"
 #include "Timer.h"
 #include "Delegate.h"
-#include "MultiThreading/BucketScheduler.h"
+#include "MultiThreading/JobSystem.h"
 #include "Reflection.h" 
 #include "Core/Serialization/ISerializer.h"
 #include "Core/Serialization/YamlSerializer.h"
 #include "Core/Serialization/BinaryStream.h"
+#include "Core/Serialization/MappedFileStream.h"
 
 
@@ -0,0 +1,213 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "Core/CoreTypes.h"
+#include "Core/CoreMacros.h"
+#include "Core/CoreMemory.h"
+#include "Core/Containers/TArray.h"
+
+namespace Rebel::Core::Threading
+{
+
+// ---------- Counter ----------
+// Tracks outstanding jobs. Pass one to Schedule() and hand it to JobSystem::Wait()
+// to block until every job that referenced it has finished.
+class JobCounter
+{
+public:
+	JobCounter() = default;
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+	Bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+	int32 GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+	friend class JobSystem;
+
+	std::atomic<int32> m_Pending{0};
+};
+
+// ---------- Job ----------
+// Fixed-size job record. The callable lives in inline storage, so scheduling never
+// touches the heap. Captures larger than kStorageSize must be passed by pointer.
+struct ALIGNAS(64) Job
+{
+	static constexpr MemSize kStorageSize = 96;
+
+	using ExecuteFn = void (*)(Job&);
+
+	enum class EState : uint8
+	{
+		Free,
+		Queued
+	};
+
+	ExecuteFn Execute = nullptr;
+	JobCounter* Counter = nullptr;
+	std::atomic<EState> State{EState::Free};
+	alignas(16) unsigned char Storage[kStorageSize];
+
+	template<typename F>
+	void Bind(F&& func)
+	{
+		using FuncType = std::decay_t<F>;
+		STATIC_ASSERT(sizeof(FuncType) <= kStorageSize, "Job capture is too large; capture by pointer instead");
+		STATIC_ASSERT(alignof(FuncType) <= 16, "Job capture alignment exceeds inline storage alignment");
+
+		new (Storage) FuncType(std::forward<F>(func));
+		Execute = [](Job& job)
+		{
+			FuncType* callable = std::launder(reinterpret_cast<FuncType*>(job.Storage));
+			(*callable)();
+			callable->~FuncType();
+		};
+	}
+};
+
+// ---------- Work-stealing deque ----------
+// Chase-Lev deque. The owning thread pushes and pops at the bottom, any other
+// thread may steal from the top. Fixed capacity; Push() fails when full.
+class WorkStealingQueue
+{
+public:
+	static constexpr int64 kCapacity = 4096;
+	static constexpr int64 kMask = kCapacity - 1;
+	STATIC_ASSERT((kCapacity & kMask) == 0, "WorkStealingQueue capacity must be a power of two");
+
+	Bool Push(Job* job);
+	Job* Pop();
+	Job* Steal();
+
+	Bool IsEmpty() const
+	{
+		return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed);
+	}
+
+private:
+	ALIGNAS(64) std::atomic<int64> m_Top{0};
+	ALIGNAS(64) std::atomic<int64> m_Bottom{0};
+	ALIGNAS(64) std::atomic<Job*> m_Buffer[kCapacity]{};
+};
+
+// ---------- Job system ----------
+class JobSystem
+{
+public:
+	static constexpr uint32 kJobPoolSize = 4096;
+
+	// workerCount == 0 picks hardware_concurrency() - 1. The constructing thread
+	// becomes context 0 and participates whenever it waits.
+	explicit JobSystem(uint32 workerCount = 0);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// Engine-wide shared pool. Created on first use by the calling thread.
+	static JobSystem& Get();
+
+	uint32 GetWorkerCount() const { return static_cast<uint32>(m_Workers.Num()); }
+	// Worker threads plus the owning thread.
+	uint32 GetThreadCount() const { return GetWorkerCount() + 1; }
+
+	// Index of the calling thread inside this system (0 = owner), or -1 for foreign threads.
+	int32 GetCurrentThreadIndex() const;
+
+	template<typename F>
+	void Schedule(F&& func, JobCounter* counter = nullptr)
+	{
+		Job* job = AllocateJob();
+		if (!job)
+		{
+			// Pool exhausted: run inline rather than overwrite a live job.
+			func();
+			return;
+		}
+
+		job->Bind(std::forward<F>(func));
+		job->Counter = counter;
+		if (counter)
+			counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		Submit(job);
+	}
+
+	// Blocks until counter reaches zero, executing other jobs while waiting.
+	void Wait(const JobCounter& counter);
+
+	// Splits [0, count) into chunks of at most grain elements and runs
+	// body(begin, end) for each chunk across the pool. Returns when all chunks are done.
+	template<typename F>
+	void ParallelFor(MemSize count, MemSize grain, const F& body)
+	{
+		if (count == 0)
+			return;
+
+		if (grain == 0)
+			grain = 1;
+
+		if (count <= grain || m_Workers.IsEmpty())
+		{
+			body(MemSize(0), count);
+			return;
+		}
+
+		JobCounter counter;
+		for (MemSize begin = grain; begin < count; begin += grain)
+		{
+			const MemSize end = std::min(begin + grain, count);
+			const F* bodyPtr = &body;
+			Schedule([bodyPtr, begin, end]() { (*bodyPtr)(begin, end); }, &counter);
+		}
+
+		// The caller takes the first chunk itself.
+		body(MemSize(0), std::min(grain, count));
+		Wait(counter);
+	}
+
+private:
+	struct ThreadContext
+	{
+		WorkStealingQueue Queue;
+		Job JobPool[kJobPoolSize];
+		uint32 NextJob = 0;
+		uint32 StealSeed = 0;
+		std::thread Thread;
+		// Thread that owns this context; default id while unowned.
+		std::atomic<std::thread::id> ThreadId{};
+	};
+
+	Job* AllocateJob();
+	Job* AllocateFrom(ThreadContext& context);
+	void Submit(Job* job);
+	void Execute(Job* job);
+	Job* FindJob(ThreadContext* self);
+	void WorkerLoop(uint32 contextIndex);
+	void WakeWorkers();
+
+	ThreadContext* GetCurrentContext() const;
+
+	// m_Contexts[0] belongs to the owning thread, [1..N] to workers.
+	Memory::TArray<Memory::UniquePtr<ThreadContext>> m_Contexts;
+	Memory::TArray<ThreadContext*> m_Workers;
+
+	// Foreign threads push here under a lock; the queue is only ever drained by stealing.
+	Memory::UniquePtr<ThreadContext> m_ExternalContext;
+	std::mutex m_ExternalMutex;
+
+	ALIGNAS(64) std::atomic<int32> m_QueuedJobs{0};
+	std::atomic<int32> m_SleepingWorkers{0};
+	std::atomic<Bool> m_bShutdown{false};
+	std::mutex m_WakeMutex;
+	std::condition_variable m_WakeCv;
+};
+
+}
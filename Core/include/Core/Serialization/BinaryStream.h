@@ -15,6 +15,10 @@ public:
 	virtual  void Seek(uint64 pos) = 0;
 	virtual bool IsOpen() const = 0;
 
+	// Lends the next 'size' bytes in place and advances past them. Streams
+	// that cannot (or a misaligned position) return nullptr and the caller
+	// falls back to Read. See MappedFileStream.
+	virtual const void* View(size_t, size_t) { return nullptr; }
 };
 
 DEFINE_LOG_CATEGORY(FileIO)
@@ -134,6 +138,11 @@ public:
 		stream.Read(data, size);
 	}
 
+	const void* ViewBytes(size_t size, size_t alignment)
+	{
+		return stream.View(size, alignment);
+	}
+
 	uint64 Tell() const
 	{
 		return stream.Tell();
@@ -174,6 +183,19 @@ BinaryReader& operator>>(BinaryReader& ar, TArray<T>& arr)
 {
 	uint32 count;
 	ar >> count;
+	if constexpr (std::is_trivially_copyable_v<T>)
+	{
+		// Zero-copy when the stream can lend its storage; the array copies on
+		// first write.
+		if (count > 0)
+		{
+			if (const void* view = ar.ViewBytes(count * sizeof(T), alignof(T)))
+			{
+				arr.AdoptView(static_cast<const T*>(view), count);
+				return ar;
+			}
+		}
+	}
 	arr.Resize(count);
 	if (count > 0)
 		ar.ReadBytes(arr.Data(), count * sizeof(T));
@@ -192,11 +214,12 @@ inline BinaryReader& operator>>(BinaryReader& ar, String& s)
 {
 	uint32 len;
 	ar >> len;
-	char* buf = new char[len + 1];
+	char stackBuf[256];
+	char* buf = len <= sizeof(stackBuf) ? stackBuf : new char[len];
 	ar.ReadBytes(buf, len);
-	buf[len] = 0;
-	s = String(buf);
-	delete[] buf;
+	s = String(buf, len);
+	if (buf != stackBuf)
+		delete[] buf;
 	return ar;
 }
 
@@ -0,0 +1,67 @@
+#pragma once
+#include "Core/CoreMemory.h"
+#include "Core/Serialization/BinaryStream.h"
+
+// A whole file mapped read-only into the address space. Shared between the
+// stream reading it and any arrays that borrowed views into it, so the
+// mapping outlives the stream as long as someone still points into it.
+class MappedFile
+{
+public:
+	explicit MappedFile(const char* path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool IsOpen() const { return m_Data != nullptr; }
+	const uint8* GetData() const { return m_Data; }
+	uint64 GetSize() const { return m_Size; }
+
+private:
+	const uint8* m_Data = nullptr;
+	uint64 m_Size = 0;
+
+	// Native handles, kept opaque so platform headers stay out of here.
+	void* m_FileHandle = nullptr;
+	void* m_MappingHandle = nullptr;
+};
+
+// Read-only BinaryStream over a MappedFile. Reads are memcpys out of the
+// mapping instead of stdio calls. Opened with bLendViews, View() also hands
+// out pointers into the mapping so trivially copyable arrays can adopt them
+// without a copy (TArray::AdoptView); the caller then has to keep
+// GetMapping() alive for as long as those arrays do.
+class MappedFileStream : public BinaryStream
+{
+public:
+	explicit MappedFileStream(const char* path, bool bLendViews = false);
+
+	// Reads the [offset, offset + size) window of an existing mapping, e.g. one
+	// entry of a packed archive. Tell/Seek are relative to the window start.
+	MappedFileStream(const RSharedPtr<MappedFile>& mapping, uint64 offset, uint64 size, bool bLendViews = false);
+
+	bool IsOpen() const override;
+
+	void Write(const void* data, size_t size) override;
+	void Read(void* data, size_t size) override;
+	uint64 Tell() const override { return m_Position; }
+	void Seek(uint64 pos) override;
+
+	const void* View(size_t size, size_t alignment) override;
+
+	const RSharedPtr<MappedFile>& GetMapping() const { return m_Mapping; }
+
+	// True once View() lent out at least one pointer into the mapping.
+	bool HasLentViews() const { return m_bLentViews; }
+
+private:
+	const uint8* GetWindowData() const { return m_Mapping->GetData() + m_WindowOffset; }
+
+	RSharedPtr<MappedFile> m_Mapping;
+	uint64 m_WindowOffset = 0;
+	uint64 m_WindowSize = 0;
+	uint64 m_Position = 0;
+	bool m_bLendViews = false;
+	bool m_bLentViews = false;
+};
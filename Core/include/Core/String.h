@@ -28,6 +28,21 @@ public:
         }
     }
 
+    // Copies 'len' chars; 'str' need not be null-terminated.
+    String(const char* str, MemSize len) {
+        if (len < SSO_SIZE) {
+            std::memcpy(sso, str, len);
+            sso[len] = '\0';
+            m_capacity = SSO_SIZE;
+        } else {
+            m_capacity = len + 1;
+            heap = static_cast<char*>(Memory::DefaultAllocator().Allocate(m_capacity));
+            std::memcpy(heap, str, len);
+            heap[len] = '\0';
+        }
+        m_size = len;
+    }
+
     String(const String& other) {
         if (other.isSSO()) {
             std::memcpy(sso, other.sso, other.m_size + 1);
@@ -0,0 +1,38 @@
+#include "Core/CorePch.h"
+#include "Core/AssetPtrBase.h"
+
+namespace
+{
+	IAssetReferenceTracker* s_ReferenceTracker = nullptr;
+	uint32 s_TrackerGeneration = 0;
+}
+
+void AssetPtrBase::SetReferenceTracker(IAssetReferenceTracker* tracker)
+{
+	s_ReferenceTracker = tracker;
+	++s_TrackerGeneration;
+}
+
+IAssetReferenceTracker* AssetPtrBase::GetReferenceTracker()
+{
+	return s_ReferenceTracker;
+}
+
+void AssetPtrBase::AddReference()
+{
+	if (!s_ReferenceTracker || static_cast<uint64>(Handle) == 0)
+		return;
+
+	s_ReferenceTracker->AddAssetReference(Handle);
+	TrackedGeneration = s_TrackerGeneration;
+}
+
+void AssetPtrBase::ReleaseReference()
+{
+	if (TrackedGeneration == 0)
+		return;
+
+	if (TrackedGeneration == s_TrackerGeneration && s_ReferenceTracker)
+		s_ReferenceTracker->ReleaseAssetReference(Handle);
+	TrackedGeneration = 0;
+}
@@ -0,0 +1,316 @@
+#include "Core/CorePch.h"
+#include "Core/MultiThreading/JobSystem.h"
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define JOB_CPU_PAUSE() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JOB_CPU_PAUSE() _mm_pause()
+#else
+#define JOB_CPU_PAUSE() ((void)0)
+#endif
+
+namespace Rebel::Core::Threading
+{
+
+namespace
+{
+	constexpr uint32 kSpinsBeforeSleep = 64;
+}
+
+// ---------- WorkStealingQueue ----------
+Bool WorkStealingQueue::Push(Job* job)
+{
+	const int64 bottom = m_Bottom.load(std::memory_order_relaxed);
+	const int64 top = m_Top.load(std::memory_order_acquire);
+	if (bottom - top >= kCapacity)
+		return false;
+
+	m_Buffer[bottom & kMask].store(job, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+	return true;
+}
+
+Job* WorkStealingQueue::Pop()
+{
+	const int64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+	m_Bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64 top = m_Top.load(std::memory_order_relaxed);
+
+	if (top > bottom)
+	{
+		// Empty
+		m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Job* job = m_Buffer[bottom & kMask].load(std::memory_order_relaxed);
+	if (top != bottom)
+		return job;
+
+	// Last element: race against thieves for it.
+	if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		job = nullptr;
+
+	m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+	return job;
+}
+
+Job* WorkStealingQueue::Steal()
+{
+	int64 top = m_Top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const int64 bottom = m_Bottom.load(std::memory_order_acquire);
+
+	if (top >= bottom)
+		return nullptr;
+
+	Job* job = m_Buffer[top & kMask].load(std::memory_order_relaxed);
+	if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return nullptr;
+
+	return job;
+}
+
+// ---------- JobSystem ----------
+JobSystem::JobSystem(uint32 workerCount)
+{
+	if (workerCount == 0)
+	{
+		const uint32 hardwareThreads = std::thread::hardware_concurrency();
+		workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	m_Contexts.Reserve(workerCount + 1);
+	for (uint32 i = 0; i < workerCount + 1; ++i)
+	{
+		m_Contexts.Emplace(Memory::MakeUnique<ThreadContext>());
+		m_Contexts[i]->StealSeed = i * 2654435761u + 1u;
+	}
+
+	m_ExternalContext = Memory::MakeUnique<ThreadContext>();
+
+	m_Contexts[0]->ThreadId.store(std::this_thread::get_id(), std::memory_order_release);
+
+	m_Workers.Reserve(workerCount);
+	for (uint32 i = 1; i <= workerCount; ++i)
+	{
+		ThreadContext* context = m_Contexts[i].Get();
+		m_Workers.Emplace(context);
+		context->Thread = std::thread(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_WakeMutex);
+		m_bShutdown.store(true, std::memory_order_release);
+	}
+	m_WakeCv.notify_all();
+
+	for (ThreadContext* worker : m_Workers)
+	{
+		if (worker->Thread.joinable())
+			worker->Thread.join();
+	}
+
+	// Anything still queued never ran; drain it on this thread so counters settle.
+	while (Job* job = FindJob(GetCurrentContext()))
+		Execute(job);
+}
+
+JobSystem& JobSystem::Get()
+{
+	static JobSystem s_Instance;
+	return s_Instance;
+}
+
+int32 JobSystem::GetCurrentThreadIndex() const
+{
+	// Looked up per system: a thread may own a context in several systems at
+	// once (the shared pool plus one a test or subsystem created).
+	const std::thread::id self = std::this_thread::get_id();
+	for (MemSize i = 0; i < m_Contexts.Num(); ++i)
+	{
+		if (m_Contexts[i]->ThreadId.load(std::memory_order_acquire) == self)
+			return static_cast<int32>(i);
+	}
+	return -1;
+}
+
+JobSystem::ThreadContext* JobSystem::GetCurrentContext() const
+{
+	const int32 index = GetCurrentThreadIndex();
+	return index >= 0 ? m_Contexts[static_cast<MemSize>(index)].Get() : nullptr;
+}
+
+Job* JobSystem::AllocateFrom(ThreadContext& context)
+{
+	Job& job = context.JobPool[context.NextJob & (kJobPoolSize - 1)];
+	if (job.State.load(std::memory_order_acquire) != Job::EState::Free)
+		return nullptr;
+
+	++context.NextJob;
+	job.State.store(Job::EState::Queued, std::memory_order_relaxed);
+	return &job;
+}
+
+Job* JobSystem::AllocateJob()
+{
+	if (ThreadContext* context = GetCurrentContext())
+		return AllocateFrom(*context);
+
+	std::lock_guard<std::mutex> lock(m_ExternalMutex);
+	return AllocateFrom(*m_ExternalContext);
+}
+
+void JobSystem::Submit(Job* job)
+{
+	Bool bPushed = false;
+	if (ThreadContext* context = GetCurrentContext())
+	{
+		bPushed = context->Queue.Push(job);
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(m_ExternalMutex);
+		bPushed = m_ExternalContext->Queue.Push(job);
+	}
+
+	if (!bPushed)
+	{
+		// Deque full: execute immediately, the counter still settles normally.
+		Execute(job);
+		return;
+	}
+
+	m_QueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+	WakeWorkers();
+}
+
+void JobSystem::WakeWorkers()
+{
+	if (m_SleepingWorkers.load(std::memory_order_seq_cst) == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(m_WakeMutex);
+	m_WakeCv.notify_one();
+}
+
+void JobSystem::Execute(Job* job)
+{
+	job->Execute(*job);
+
+	JobCounter* counter = job->Counter;
+	job->Counter = nullptr;
+	job->Execute = nullptr;
+	job->State.store(Job::EState::Free, std::memory_order_release);
+
+	if (counter)
+		counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+Job* JobSystem::FindJob(ThreadContext* self)
+{
+	if (self)
+	{
+		if (Job* job = self->Queue.Pop())
+		{
+			m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	const uint32 contextCount = static_cast<uint32>(m_Contexts.Num());
+	uint32 seed = self ? self->StealSeed : static_cast<uint32>(reinterpret_cast<uintptr_t>(&seed) >> 4);
+	// xorshift to pick a random starting victim; then sweep every queue once.
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	if (self)
+		self->StealSeed = seed;
+
+	const uint32 start = seed % contextCount;
+	for (uint32 i = 0; i < contextCount; ++i)
+	{
+		ThreadContext* victim = m_Contexts[(start + i) % contextCount].Get();
+		if (victim == self)
+			continue;
+
+		if (Job* job = victim->Queue.Steal())
+		{
+			m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	if (Job* job = m_ExternalContext->Queue.Steal())
+	{
+		m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+		return job;
+	}
+
+	return nullptr;
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+	ThreadContext* self = GetCurrentContext();
+	while (!counter.IsDone())
+	{
+		if (Job* job = FindJob(self))
+		{
+			Execute(job);
+			continue;
+		}
+
+		// Remaining jobs are already running on other threads.
+		JOB_CPU_PAUSE();
+		std::this_thread::yield();
+	}
+}
+
+void JobSystem::WorkerLoop(uint32 contextIndex)
+{
+	ThreadContext* self = m_Contexts[contextIndex].Get();
+	self->ThreadId.store(std::this_thread::get_id(), std::memory_order_release);
+	uint32 idleSpins = 0;
+
+	while (true)
+	{
+		if (Job* job = FindJob(self))
+		{
+			Execute(job);
+			idleSpins = 0;
+			continue;
+		}
+
+		if (m_bShutdown.load(std::memory_order_acquire))
+			break;
+
+		if (++idleSpins < kSpinsBeforeSleep)
+		{
+			JOB_CPU_PAUSE();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_WakeMutex);
+		m_SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+		m_WakeCv.wait(lock, [this]()
+		{
+			return m_bShutdown.load(std::memory_order_acquire) || m_QueuedJobs.load(std::memory_order_seq_cst) > 0;
+		});
+		m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+		idleSpins = 0;
+	}
+
+	self->ThreadId.store(std::thread::id(), std::memory_order_release);
+}
+
+}
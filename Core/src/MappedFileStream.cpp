@@ -0,0 +1,182 @@
+#include "Core/CorePch.h"
+#include "Core/Serialization/MappedFileStream.h"
+
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const char* path)
+{
+	if (!path || path[0] == '\0')
+		return;
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		RB_LOG(FileIO, error, "Failed to open file: {}", path);
+		return;
+	}
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		RB_LOG(FileIO, error, "Failed to map file: {}", path);
+		CloseHandle(file);
+		return;
+	}
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		RB_LOG(FileIO, error, "Failed to map file: {}", path);
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return;
+	}
+
+	m_FileHandle = file;
+	m_MappingHandle = mapping;
+	m_Data = static_cast<const uint8*>(view);
+	m_Size = (uint64)size.QuadPart;
+#else
+	const int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		RB_LOG(FileIO, error, "Failed to open file: {}", path);
+		return;
+	}
+
+	struct stat st{};
+	if (::fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		::close(fd);
+		return;
+	}
+
+	void* view = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps its own reference to the file.
+	::close(fd);
+	if (view == MAP_FAILED)
+	{
+		RB_LOG(FileIO, error, "Failed to map file: {}", path);
+		return;
+	}
+
+	m_Data = static_cast<const uint8*>(view);
+	m_Size = (uint64)st.st_size;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32)
+	if (m_Data)
+		UnmapViewOfFile(m_Data);
+	if (m_MappingHandle)
+		CloseHandle(m_MappingHandle);
+	if (m_FileHandle)
+		CloseHandle(m_FileHandle);
+#else
+	if (m_Data)
+		::munmap(const_cast<uint8*>(m_Data), (size_t)m_Size);
+#endif
+}
+
+MappedFileStream::MappedFileStream(const char* path, bool bLendViews)
+	: m_Mapping(RMakeShared<MappedFile>(path))
+	, m_bLendViews(bLendViews)
+{
+	m_WindowSize = m_Mapping->GetSize();
+}
+
+MappedFileStream::MappedFileStream(const RSharedPtr<MappedFile>& mapping, uint64 offset, uint64 size, bool bLendViews)
+	: m_Mapping(mapping)
+	, m_bLendViews(bLendViews)
+{
+	const uint64 mappedSize = m_Mapping ? m_Mapping->GetSize() : 0;
+	if (offset > mappedSize || size > mappedSize - offset)
+	{
+		RB_LOG(FileIO, error, "Mapped window [{}, +{}) is outside a {} byte mapping", offset, size, mappedSize);
+		return;
+	}
+
+	m_WindowOffset = offset;
+	m_WindowSize = size;
+}
+
+bool MappedFileStream::IsOpen() const
+{
+	return m_Mapping && m_Mapping->IsOpen();
+}
+
+void MappedFileStream::Write(const void*, size_t size)
+{
+	RB_LOG(FileIO, error, "MappedFileStream is read-only; dropped a {} byte write", size);
+}
+
+void MappedFileStream::Read(void* data, size_t size)
+{
+	if (size == 0)
+		return;
+
+	const uint64 fileSize = IsOpen() ? m_WindowSize : 0;
+	const uint64 available = m_Position < fileSize ? fileSize - m_Position : 0;
+	const size_t copied = (size_t)std::min<uint64>(available, size);
+
+	if (copied > 0)
+		std::memcpy(data, GetWindowData() + m_Position, copied);
+
+	if (copied < size)
+	{
+		// Short read: match fread by leaving nothing uninitialised behind.
+		std::memset(static_cast<uint8*>(data) + copied, 0, size - copied);
+		RB_LOG(FileIO, error, "Read past end of mapped file ({} of {} bytes)", copied, size);
+	}
+
+	m_Position += copied;
+}
+
+void MappedFileStream::Seek(uint64 pos)
+{
+	const uint64 fileSize = IsOpen() ? m_WindowSize : 0;
+	m_Position = std::min(pos, fileSize);
+}
+
+const void* MappedFileStream::View(size_t size, size_t alignment)
+{
+	if (!m_bLendViews || !IsOpen())
+		return nullptr;
+
+	if (m_Position + size > m_WindowSize)
+		return nullptr;
+
+	const uint8* ptr = GetWindowData() + m_Position;
+	if (alignment > 1 && (reinterpret_cast<uintptr_t>(ptr) % alignment) != 0)
+		return nullptr;
+
+	m_Position += size;
+	m_bLentViews = true;
+	return ptr;
+}
@@ -2,7 +2,7 @@
 #include "Core/CorePch.h"
 #include "Core/Core.h"
 #include "Core/Delegate.h"
-#include "Core/MultiThreading/BucketScheduler.h"
+#include "Core/MultiThreading/JobSystem.h"
 #include "Core/Serialization/YamlSerializer.h"
 
 namespace Rebel::Core
@@ -159,32 +159,27 @@ namespace Rebel::Core
 
         
 
-        Threds::BucketScheduler scheduler(4, 10); // 2 buckets, 4 workers
+        Threading::JobSystem& jobs = Threading::JobSystem::Get();
         for (int frame = 0; frame < 3; ++frame) {
             PROFILE_SCOPE("main loop")
             s_Time = static_cast<float>(frame);
             RB_LOG(TaskLog, debug, "Main thread work : {}", frame)
 
-           
-            
-            // Fill bucket 0
+            // First wave
+            Threading::JobCounter firstWave;
             for (int i = 0; i <10; ++i)
-                scheduler.AddTask(0,[](){
+                jobs.Schedule([](){
                 testMT();
-            });
-
-            //scheduler.AddTask(0, new my_struct());
-            
-            
-            scheduler.SetBucketCallback(0, [&scheduler](){
-                // Add bucket 1 tasks only when bucket 0 is fully done
-                for (int i = 0; i < 5; ++i)
-                    scheduler.AddTask(1, &test2MT);
-            });
-
-            
-            scheduler.WaitForAllTasks(); // ensures frame tasks finish before next frame
-            //std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            }, &firstWave);
+
+            // Second wave only starts once the first is fully done
+            jobs.Wait(firstWave);
+
+            Threading::JobCounter secondWave;
+            for (int i = 0; i < 5; ++i)
+                jobs.Schedule(&test2MT, &secondWave);
+
+            jobs.Wait(secondWave); // ensures frame tasks finish before next frame
             RB_LOG(TaskLog, trace, "End Main Loop")
 
         }
@@ -2,6 +2,7 @@
 
 #include "Core/AssetPtrBase.h"
 #include "Engine/Framework/EnginePch.h"
+#include "Engine/Assets/AssetPtr.h"
 #include "imgui.h"
 
 class AssetEditor
@@ -18,6 +19,16 @@ public:
     virtual bool IsOpen() const = 0;
     virtual AssetHandle GetAssetHandle() const = 0;
     virtual void RequestFocus() {}
+
+protected:
+    // Loads the asset and keeps it referenced until ReleasePinnedAssets or
+    // the editor is destroyed. Editors hold raw pointers to what they show,
+    // so those assets must not be evicted under a memory budget meanwhile.
+    Asset* LoadPinned(AssetHandle handle);
+    void ReleasePinnedAssets() { m_PinnedAssets.Clear(); }
+
+private:
+    TArray<AssetPtr<Asset>> m_PinnedAssets;
 };
 
 class AssetEditorManager
@@ -1477,6 +1477,11 @@ inline bool SetPropertyCommand::Apply(const PropertyValue& value) const
             auto* sceneComponent = static_cast<SceneComponent*>(m_Object);
             sceneComponent->SetRotationEuler(*v);
         }
+        else if (m_OwnerType && m_OwnerType->IsA(SceneComponent::StaticType()))
+        {
+            // Position/Scale were written through the field pointer; drop the cached world transform.
+            static_cast<SceneComponent*>(m_Object)->MarkTransformDirty();
+        }
 
         return true;
     }
@@ -1588,6 +1588,7 @@ private:
 
     void Touch(bool previewDirty)
     {
+        m_Graph.Compile();
         m_Dirty = true;
         if (previewDirty)
             m_PreviewDirty = true;
@@ -1967,6 +1968,7 @@ private:
 
     void Touch(bool previewDirty)
     {
+        m_Graph.Compile();
         m_Dirty = true;
         if (previewDirty)
             m_PreviewDirty = true;
@@ -2167,6 +2169,7 @@ void PreviewAssetEditorBase::CloseBase()
     m_IsOpen = false;
     m_LayoutInitialized = false;
     EndPreviewCameraInteraction();
+    ReleasePinnedAssets();
 }
 
 const Rebel::Core::Reflection::TypeInfo* AnimationAssetEditor::GetSupportedAssetType() const
@@ -2186,10 +2189,9 @@ bool AnimationAssetEditor::ReloadAsset()
     if (!assetModule)
         return false;
 
-    m_Animation = dynamic_cast<AnimationAsset*>(assetModule->GetManager().Load(m_AssetHandle));
-    m_Skeleton = m_Animation && IsValidAssetHandle(m_Animation->m_SkeletonID)
-        ? dynamic_cast<SkeletonAsset*>(assetModule->GetManager().Load(m_Animation->m_SkeletonID))
-        : nullptr;
+    ReleasePinnedAssets();
+    m_Animation = dynamic_cast<AnimationAsset*>(LoadPinned(m_AssetHandle));
+    m_Skeleton = m_Animation ? dynamic_cast<SkeletonAsset*>(LoadPinned(m_Animation->m_SkeletonID)) : nullptr;
 
     m_PreviewScene.Clear();
     m_PreviewActor = nullptr;
@@ -2432,8 +2434,8 @@ void SkeletonAssetEditor::Open(const AssetHandle assetHandle)
 
 bool SkeletonAssetEditor::ReloadAsset()
 {
-    AssetManagerModule* assetModule = GEngine ? GEngine->GetModuleManager().GetModule<AssetManagerModule>() : nullptr;
-    m_Skeleton = assetModule ? dynamic_cast<SkeletonAsset*>(assetModule->GetManager().Load(m_AssetHandle)) : nullptr;
+    ReleasePinnedAssets();
+    m_Skeleton = dynamic_cast<SkeletonAsset*>(LoadPinned(m_AssetHandle));
     m_SelectedBone = -1;
     m_LayoutInitialized = false;
     ResetPreviewCamera();
@@ -2539,10 +2541,11 @@ void SkeletonAssetEditor::DrawSkeletonTree()
     if (!m_Skeleton)
         return;
 
-    for (int32 i = 0; i < m_Skeleton->m_Parent.Num(); ++i)
+    const SkeletonAsset& skeleton = *m_Skeleton;
+    for (int32 i = 0; i < skeleton.m_Parent.Num(); ++i)
     {
-        if (m_Skeleton->m_Parent[i] < 0)
-            DrawSkeletonTreeRecursive(*m_Skeleton, i, m_SelectedBone);
+        if (skeleton.m_Parent[i] < 0)
+            DrawSkeletonTreeRecursive(skeleton, i, m_SelectedBone);
     }
 }
 
@@ -2557,7 +2560,7 @@ void SkeletonAssetEditor::DrawDetails()
     {
         ImGui::Separator();
         ImGui::Text("Name: %s", m_Skeleton->m_BoneNames[m_SelectedBone].c_str());
-        ImGui::Text("Parent: %d", m_Skeleton->m_Parent[m_SelectedBone]);
+        ImGui::Text("Parent: %d", std::as_const(m_Skeleton->m_Parent)[m_SelectedBone]);
     }
 }
 
@@ -2578,10 +2581,9 @@ bool SkeletalMeshAssetEditor::ReloadAsset()
     if (!assetModule)
         return false;
 
-    m_Mesh = dynamic_cast<SkeletalMeshAsset*>(assetModule->GetManager().Load(m_AssetHandle));
-    m_Skeleton = m_Mesh && IsValidAssetHandle(m_Mesh->m_Skeleton.GetHandle())
-        ? dynamic_cast<SkeletonAsset*>(assetModule->GetManager().Load(m_Mesh->m_Skeleton.GetHandle()))
-        : nullptr;
+    ReleasePinnedAssets();
+    m_Mesh = dynamic_cast<SkeletalMeshAsset*>(LoadPinned(m_AssetHandle));
+    m_Skeleton = m_Mesh ? dynamic_cast<SkeletonAsset*>(LoadPinned(m_Mesh->m_Skeleton.GetHandle())) : nullptr;
     m_LayoutInitialized = false;
     ResetPreviewCamera();
     return RebuildPreview();
@@ -2700,8 +2702,8 @@ void AnimGraphAssetEditor::Open(const AssetHandle assetHandle)
 
 bool AnimGraphAssetEditor::ReloadAsset()
 {
-    AssetManagerModule* assetModule = GEngine ? GEngine->GetModuleManager().GetModule<AssetManagerModule>() : nullptr;
-    m_Graph = assetModule ? dynamic_cast<AnimGraphAsset*>(assetModule->GetManager().Load(m_AssetHandle)) : nullptr;
+    ReleasePinnedAssets();
+    m_Graph = dynamic_cast<AnimGraphAsset*>(LoadPinned(m_AssetHandle));
     if (m_Graph)
     {
         m_Graph->EnsureDefaultGraph();
@@ -2727,11 +2729,9 @@ bool AnimGraphAssetEditor::RebuildPreview()
         return false;
 
     const AssetHandle clipHandle = FindPreviewClipHandle(*m_Graph);
-    m_PreviewAnimation = IsValidAssetHandle(clipHandle)
-        ? dynamic_cast<AnimationAsset*>(assetModule->GetManager().Load(clipHandle))
-        : nullptr;
-    m_PreviewSkeleton = m_PreviewAnimation && IsValidAssetHandle(m_PreviewAnimation->m_SkeletonID)
-        ? dynamic_cast<SkeletonAsset*>(assetModule->GetManager().Load(m_PreviewAnimation->m_SkeletonID))
+    m_PreviewAnimation = dynamic_cast<AnimationAsset*>(LoadPinned(clipHandle));
+    m_PreviewSkeleton = m_PreviewAnimation
+        ? dynamic_cast<SkeletonAsset*>(LoadPinned(m_PreviewAnimation->m_SkeletonID))
         : nullptr;
 
     if (!m_PreviewAnimation || !m_PreviewSkeleton)
@@ -2772,6 +2772,9 @@ bool AnimGraphAssetEditor::SaveAsset()
 
 void AnimGraphAssetEditor::MarkDirty()
 {
+    // The preview runs the compiled program, so every edit recompiles it.
+    if (m_Graph)
+        m_Graph->Compile();
     m_Dirty = true;
     m_PreviewDirty = true;
     m_StatusMessage = "Unsaved changes";
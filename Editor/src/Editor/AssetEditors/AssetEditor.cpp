@@ -9,6 +9,26 @@ bool AssetEditor::CanOpen(const Rebel::Core::Reflection::TypeInfo* assetType) co
     return assetType && supportedType && assetType->IsA(supportedType);
 }
 
+Asset* AssetEditor::LoadPinned(const AssetHandle handle)
+{
+    AssetManagerModule* assetModule = GEngine ? GEngine->GetModuleManager().GetModule<AssetManagerModule>() : nullptr;
+    if (!assetModule || !IsValidAssetHandle(handle))
+        return nullptr;
+
+    Asset* asset = assetModule->GetManager().Load(handle);
+    if (!asset)
+        return nullptr;
+
+    for (const AssetPtr<Asset>& pinned : m_PinnedAssets)
+    {
+        if (pinned.GetHandle() == handle)
+            return asset;
+    }
+
+    m_PinnedAssets.Emplace(handle);
+    return asset;
+}
+
 void AssetEditorManager::RegisterEditor(AssetEditor& editor)
 {
     for (AssetEditor* existing : m_EditorPrototypes)
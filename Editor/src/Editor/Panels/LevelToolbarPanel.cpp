@@ -211,6 +211,16 @@ void LevelToolbarPanel::Draw()
         }
     }
 
+    ImGui::SameLine();
+    if (DrawToolbarButton("CookAssets", ICON_FA_BOX_ARCHIVE, "Cook"))
+    {
+        AssetManagerModule* assetModule = GEngine->GetModuleManager().GetModule<AssetManagerModule>();
+        if (assetModule && assetModule->CookArchive())
+            RB_LOG(EditorGUI, info, "Cooked asset archive '{}'", AssetArchive::DefaultPath);
+        else
+            RB_LOG(EditorGUI, warn, "Failed to cook asset archive.");
+    }
+
     ImGui::SameLine();
     const bool bIsPlaying = static_cast<EditorEngine*>(GEngine)->IsPlaying();
     if (DrawToolbarButton("PlayToggle", bIsPlaying ? ICON_FA_STOP : ICON_FA_PLAY, bIsPlaying ? "Stop PIE" : "Play PIE", true))
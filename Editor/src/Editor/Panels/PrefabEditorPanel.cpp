@@ -185,7 +185,8 @@ bool PrefabEditorPanel::ReloadPrefab()
     if (!assetModule || !IsValidAssetHandle(m_PrefabHandle))
         return false;
 
-    m_PrefabAsset = dynamic_cast<PrefabAsset*>(assetModule->GetManager().Load(m_PrefabHandle));
+    ReleasePinnedAssets();
+    m_PrefabAsset = dynamic_cast<PrefabAsset*>(LoadPinned(m_PrefabHandle));
     if (!m_PrefabAsset)
         return false;
 
@@ -463,6 +464,7 @@ void PrefabEditorPanel::Close()
     m_PreviewScene.Clear();
     m_PreviewActor = nullptr;
     m_PrefabAsset = nullptr;
+    ReleasePinnedAssets();
     m_PrefabHandle = 0;
     m_IsOpen = false;
     m_LayoutInitialized = false;
@@ -4,6 +4,7 @@
 #include "imgui.h"
 #include "Engine/Physics/PhysicsModule.h"
 #include "Engine/Physics/PhysicsSystem.h"
+#include "Engine/Assets/AssetManagerModule.h"
 #include "ThirdParty/imgui_impl_opengl3.h"
 #include "Engine/Scene/World.h"
 
@@ -253,6 +254,10 @@ void EditorEngine::Tick(float deltaTime)
 void EditorEngine::OnInit()
 {
 	BaseEngine::OnInit();
+
+	// Edits land in loose files, which must win over a stale cooked archive.
+	if (AssetManagerModule* assetModule = m_ModuleManager.GetModule<AssetManagerModule>())
+		assetModule->SetScanArchivedRoots(true);
 }
 
 void EditorEngine::OnShutdown()
@@ -131,6 +131,132 @@ struct AnimStateMachine
     TArray<AnimStateAlias> Aliases;
 };
 
+// ---------- Compiled runtime program ----------
+// Built from the editable graph by AnimGraphAsset::Compile(). Everything the
+// per-frame evaluation needs is resolved to array indices: pose nodes are laid
+// out in post-order (inputs before the node that consumes them), instance
+// properties are resolved to offsets once, and transitions are grouped by
+// source state. Node and state IDs are kept only for runtime/debug display.
+
+enum class AnimProgramOp : uint8
+{
+    Missing = 0,  // unresolved input or cycle; pushes an invalid pose
+    Clip,
+    Blend,        // pops B then A, pushes the blend (or whichever is valid)
+    StateMachine
+};
+
+// An AnimInstance property resolved against the graph's instance class.
+struct AnimPropertyBinding
+{
+    MemSize Offset = 0;
+    MemSize Size = 0;
+    Rebel::Core::Reflection::EPropertyType Type = Rebel::Core::Reflection::EPropertyType::Unknown;
+};
+
+struct AnimProgramNode
+{
+    AnimProgramOp Op = AnimProgramOp::Missing;
+    uint64 NodeID = 0;
+
+    // Clip. Referenced, so a compiled graph keeps its clips resident.
+    AssetPtr<AnimationAsset> AnimationClip;
+    float ClipStartTime = 0.0f;
+
+    // Blend
+    AnimBlendAlphaMode BlendAlphaMode = AnimBlendAlphaMode::Fixed;
+    float BlendAlpha = 0.5f;
+    float BlendInputMin = 0.0f;
+    float BlendInputMax = 1.0f;
+    float BlendTime = 0.0f;
+    bool bBlendInvertBool = false;
+    int32 BlendProperty = -1; // index into Bindings
+    int32 BlendSlot = -1;     // index into the component's BlendNodeRuntimes
+
+    // StateMachine
+    int32 StateMachine = -1;
+};
+
+struct AnimProgramCondition
+{
+    AnimConditionOp Op = AnimConditionOp::BoolIsTrue;
+    float FloatValue = 0.0f;
+    int32 IntValue = 0;
+    int32 Property = -1;
+};
+
+// A transition or alias target; both reduce to "go to state if conditions pass".
+struct AnimProgramTransition
+{
+    int32 ToState = -1;
+    float BlendDuration = 0.0f;
+    int32 FirstCondition = 0;
+    int32 ConditionCount = 0;
+};
+
+struct AnimProgramAlias
+{
+    bool bGlobal = true;
+    int32 FirstAllowedState = 0; // into AllowedStates
+    int32 AllowedStateCount = 0;
+    int32 FirstCondition = 0;
+    int32 ConditionCount = 0;
+    int32 FirstTarget = 0;       // into Transitions
+    int32 TargetCount = 0;
+};
+
+struct AnimProgramState
+{
+    uint64 ID = 0;
+    bool bLoop = true;
+    int32 FirstNode = 0;         // pose graph segment in Nodes
+    int32 NodeCount = 0;
+    int32 FirstTransition = 0;   // outgoing transitions, in authoring order
+    int32 TransitionCount = 0;
+    int32 FirstClip = 0;         // clip nodes that bound the state duration
+    int32 ClipCount = 0;
+};
+
+struct AnimProgramStateMachine
+{
+    uint64 ID = 0;
+    int32 EntryState = -1;       // absolute index into States
+    int32 FirstState = 0;
+    int32 StateCount = 0;
+    int32 FirstAlias = 0;
+    int32 AliasCount = 0;
+};
+
+struct AnimGraphProgram
+{
+    // Bumped on every Compile() so components can tell their runtime slots
+    // belong to an older program.
+    uint32 Revision = 0;
+    const Rebel::Core::Reflection::TypeInfo* InstanceType = nullptr;
+
+    int32 RootFirstNode = 0;
+    int32 RootNodeCount = 0;
+
+    TArray<AnimProgramNode> Nodes;
+    TArray<AnimPropertyBinding> Bindings;
+    TArray<AnimProgramCondition> Conditions;
+    TArray<AnimProgramTransition> Transitions;
+    TArray<AnimProgramAlias> Aliases;
+    TArray<int32> AllowedStates;
+    TArray<int32> StateClips;    // node indices
+    TArray<AnimProgramState> States;
+    TArray<AnimProgramStateMachine> StateMachines;
+
+    // Blend smoothing slots: (scope, node) pairs in slot order.
+    TArray<uint64> BlendSlotScopes;
+    TArray<uint64> BlendSlotNodes;
+
+    // Upper bound on the evaluation stack depth.
+    int32 MaxPoseStackDepth = 0;
+
+    bool IsValid() const { return Revision != 0 && RootNodeCount > 0; }
+};
+
 struct AnimGraphAsset : Asset
 {
     REFLECTABLE_CLASS(AnimGraphAsset, Asset)
@@ -178,6 +304,12 @@ struct AnimGraphAsset : Asset
     AnimTransition& AddTransition(AnimStateMachine& stateMachine, uint64 fromStateID, uint64 toStateID);
     AnimStateAlias& AddAlias(AnimStateMachine& stateMachine, const String& name);
 
+    // Rebuilds the runtime program. Runs in PostLoad; call again after editing
+    // nodes, states, transitions or the instance class in place.
+    void Compile();
+    bool IsCompiled() const { return m_Program.Revision != 0; }
+    const AnimGraphProgram& GetProgram() const { return m_Program; }
+
     TArray<AnimGraphNode> m_Nodes;
     TArray<AnimStateMachine> m_StateMachines;
     AssetHandle m_SkeletonID = 0;
@@ -185,6 +317,9 @@ struct AnimGraphAsset : Asset
     uint64 m_OutputNodeID = 0;
     uint64 m_NextNodeID = 1;
     uint64 m_NextStateMachineID = 1;
+
+private:
+    AnimGraphProgram m_Program;
 };
 
 REFLECT_CLASS(AnimGraphAsset, Asset)
@@ -48,6 +48,8 @@ struct AnimationAsset : Asset
     void Serialize(BinaryWriter& ar) override;
     void Deserialize(BinaryReader& ar) override;
     void PostLoad() override;
+    void DetachSourceViews() override;
+    MemSize GetMemorySize() const override;
 
     AssetDisplayColor GetDisplayColor() const override { return GetStaticDisplayColor(); }
 
@@ -4,6 +4,25 @@
 
 class Scene;
 class AssetManager;
+class AnimInstance;
+struct AnimGraphAsset;
+struct AnimationAsset;
+struct SkeletonAsset;
+struct SkeletalMeshComponent;
+
+// Inputs resolved on the game thread for one component's evaluate job.
+struct AnimationUpdateItem
+{
+    SkeletalMeshComponent* Component = nullptr;
+    SkeletonAsset* Skeleton = nullptr;
+    AnimGraphAsset* AnimGraph = nullptr;
+    AnimInstance* Instance = nullptr;
+    // Ready override clip, or nullptr to evaluate the regular animation.
+    const AnimationAsset* OverrideAnimation = nullptr;
+    bool bWantsOverrideAnimation = false;
+    // Owner's forward vector, snapshotted for root motion stripping.
+    Vector3 OwnerForward = Vector3(1.0f, 0.0f, 0.0f);
+};
 
 class AnimationModule : public IModule
 {
@@ -15,6 +34,11 @@ class AnimationModule : public IModule
     void SetSceneContext(Scene* scene) { m_Scene = scene; }
     void SetAssetManagerContext(AssetManager* assetManager) { m_AssetManager = assetManager; }
 
+    // Pose evaluation runs on the job system by default; turn off to profile
+    // or debug a single-threaded update.
+    void SetParallelEvaluation(bool bEnabled) { m_bParallelEvaluation = bEnabled; }
+    bool IsParallelEvaluation() const { return m_bParallelEvaluation; }
+
 private:
     void UpdateAnimations(float dt);
 
@@ -25,8 +49,15 @@ public:
     void Shutdown() override;
 
 private:
+    // Fewer components than this are not worth waking workers for.
+    static constexpr MemSize kParallelEvaluateThreshold = 8;
+    static constexpr MemSize kParallelEvaluateGrain = 4;
+
     Scene* m_Scene = nullptr;
     AssetManager* m_AssetManager = nullptr;
+
+    bool m_bParallelEvaluation = true;
+    TArray<AnimationUpdateItem> m_UpdateItems;
 };
 REFLECT_CLASS(AnimationModule, IModule)
 END_REFLECT_CLASS(AnimationModule)
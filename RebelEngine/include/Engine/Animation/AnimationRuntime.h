@@ -4,8 +4,6 @@
 #include <cassert>
 #include <cfloat>
 #include <cmath>
-#include <functional>
-#include <vector>
 
 #include "Engine/Animation/AnimationAsset.h"
 #include "Engine/Animation/SkeletonAsset.h"
@@ -188,38 +186,36 @@ inline void BuildGlobalPose(const SkeletonAsset* skeleton, const TArray<Mat4>& l
 
     outGlobalPose.Resize(boneCount);
 
-    std::vector<uint8> state(static_cast<size_t>(boneCount), 0);
+    const Mat4* local = localPose.Data();
+    Mat4* global = outGlobalPose.Data();
 
-    std::function<void(int32)> resolveBone = [&](int32 boneIndex)
+    const TArray<int32>& order = skeleton->GetEvaluationOrder();
+    if (order.Num() == boneCount)
     {
-        if (state[boneIndex] == 2)
-            return;
-
-        if (state[boneIndex] == 1)
+        // Parents always precede their children in the evaluation order.
+        const int32* parents = skeleton->GetEvaluationParents().Data();
+        for (int32 k = 0; k < boneCount; ++k)
         {
-            outGlobalPose[boneIndex] = localPose[boneIndex];
-            state[boneIndex] = 2;
-            return;
+            const int32 bone = order[k];
+            const int32 parent = parents[k];
+            global[bone] = parent >= 0 ? global[parent] * local[bone] : local[bone];
         }
+        return;
+    }
 
-        state[boneIndex] = 1;
-
-        const int32 parent = skeleton->m_Parent[boneIndex];
-        if (parent >= 0 && parent < boneCount)
-        {
-            resolveBone(parent);
-            outGlobalPose[boneIndex] = outGlobalPose[parent] * localPose[boneIndex];
-        }
-        else
+    // Skeleton edited in place since its last BuildBindPoseCache(): walk each
+    // bone's parent chain. Bounded by boneCount so a cycle cannot hang.
+    for (int32 i = 0; i < boneCount; ++i)
+    {
+        Mat4 result = local[i];
+        int32 parent = skeleton->m_Parent[i];
+        for (int32 depth = 0; depth < boneCount && parent >= 0 && parent < boneCount && parent != i; ++depth)
         {
-            outGlobalPose[boneIndex] = localPose[boneIndex];
+            result = local[parent] * result;
+            parent = skeleton->m_Parent[parent];
         }
-
-        state[boneIndex] = 2;
-    };
-
-    for (int32 i = 0; i < boneCount; ++i)
-        resolveBone(i);
+        global[i] = result;
+    }
 }
 
 inline Mat4 SampleRootDriverDelta(const AnimationRootDriverData& rootDriver, float sampleTime)
@@ -11,6 +11,12 @@ struct SkeletalMeshAsset : Asset
     void Serialize(BinaryWriter& ar) override;
     void Deserialize(BinaryReader& ar) override;
     void PostLoad() override;
+    void DetachSourceViews() override;
+    MemSize GetMemorySize() const override;
+    bool CanEvict() const override { return !Handle.isValid(); } // see MeshAsset::CanEvict
+
+    // Rebuilds Bounds and BoneBounds from Vertices; called from PostLoad.
+    void ComputeBounds();
 
     AssetDisplayColor GetDisplayColor() const override { return GetStaticDisplayColor(); }
 
@@ -23,6 +29,11 @@ struct SkeletalMeshAsset : Asset
     TArray<uint32> Indices;
     MeshHandle Handle;
     AssetPtr<SkeletonAsset>     m_Skeleton;
+
+    // Bind-pose bounds and per-bone boxes for the animated bound
+    // (see SkinnedBounds). Derived on load, not serialized.
+    BoxSphereBounds Bounds;
+    TArray<BoxSphereBounds> BoneBounds;
 private:
     
 };
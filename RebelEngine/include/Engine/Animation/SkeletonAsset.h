@@ -14,6 +14,29 @@ struct SkeletonAsset : Asset
     void Serialize(BinaryWriter& ar) override;
     void Deserialize(BinaryReader& ar) override;
     void PostLoad() override;
+    void DetachSourceViews() override;
+    MemSize GetMemorySize() const override;
+
+    // Bind poses and the evaluation order never change for a loaded skeleton,
+    // so they are built once here (PostLoad) instead of per component per
+    // frame. Call again after editing m_Parent/m_InvBind in place.
+    bool BuildBindPoseCache();
+    bool HasBindPoseCache() const
+    {
+        return !m_LocalBindPose.IsEmpty() && m_LocalBindPose.Num() == m_InvBind.Num() &&
+               m_EvaluationOrder.Num() == m_Parent.Num();
+    }
+
+    // Bone indices ordered so every parent precedes its children, and the
+    // parent of each entry (-1 for roots). Imported skeletons are already
+    // depth-first, in which case the order is the identity.
+    const TArray<int32>& GetEvaluationOrder() const { return m_EvaluationOrder; }
+    const TArray<int32>& GetEvaluationParents() const { return m_EvaluationParents; }
+
+    const TArray<Mat4>& GetLocalBindPose() const { return m_LocalBindPose; }
+    const TArray<Mat4>& GetGlobalBindPose() const { return m_GlobalBindPose; }
+    // globalBind * invBind per bone; used to draw meshes that have no pose yet.
+    const TArray<Mat4>& GetBindSkinPalette() const { return m_BindSkinPalette; }
 
     AssetDisplayColor GetDisplayColor() const override { return GetStaticDisplayColor(); }
 
@@ -26,6 +49,14 @@ struct SkeletonAsset : Asset
     TArray<Mat4>    m_InvBind;
     TArray<String>  m_BoneNames;
 private:
+    void BuildEvaluationOrder();
+
+    // Runtime-only, derived from m_Parent/m_InvBind.
+    TArray<int32>   m_EvaluationOrder;
+    TArray<int32>   m_EvaluationParents;
+    TArray<Mat4>    m_LocalBindPose;
+    TArray<Mat4>    m_GlobalBindPose;
+    TArray<Mat4>    m_BindSkinPalette;
 
 };
 REFLECT_CLASS(SkeletonAsset, Asset)
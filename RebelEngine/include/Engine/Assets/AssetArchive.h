@@ -0,0 +1,87 @@
+#pragma once
+#include "BaseAsset.h"
+
+// Packed asset archive (.rpak): the cooked form of a set of loose .rasset
+// files, so a shipped build opens one file instead of one per asset.
+//
+// Layout:
+//   AssetArchiveHeader
+//   entry blobs    - each .rasset copied verbatim (header + payload), 16-byte aligned
+//   TOC            - AssetArchiveEntry[EntryCount], sorted by AssetID
+//   path strings   - asset paths without extension, referenced by the TOC
+//   source roots   - RootCount x (uint32 length + chars): the asset roots
+//                    the archive was cooked from
+struct AssetArchiveHeader
+{
+	// 'RPAK' = Rebel PAcK
+	static constexpr uint32 MagicValue = 0x4B415052;
+	static constexpr uint32 CurrentVersion = 2;
+
+	uint32 Magic = MagicValue;
+	uint32 Version = CurrentVersion;
+	uint32 EntryCount = 0;
+	uint32 RootCount = 0;
+	uint64 TocOffset = 0;
+	uint64 StringsOffset = 0;
+	uint64 RootsOffset = 0;
+};
+
+struct AssetArchiveEntry
+{
+	uint64 AssetID = 0;
+	uint64 TypeHash = 0;
+
+	// Blob range within the archive
+	uint64 Offset = 0;
+	uint64 Size = 0;
+
+	// Reserved for per-entry options (compression, ...); cooked as zero.
+	uint32 Flags = 0;
+	uint32 PathLength = 0;
+	uint64 PathOffset = 0;
+};
+
+class AssetArchive
+{
+public:
+	static constexpr const char* DefaultPath = "Assets.rpak";
+
+	// Packs the loose assets at assetPaths (without the .rasset extension)
+	// into a new archive at archivePath. IDs and type hashes come from each
+	// file's AssetFileHeader. sourceRoots names the directories the paths
+	// were gathered from (see CoversRoot). The archive is written next to the
+	// target and only moved into place once complete, so a failed cook leaves
+	// any previous archive untouched.
+	static bool Cook(const String& archivePath, const TArray<String>& assetPaths,
+		const TArray<String>& sourceRoots = {});
+
+	// Maps the archive and validates its header, TOC and every entry's blob
+	// and path range; a corrupt archive is rejected here rather than at load.
+	// The TOC is used in place; nothing is read per entry until that asset
+	// is loaded.
+	bool Open(const String& archivePath);
+	void Close();
+	bool IsOpen() const { return (bool)m_Mapping; }
+
+	uint32 GetEntryCount() const { return m_EntryCount; }
+	const AssetArchiveEntry& GetEntry(uint32 index) const { return m_Toc[index]; }
+	String GetEntryPath(const AssetArchiveEntry& entry) const;
+
+	// Binary search over the sorted TOC.
+	const AssetArchiveEntry* Find(AssetHandle id) const;
+
+	// True if root (a generic path) was one of the cook's source roots, so
+	// every asset under it is already packed.
+	bool CoversRoot(const String& root) const;
+	const TArray<String>& GetSourceRoots() const { return m_SourceRoots; }
+
+	// Assets loaded from the archive keep this alive (see AssetMeta::Archive).
+	const RSharedPtr<MappedFile>& GetMapping() const { return m_Mapping; }
+
+private:
+	RSharedPtr<MappedFile> m_Mapping;
+	const AssetArchiveEntry* m_Toc = nullptr;
+	uint32 m_EntryCount = 0;
+	uint64 m_StringsOffset = 0;
+	TArray<String> m_SourceRoots;
+};
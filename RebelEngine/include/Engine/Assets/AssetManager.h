@@ -5,12 +5,95 @@
 #include "AssetRegistry.h"
 //#include "Engine/Assets/AssetPtr.h"
 
-class AssetManager
+#include "Core/MultiThreading/JobSystem.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+enum class EAssetLoadPriority : uint8
+{
+	Low,
+	Normal,
+	High
+};
+
+// Called on the game thread once an async load finished; nullptr on failure.
+using AssetLoadCallback = std::function<void(Asset*)>;
+
+// Shared state of one LoadAsync request. Everyone asking for the same asset
+// while it is in flight holds the same request.
+class AssetLoadRequest
+{
+public:
+	enum class EState : uint8
+	{
+		Queued,   // waiting for a worker
+		Loading,  // being deserialized
+		Loaded,   // deserialized, waiting for PostLoad on the game thread
+		Ready,
+		Failed
+	};
+
+	AssetHandle GetID() const { return m_ID; }
+	EAssetLoadPriority GetPriority() const { return m_Priority; }
+	EState GetState() const { return m_State.load(std::memory_order_acquire); }
+	bool IsReady() const { return GetState() == EState::Ready; }
+	bool IsDone() const { return GetState() == EState::Ready || GetState() == EState::Failed; }
+
+	// The loaded asset once IsReady(), nullptr before that.
+	Asset* GetAsset() const { return IsReady() ? m_Asset : nullptr; }
+
+private:
+	friend class AssetManager;
+
+	AssetHandle m_ID;
+	AssetMeta m_Meta; // registry entry when queued; workers never read the registry
+	EAssetLoadPriority m_Priority = EAssetLoadPriority::Normal;
+	uint64 m_Sequence = 0; // FIFO within a priority
+	std::atomic<EState> m_State{EState::Queued};
+	Asset* m_Asset = nullptr;
+	RUniquePtr<Asset> m_Staged;
+	std::vector<AssetLoadCallback> m_Callbacks;
+};
+
+using AssetLoadHandle = RSharedPtr<AssetLoadRequest>;
+
+// Resident bytes of one asset type, summed from Asset::GetMemorySize.
+struct AssetTypeMemory
+{
+	const Rebel::Core::Reflection::TypeInfo* Type = nullptr;
+	uint32 Count = 0;
+	MemSize Bytes = 0;
+};
+
+struct AssetMemoryReport
+{
+	MemSize TotalBytes = 0;
+	MemSize BudgetBytes = 0; // 0 = unlimited
+	TArray<AssetTypeMemory> Types; // largest first
+};
+
+// Loads and owns assets. Lookups and loads may come from job threads (the
+// animation evaluate phase resolves clips there), so every entry point takes
+// m_Mutex. It is recursive because PostLoad may load dependencies.
+//
+// Once registered with AssetPtrBase::SetReferenceTracker, every AssetPtr
+// holding a handle keeps that asset referenced. With a memory budget set,
+// EnforceMemoryBudget evicts the least recently used unreferenced assets
+// until the resident size fits again. Only assets loaded from disk are
+// evicted, and only while Asset::CanEvict agrees; they come back on the next
+// Load. Anything that keeps a raw pointer across frames (asset editors, say)
+// has to hold an AssetPtr as well.
+class AssetManager : public IAssetReferenceTracker
 {
 public:
 	AssetManager(AssetRegistry& registry)
 		: m_Registry(registry) {}
 
+	~AssetManager() override;
+
 	template<typename T>
 	T* Create()
 	{
@@ -22,14 +105,13 @@ public:
 
 		Asset* raw = static_cast<Asset*>(type->CreateInstance());
 
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
 		//raw->ID   = AssetHandle::New();
 		raw->Path = "Assets/" /*+ type->Name*/;
 
-		// Own it
-		m_AssetStorage.Add(RUniquePtr<Asset>(raw));
-
-		// Index it
-		m_LoadedAssets[raw->ID] = raw;
+		// Built in memory, so there is no file to reload it from.
+		StoreAsset(raw, false);
 
 		return static_cast<T*>(raw);
 	}
@@ -63,92 +145,169 @@ public:
 
 
 
-	Asset* Load(AssetHandle id)
-	{
-		if (Asset** ptr = m_LoadedAssets.Find(id))
-			return *ptr;
-
-		const AssetMeta* meta = m_Registry.Get(id);
-		if (!meta || !meta->Type || !meta->Type->CreateInstance)
-			return nullptr;
-
-		PROFILE_SCOPE("Asset loaded '" + meta->Path+"'")
-		Asset* raw = static_cast<Asset*>(meta->Type->CreateInstance());
-		raw->ID   = meta->ID;
-		raw->Path = meta->Path;
+	// Loads synchronously. An asset that is already in flight through
+	// LoadAsync is finished here instead, and that request completes with it.
+	Asset* Load(AssetHandle id);
 
-		// OPEN THE REAL FILE
-		String fullPath = meta->Path + ".rasset";
-		FileStream fs(fullPath.c_str(), "rb");
-		BinaryReader ar(fs);
+	// Queues the asset for deserialization on the job system. PostLoad runs on
+	// the game thread in FinalizeAsyncLoads, after which the request is ready
+	// and onLoaded is called (with nullptr if the load failed). Requests for
+	// an asset already in flight share one request; an already loaded asset
+	// returns a ready request and calls onLoaded right away.
+	AssetLoadHandle LoadAsync(
+		AssetHandle id,
+		EAssetLoadPriority priority = EAssetLoadPriority::Normal,
+		AssetLoadCallback onLoaded = {});
 
-		// READ HEADER
-		AssetFileHeader header;
-		ar.Read(header);
+	// Non-blocking lookup for per-frame callers: the asset if it is loaded,
+	// otherwise nullptr after making sure a LoadAsync is in flight.
+	Asset* GetOrLoadAsync(AssetHandle id, EAssetLoadPriority priority = EAssetLoadPriority::Normal);
 
-		assert(header.Magic == AssetFileHeader::MagicValue);
-		assert(header.AssetID == (uint64)meta->ID);
-		raw->SerializedVersion = header.Version;
+	// Runs PostLoad for deserialized requests, highest priority first, until
+	// budgetMs is used up (at least one per call). Game thread only. Returns
+	// the number of requests completed.
+	uint32 FinalizeAsyncLoads(float budgetMs);
 
-		// SEEK TO PAYLOAD
-		ar.Seek(header.PayloadOffset);
+	// Blocks until every request is finalized. Game thread only.
+	void FlushAsyncLoads();
 
-		// NOW read the real asset
-		raw->Deserialize(ar);
-		raw->PostLoad();
-
-		m_AssetStorage.Add(RUniquePtr<Asset>(raw));
-		m_LoadedAssets[id] = raw;
-
-		return raw;
+	uint32 GetAsyncLoadCount() const
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		return static_cast<uint32>(m_AsyncRequests.Num());
 	}
 
-	
-
 	Asset* Get(AssetHandle id)
 	{
-		if (Asset** ptr = m_LoadedAssets.Find(id))
-			return *ptr;
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		if (uint32* slot = m_LoadedAssets.Find(id))
+			return TouchSlot(*slot);
 		return nullptr;
 	}
 	bool IsLoaded(AssetHandle id) const
 	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 		return m_LoadedAssets.Find(id) != nullptr;
 	}
 
 
+	// Destroys the asset now, whether or not it is still referenced.
 	void Unload(AssetHandle id)
 	{
-		Asset** ptr = m_LoadedAssets.Find(id);
-		if (!ptr)
-			return;
-
-		Asset* asset = *ptr;
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		if (uint32* slot = m_LoadedAssets.Find(id))
+			FreeSlot(*slot);
+	}
 
-		// 1) Remove from lookup map
-		m_LoadedAssets.Remove(id);
 
-		// 2) Find and remove owning UniquePtr
-		for (int i = 0; i < m_AssetStorage.Num(); ++i)
+	// See Asset::ReleaseSourceMapping; used before the files or archive the
+	// loaded assets were mapped from get replaced.
+	void ReleaseSourceMappings()
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		for (AssetSlot& slot : m_Slots)
 		{
-			if (m_AssetStorage[i].Get() == asset)
-			{
-				m_AssetStorage.RemoveAt(i);   // UniquePtr destructor runs â†’ deletes Asset
-				return;
-			}
+			if (slot.Instance)
+				slot.Instance->ReleaseSourceMapping();
 		}
 	}
 
+	void Clear();
 
-	void Clear()
+	// IAssetReferenceTracker
+	void AddAssetReference(AssetHandle handle) override;
+	void ReleaseAssetReference(AssetHandle handle) override;
+
+	// Number of AssetPtrs currently holding id.
+	uint32 GetReferenceCount(AssetHandle id) const
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		const uint32* count = m_ReferenceCounts.Find(id);
+		return count ? *count : 0;
+	}
+
+	// 0 disables eviction.
+	void SetMemoryBudget(MemSize bytes)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		m_MemoryBudget = bytes;
+	}
+	MemSize GetMemoryBudget() const
 	{
-		m_LoadedAssets.Clear();
-		m_AssetStorage.Clear();
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		return m_MemoryBudget;
 	}
 
+	// Remeasures every loaded asset and reports the totals per type.
+	AssetMemoryReport GetResidentBytes();
+
+	// Evicts unreferenced assets, least recently used first, until the
+	// resident size is within budget. Raw pointers from Get/Load to assets no
+	// AssetPtr holds are invalid afterwards, so this runs between frames
+	// (AssetManagerModule::Tick). Returns the number of assets evicted.
+	uint32 EnforceMemoryBudget();
+
 private:
+	struct AssetSlot
+	{
+		RUniquePtr<Asset> Instance; // null while on the free list
+		MemSize Bytes = 0;          // GetMemorySize when last measured
+		uint64 LastUsed = 0;
+		bool bEvictable = false;
+	};
+
+	// Takes ownership of raw in a free slot. Caller holds m_Mutex.
+	void StoreAsset(Asset* raw, bool bEvictable);
+	void FreeSlot(uint32 slot);
+	Asset* TouchSlot(uint32 slot)
+	{
+		AssetSlot& entry = m_Slots[slot];
+		entry.LastUsed = ++m_UseCounter;
+		return entry.Instance.Get();
+	}
+	void RemeasureSlots();
+
+	// Creates and deserializes the asset from its file or archive blob. No
+	// shared state is touched, so it runs on workers without m_Mutex.
+	static Asset* DeserializeAsset(const AssetMeta& meta);
+
+	// PostLoad + take ownership. Caller holds m_Mutex.
+	void AddLoadedAsset(Asset* raw);
+
+	// Marks the request done with asset (nullptr = failed) and hands back its
+	// callbacks, to be called once m_Mutex is released. Caller holds m_Mutex.
+	std::vector<AssetLoadCallback> CompleteAsyncLoad(const AssetLoadHandle& request, Asset* asset);
+
+	// Index of the highest priority, oldest request in requests.
+	static MemSize FindNextAsyncLoad(const std::vector<AssetLoadHandle>& requests);
+
+	// Job body: claims the highest priority queued request and deserializes it.
+	void ProcessNextAsyncLoad();
+
+	// Drops every request that has not been finalized; their callbacks are
+	// not called. Waits for deserializations already running.
+	void CancelAsyncLoads();
+
 	AssetRegistry& m_Registry;
-	TArray<Rebel::Core::Memory::UniquePtr<Asset>> m_AssetStorage;
-	TMap<AssetHandle, Asset*> m_LoadedAssets;
+
+	// Slot map: assets live in m_Slots, freed slots are reused through
+	// m_FreeSlots, and m_LoadedAssets maps each handle to its slot.
+	TArray<AssetSlot> m_Slots;
+	TArray<uint32> m_FreeSlots;
+	TMap<AssetHandle, uint32> m_LoadedAssets;
+	mutable std::recursive_mutex m_Mutex;
+
+	// AssetPtr holders per handle, loaded or not.
+	TMap<AssetHandle, uint32> m_ReferenceCounts;
+	MemSize m_ResidentBytes = 0;
+	MemSize m_MemoryBudget = 0;
+	uint64 m_UseCounter = 0;
+
+	// Async loading; all guarded by m_Mutex.
+	TMap<AssetHandle, AssetLoadHandle> m_AsyncRequests; // every unfinished request, by asset
+	std::vector<AssetLoadHandle> m_AsyncQueue;          // waiting for a worker
+	std::vector<AssetLoadHandle> m_AsyncLoaded;         // deserialized, waiting for FinalizeAsyncLoads
+	uint64 m_AsyncSequence = 0;
+	Rebel::Core::Threading::JobCounter m_AsyncJobs;
 };
 
@@ -1,8 +1,10 @@
 #pragma once
 #include <filesystem>
 
+#include "AssetArchive.h"
 #include "AssetFileHeader.h"
 #include "AssetManager.h"
+#include "AssetRegistryCache.h"
 
 class AssetManagerModule : public IModule
 {
@@ -23,16 +25,51 @@ public:
 
 	void Init() override
 	{
+		// Every AssetPtr from here on keeps its asset from being evicted.
+		AssetPtrBase::SetReferenceTracker(&m_Manager);
 		RescanAssets();
 	}
 
-	void Tick(float) override {}
+	// Finishes async loads (PostLoad + callbacks) within a per-frame budget,
+	// so a burst of streamed assets does not stall a single frame, then
+	// evicts unreferenced assets if the memory budget is exceeded.
+	void Tick(float) override
+	{
+		m_Manager.FinalizeAsyncLoads(m_AsyncFinalizeBudgetMs);
+		m_Manager.EnforceMemoryBudget();
+	}
+
 	void Shutdown() override
 	{
+		if (AssetPtrBase::GetReferenceTracker() == &m_Manager)
+			AssetPtrBase::SetReferenceTracker(nullptr);
 		m_Manager.Clear();
 		m_Registry.Clear();
+		m_Archive.Close();
 	}
 
+	// Packs every loose .rasset under the asset roots into an archive that
+	// ScanDirectory mounts on the next scan. The archive records those roots,
+	// and later scans skip them: their assets resolve from the archive.
+	bool CookArchive(const String& archivePath = AssetArchive::DefaultPath);
+
+	const AssetArchive& GetArchive() const { return m_Archive; }
+
+	// Also walks roots the mounted archive covers, so loose files there keep
+	// overriding their packed copies (the editor, which edits after a cook).
+	// Rescans if an archive is mounted.
+	void SetScanArchivedRoots(bool bEnabled);
+	bool IsScanningArchivedRoots() const { return m_bScanArchivedRoots; }
+
+	// Loose-file scans reuse headers from AssetRegistryCache::DefaultPath for
+	// files whose size and write time did not change. Disabling it makes
+	// every scan open every file, as before.
+	void SetRegistryCacheEnabled(bool bEnabled);
+	bool IsRegistryCacheEnabled() const { return m_bUseRegistryCache; }
+
+	void SetAsyncFinalizeBudget(float budgetMs) { m_AsyncFinalizeBudgetMs = budgetMs; }
+	float GetAsyncFinalizeBudget() const { return m_AsyncFinalizeBudgetMs; }
+
 	template<typename TAsset>
 	bool SaveAssetToFile(const String& filePath, TAsset& asset)
 	{
@@ -51,6 +88,12 @@ public:
 		noExtPath.replace_extension();
 		asset.Path = String(noExtPath.generic_string().c_str());
 
+		// A mapped source cannot be truncated under its borrowers (Windows
+		// refuses the open outright), so whoever maps it lets go first.
+		asset.ReleaseSourceMapping();
+		if (Asset* loaded = m_Manager.Get(asset.ID))
+			loaded->ReleaseSourceMapping();
+
 		FileStream fs(outputPath.string().c_str(), "wb");
 		if (!fs.IsOpen())
 			return false;
@@ -101,11 +144,21 @@ public:
 
 private:
 	void ScanDirectory(); // fills registry only
+	void MountArchive();
+	void ScanLooseFiles();
 
 private:
 
 	AssetRegistry m_Registry;
 	AssetManager  m_Manager;
+	AssetArchive  m_Archive;
+
+	AssetRegistryCache m_RegistryCache;
+	bool m_bUseRegistryCache = true;
+	bool m_bRegistryCacheLoaded = false;
+	bool m_bScanArchivedRoots = false;
+
+	float m_AsyncFinalizeBudgetMs = 2.0f;
 };
 REFLECT_CLASS(AssetManagerModule, IModule)
 END_REFLECT_CLASS(AssetManagerModule)
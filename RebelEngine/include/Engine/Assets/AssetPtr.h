@@ -10,7 +10,7 @@ public:
 	AssetPtr() = default;
 	AssetPtr(AssetHandle h)
 	{
-		Handle = h;
+		SetHandle(h);
 	}
 
 	T* Get() const
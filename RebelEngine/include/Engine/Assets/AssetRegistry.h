@@ -2,22 +2,44 @@
 #pragma once
 #include "BaseAsset.h"
 
+#include <mutex>
+
+class AssetArchive;
+
 DEFINE_LOG_CATEGORY(AssetRegistryLog)
 
+// Where every asset lives. Loose files are registered one by one by the
+// directory scan; packed assets are not copied in at mount time but resolved
+// through the mounted archive's sorted TOC on first lookup. A loose entry
+// wins over a packed one with the same ID.
 class AssetRegistry
 {
 public:
 	void Register(const AssetMeta& meta)
 	{
 		m_Registry[meta.ID] = meta;
-		RB_LOG(AssetRegistryLog,info,"Asset found | ID={} | Type={} | Path={}",(uint64)meta.ID,meta.Type->Name,meta.Path)
+		RB_LOG(AssetRegistryLog,trace,"Asset found | ID={} | Type={} | Path={}",(uint64)meta.ID,meta.Type->Name,meta.Path)
 	}
 
+	// The archive must stay open until it is unmounted or the registry is
+	// cleared.
+	void MountArchive(const AssetArchive* archive)
+	{
+		std::lock_guard<std::mutex> lock(m_PackedMutex);
+		m_Archive = archive;
+		m_Packed.Clear();
+	}
+	const AssetArchive* GetMountedArchive() const { return m_Archive; }
+
+	// Returned pointers stay valid until the next Clear or MountArchive.
 	const AssetMeta* Get(AssetHandle id) const
 	{
-		return m_Registry.Find(id);   // returns AssetMeta* or nullptr
+		if (const AssetMeta* loose = m_Registry.Find(id))
+			return loose;
+		return m_Archive ? FindPacked(id) : nullptr;
 	}
 
+	// Loose assets only; packed ones are reached through Get.
 	const TMap<AssetHandle, AssetMeta>& GetAll() const
 	{
 		return m_Registry;
@@ -26,8 +48,17 @@ public:
 	void Clear()
 	{
 		m_Registry.Clear();
+		MountArchive(nullptr);
 	}
 
 private:
+	const AssetMeta* FindPacked(AssetHandle id) const;
+
 	TMap<AssetHandle, AssetMeta> m_Registry;
+
+	// Packed entries resolved so far. Boxed so the metas handed out do not
+	// move when the map grows.
+	const AssetArchive* m_Archive = nullptr;
+	mutable TMap<AssetHandle, RUniquePtr<AssetMeta>> m_Packed;
+	mutable std::mutex m_PackedMutex;
 };
@@ -0,0 +1,41 @@
+#pragma once
+#include "BaseAsset.h"
+
+// Header fields of every loose .rasset seen by the last scan, keyed by file
+// path and validated by size and last write time. A rescan only opens files
+// whose size or write time changed; everything else comes from here, so the
+// registry it produces matches a full header scan.
+class AssetRegistryCache
+{
+public:
+	static constexpr const char* DefaultPath = "AssetRegistry.cache";
+
+	struct Entry
+	{
+		uint64 FileSize = 0;
+		int64  WriteTime = 0;
+
+		uint64 AssetID = 0;
+		uint64 TypeHash = 0;
+		uint32 Version = 0;
+
+		// False for files whose header is not a valid asset header; they are
+		// remembered too, so they are not reopened every scan either.
+		bool   bValidHeader = false;
+	};
+
+	// Replaces the contents with the cache file at path. A missing, stale or
+	// corrupt file leaves the cache empty, which just means a full scan.
+	bool Load(const String& path);
+	bool Save(const String& path) const;
+
+	// The cached entry for filePath if its size and write time still match.
+	const Entry* Find(const String& filePath, uint64 fileSize, int64 writeTime) const;
+	void Store(const String& filePath, const Entry& entry);
+
+	MemSize Num() const { return m_Entries.Num(); }
+	void Clear() { m_Entries.Clear(); }
+
+private:
+	TMap<String, Entry> m_Entries;
+};
@@ -18,6 +18,11 @@ struct AssetMeta
 	String     Path;
 	uint64     FileSize;
 	AssetLoadState State = AssetLoadState::Unloaded;
+
+	// Set for assets packed in a mounted AssetArchive: Load reads FileSize
+	// bytes at ArchiveOffset of this mapping instead of Path + ".rasset".
+	RSharedPtr<MappedFile> Archive;
+	uint64     ArchiveOffset = 0;
 };
 
 struct AssetDisplayColor
@@ -43,10 +48,40 @@ public:
 	virtual void PostLoad() {}
 	virtual AssetDisplayColor GetDisplayColor() const { return GetStaticDisplayColor(); }
 
+	// Bytes the asset keeps resident, counted against AssetManager's memory
+	// budget. Assets holding arrays add their allocated size on top.
+	virtual MemSize GetMemorySize() const
+	{
+		const Rebel::Core::Reflection::TypeInfo* type = GetType();
+		return (type ? type->Size : sizeof(Asset)) + Path.length();
+	}
+
+	// False while something outside the AssetManager holds on to this
+	// instance's data; EnforceMemoryBudget leaves such assets resident.
+	virtual bool CanEvict() const { return true; }
+
+	// Copies arrays still borrowing from the mapped source file into owned
+	// memory and drops the mapping. Needed before that file is overwritten.
+	void ReleaseSourceMapping()
+	{
+		if (!SourceMapping)
+			return;
+		DetachSourceViews();
+		SourceMapping.Reset();
+	}
+
+	// Set by AssetManager::Load when Deserialize adopted views into the file
+	// mapping (see MappedFileStream); keeps those views valid.
+	RSharedPtr<MappedFile> SourceMapping;
+
 	static constexpr AssetDisplayColor GetStaticDisplayColor()
 	{
 		return { 255, 255, 255, 255 };
 	}
+
+protected:
+	// Assets whose Deserialize reads raw arrays call DetachView on each.
+	virtual void DetachSourceViews() {}
 };
 REFLECT_CLASS(Asset, void)
 	REFLECT_PROPERTY(Asset,ID, Rebel::Core::Reflection::EPropertyFlags::VisibleInEditor);
@@ -1,5 +1,6 @@
 #pragma once
 #include "BaseAsset.h"
+#include "Engine/Rendering/Bounds.h"
 
 struct MeshAsset : Asset
 {
@@ -8,12 +9,25 @@ struct MeshAsset : Asset
 	TArray<uint32> Indices;
 	MeshHandle Handle;
 
+	// Mesh-space bounds, rebuilt from Vertices on load (not serialized).
+	BoxSphereBounds Bounds;
+
 	void Serialize(BinaryWriter& ar) override;
 
 	void Deserialize(BinaryReader& ar) override;
 
 	void PostLoad() override;
 
+	void DetachSourceViews() override;
+
+	MemSize GetMemorySize() const override;
+
+	// The renderer's static mesh buffers cannot release a mesh, so an
+	// uploaded asset stays resident rather than uploading again on reload.
+	bool CanEvict() const override { return !Handle.isValid(); }
+
+	void ComputeBounds();
+
 	AssetDisplayColor GetDisplayColor() const override { return GetStaticDisplayColor(); }
 
 	static constexpr AssetDisplayColor GetStaticDisplayColor()
@@ -9,6 +9,11 @@ struct PrefabAsset : Asset
     void Serialize(BinaryWriter& ar) override;
     void Deserialize(BinaryReader& ar) override;
 
+    MemSize GetMemorySize() const override
+    {
+        return Asset::GetMemorySize() + m_ActorTypeName.length() + m_TemplateYaml.length();
+    }
+
     AssetDisplayColor GetDisplayColor() const override { return GetStaticDisplayColor(); }
 
     static constexpr AssetDisplayColor GetStaticDisplayColor()
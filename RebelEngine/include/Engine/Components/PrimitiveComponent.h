@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "Core/AssetPtrBase.h"
+#include "Core/Delegate.h"
 #include "Engine/Components/SceneComponent.h"
 #include "Engine/Physics/Trace.h"
 
@@ -7,7 +9,10 @@ enum class EPhysicsShapeType
 {
     Box,
     Sphere,
-    Capsule
+    Capsule,
+    ConvexHull,   // hull of a MeshAsset's vertices
+    TriangleMesh, // a MeshAsset's triangles, static bodies only
+    None          // no body
 };
 
 struct PhysicsShape
@@ -17,6 +22,7 @@ struct PhysicsShape
     Vector3 HalfExtent;
     float Radius;
     float HalfHeight;
+    AssetHandle Mesh = AssetHandle(0); // ConvexHull and TriangleMesh
 
     static PhysicsShape MakeBox(const Vector3& halfExtent)
     {
@@ -42,6 +48,21 @@ struct PhysicsShape
         s.HalfHeight = halfHeight;
         return s;
     }
+
+    static PhysicsShape MakeMesh(EPhysicsShapeType type, AssetHandle mesh)
+    {
+        PhysicsShape s{};
+        s.Type = type;
+        s.Mesh = mesh;
+        return s;
+    }
+
+    static PhysicsShape MakeNone()
+    {
+        PhysicsShape s{};
+        s.Type = EPhysicsShapeType::None;
+        return s;
+    }
 };
 
 using PhysicsBodyHandle = uint32;
@@ -59,12 +80,44 @@ REFLECT_ENUM(ERBBodyType)
     ENUM_OPTION(Kinematic)
 END_ENUM(ERBBodyType)
 
+struct PrimitiveComponent;
+
+enum class EContactPhase : uint8
+{
+    Begin,
+    Persist,
+    End
+};
+
+// A contact between two bodies as seen by one of them. Fired after the
+// physics step on the game thread.
+struct PrimitiveContact
+{
+    PrimitiveComponent* Other = nullptr; // null when the other body is already gone
+    EntityID OtherActor = entt::null;
+    Vector3 Position{0.0f};
+    Vector3 Normal{0.0f, 0.0f, 1.0f}; // from this body toward the other
+    EContactPhase Phase = EContactPhase::Begin;
+};
+
+DECLARE_MULTICAST_DELEGATE(FPrimitiveContactDelegate, PrimitiveComponent&, const PrimitiveContact&)
+
 struct PrimitiveComponent : SceneComponent
 {
     ERBBodyType BodyType = ERBBodyType::Dynamic;
     CollisionChannel ObjectChannel = CollisionChannel::Any;
     Bool bIsTrigger = false;
 
+    // Solid bodies only report contacts through OnHit when asked to; triggers
+    // always report overlaps, to both sides. Which pairs can touch at all is
+    // up to the physics system's collision response matrix. Read when the
+    // body is created.
+    Bool bGenerateHitEvents = false;
+
+    FPrimitiveContactDelegate OnHit;          // Begin, Persist (while awake), End
+    FPrimitiveContactDelegate OnBeginOverlap;
+    FPrimitiveContactDelegate OnEndOverlap;
+
     virtual PhysicsShape CreatePhysicsShape() const = 0;
 
 private:
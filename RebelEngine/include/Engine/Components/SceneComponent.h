@@ -5,6 +5,7 @@
 #include <cmath>
 
 #include "Engine/Components/IdentityComponents.h"
+#include "Engine/Scene/TransformHierarchy.h"
 
 struct SceneComponent : TagComponent
 {
@@ -18,11 +19,44 @@ private:
     glm::quat m_RotationQuat{ 1.0f, 0.0f, 0.0f, 0.0f };
 
     SceneComponent* m_Parent = nullptr;
+    TArray<SceneComponent*> m_Children;
     entt::registry* m_SceneRegistry = nullptr;
+
+    // Entry in the owning Scene's TransformHierarchy, which holds the local TRS
+    // copy and the cached world transform. Components outside a scene have no
+    // entry and resolve their world transform on demand.
+    TransformHierarchy* m_Transforms = nullptr;
+    uint32 m_TransformId = TransformHierarchy::kInvalidId;
+
+    // World-space correction applied on top of the world transform when this
+    // component and its children are drawn. Gameplay never sees it.
+    Mat4 m_RenderOffset{1.0f};
+    Bool m_bHasRenderOffset = false;
+
 public:
 
     SceneComponent() = default;
-    SceneComponent(const SceneComponent&) = default;
+
+    // Copies local transform only; hierarchy links and the store entry belong to the source.
+    SceneComponent(const SceneComponent& other)
+        : TagComponent(other)
+        , m_Position(other.m_Position)
+        , Rotation(other.Rotation)
+        , Scale(other.Scale)
+        , m_RotationQuat(other.m_RotationQuat)
+        , m_SceneRegistry(other.m_SceneRegistry)
+    {
+    }
+
+    ~SceneComponent() override
+    {
+        SetParentInternal(nullptr);
+
+        while (!m_Children.IsEmpty())
+            m_Children.Back()->SetParentInternal(nullptr);
+
+        BindTransformHierarchy(nullptr);
+    }
 
     SceneComponent(const Vector3& position)
         : m_Position(position)
@@ -52,6 +86,9 @@ public:
 
     Vector3 GetWorldPosition() const
     {
+        if (ReadsFromTransformHierarchy())
+            return m_Transforms->GetWorldPosition(m_TransformId);
+
         if (!m_Parent)
             return m_Position;
 
@@ -61,6 +98,9 @@ public:
 
     glm::quat GetWorldRotationQuat() const
     {
+        if (ReadsFromTransformHierarchy())
+            return m_Transforms->GetWorldRotation(m_TransformId);
+
         if (m_Parent == nullptr)
             return m_RotationQuat;
 
@@ -72,6 +112,78 @@ public:
         return m_Parent;
     }
 
+    const TArray<SceneComponent*>& GetChildren() const
+    {
+        return m_Children;
+    }
+
+    bool IsWorldTransformDirty() const
+    {
+        return !m_Transforms || m_Transforms->IsDirty(m_TransformId);
+    }
+
+    TransformHierarchy* GetTransformHierarchy() const
+    {
+        return m_Transforms;
+    }
+
+    uint32 GetTransformId() const
+    {
+        return m_TransformId;
+    }
+
+    // Pushes the local transform fields to the store and invalidates this
+    // component's subtree. Call after writing the reflected fields directly
+    // (editor property edits, serialization).
+    void MarkTransformDirty()
+    {
+        if (!m_Transforms)
+            return;
+
+        m_Transforms->SetLocal(m_TransformId, m_Position, m_RotationQuat, Scale);
+        PropagateTransformDirty();
+    }
+
+    // Moves this component into (or out of, with nullptr) a scene transform store.
+    // Children already in the same store are linked under the new entry.
+    void BindTransformHierarchy(TransformHierarchy* hierarchy)
+    {
+        if (m_Transforms == hierarchy)
+            return;
+
+        if (m_Transforms)
+        {
+            for (SceneComponent* child : m_Children)
+            {
+                if (child->m_Transforms != m_Transforms)
+                    continue;
+
+                m_Transforms->SetParent(child->m_TransformId, TransformHierarchy::kInvalidId);
+                child->PropagateTransformDirty();
+            }
+
+            m_Transforms->Remove(m_TransformId);
+            m_TransformId = TransformHierarchy::kInvalidId;
+        }
+
+        m_Transforms = hierarchy;
+        if (!m_Transforms)
+            return;
+
+        m_TransformId = m_Transforms->Add(m_Position, m_RotationQuat, Scale);
+        if (m_Parent && m_Parent->m_Transforms == m_Transforms)
+            m_Transforms->SetParent(m_TransformId, m_Parent->m_TransformId);
+
+        for (SceneComponent* child : m_Children)
+        {
+            if (child->m_Transforms != m_Transforms)
+                continue;
+
+            m_Transforms->SetParent(child->m_TransformId, m_TransformId);
+            child->PropagateTransformDirty();
+        }
+    }
+
     bool IsDescendantOf(const SceneComponent* candidateAncestor) const
     {
         if (!candidateAncestor)
@@ -111,11 +223,14 @@ public:
             worldScale = GetWorldScale();
         }
 
-        m_Parent = newParent;
+        SetParentInternal(newParent);
 
         if (m_Parent && !m_SceneRegistry)
             m_SceneRegistry = m_Parent->m_SceneRegistry;
 
+        if (m_Parent && !m_Transforms)
+            BindTransformHierarchy(m_Parent->m_Transforms);
+
         if (!bKeepWorldTransform)
             return true;
 
@@ -146,6 +261,7 @@ public:
     void SetPosition(const Vector3& pos)
     {
         m_Position = pos;
+        MarkTransformDirty();
     }
 
     void SetWorldPosition(const Vector3& worldPos)
@@ -166,6 +282,8 @@ public:
 
             m_Position = relative;
         }
+
+        MarkTransformDirty();
     }
 
     void SetWorldRotationQuat(const glm::quat& worldRot)
@@ -182,6 +300,7 @@ public:
 
         m_RotationQuat = glm::normalize(m_RotationQuat);
         Rotation = glm::degrees(glm::eulerAngles(m_RotationQuat));
+        MarkTransformDirty();
     }
 
     const Vector3& GetScale() const
@@ -192,10 +311,14 @@ public:
     void SetScale(const Vector3& scale)
     {
         Scale = scale;
+        MarkTransformDirty();
     }
 
     Vector3 GetWorldScale() const
     {
+        if (ReadsFromTransformHierarchy())
+            return m_Transforms->GetWorldScale(m_TransformId);
+
         if (!m_Parent)
             return Scale;
 
@@ -217,12 +340,14 @@ public:
         Rotation = eulerDeg;
         Vector3 radians = glm::radians(eulerDeg);
         m_RotationQuat = glm::quat(radians);
+        MarkTransformDirty();
     }
 
     void SetRotationQuat(const glm::quat& q)
     {
         m_RotationQuat = glm::normalize(q);
         Rotation = glm::degrees(glm::eulerAngles(m_RotationQuat));
+        MarkTransformDirty();
     }
 
     void SetWorldTransform(const Vector3& worldPos, const glm::quat& worldRot)
@@ -245,6 +370,7 @@ public:
 
         m_RotationQuat = glm::normalize(m_RotationQuat);
         Rotation = glm::degrees(glm::eulerAngles(m_RotationQuat));
+        MarkTransformDirty();
     }
 
     Mat4 GetLocalTransform() const
@@ -257,15 +383,101 @@ public:
 
     Mat4 GetWorldTransform() const
     {
-        if (m_Parent == nullptr || !m_SceneRegistry) return GetLocalTransform();
-        CHECK(m_SceneRegistry);
+        if (ReadsFromTransformHierarchy())
+            return m_Transforms->GetWorldMatrix(m_TransformId);
+
+        if (!m_Parent)
+            return GetLocalTransform();
+
+        return m_Parent->GetWorldTransform() * GetLocalTransform();
+    }
+
+    // Moves what is rendered without moving the simulated transform; the
+    // whole subtree follows. The physics system uses it to interpolate
+    // dynamic bodies between fixed steps.
+    void SetRenderOffset(const Mat4& worldOffset)
+    {
+        m_RenderOffset = worldOffset;
+        m_bHasRenderOffset = true;
+    }
+
+    void ClearRenderOffset()
+    {
+        m_RenderOffset = Mat4(1.0f);
+        m_bHasRenderOffset = false;
+    }
 
-        const auto& parentWp = m_Parent->GetWorldTransform();
-        Mat4 lc = GetLocalTransform();
-        Mat4 wp = parentWp * lc;
-        return wp;
+    Bool HasRenderOffset() const { return m_bHasRenderOffset; }
+
+    // The world transform as drawn: the nearest render offset up the parent
+    // chain applied to GetWorldTransform().
+    Mat4 GetRenderTransform() const
+    {
+        for (const SceneComponent* cursor = this; cursor; cursor = cursor->m_Parent)
+        {
+            if (cursor->m_bHasRenderOffset)
+                return cursor->m_RenderOffset * GetWorldTransform();
+        }
+
+        return GetWorldTransform();
     }
 
+private:
+    // True when the store can answer for this component: it has an entry and its
+    // parent (if any) lives in the same store. The store's getters never write,
+    // so this is safe from jobs.
+    bool ReadsFromTransformHierarchy() const
+    {
+        return m_Transforms && (!m_Parent || m_Parent->m_Transforms == m_Transforms);
+    }
+
+    // Invariant: a dirty entry has dirty descendants, so this stops at the first dirty node.
+    void PropagateTransformDirty()
+    {
+        if (m_Transforms->IsDirty(m_TransformId))
+            return;
+
+        m_Transforms->MarkDirty(m_TransformId);
+        for (SceneComponent* child : m_Children)
+        {
+            if (child->m_Transforms == m_Transforms)
+                child->PropagateTransformDirty();
+        }
+    }
+
+    // Keeps the parent's child list in sync; every m_Parent change goes through here.
+    void SetParentInternal(SceneComponent* newParent)
+    {
+        if (m_Parent == newParent)
+            return;
+
+        if (m_Parent)
+        {
+            TArray<SceneComponent*>& siblings = m_Parent->m_Children;
+            for (uint32 i = 0; i < siblings.Num(); ++i)
+            {
+                if (siblings[i] == this)
+                {
+                    siblings.EraseAtSwap(i);
+                    break;
+                }
+            }
+        }
+
+        m_Parent = newParent;
+        if (m_Parent)
+            m_Parent->m_Children.Add(this);
+
+        if (m_Transforms)
+        {
+            const bool bSameStore = m_Parent && m_Parent->m_Transforms == m_Transforms;
+            m_Transforms->SetParent(m_TransformId, bSameStore ? m_Parent->m_TransformId : TransformHierarchy::kInvalidId);
+        }
+
+        MarkTransformDirty();
+    }
+
+public:
     REFLECTABLE_CLASS(SceneComponent, TagComponent)
 };
 
@@ -22,6 +22,10 @@ struct AnimStateMachineRuntime
     float TransitionTime = 0.0f;
     float TransitionDuration = 0.0f;
     bool bTransitionActive = false;
+    // Indices into the compiled program's States; the IDs above mirror them
+    // for the editor and debugger.
+    int32 CurrentStateIndex = -1;
+    int32 PreviousStateIndex = -1;
 };
 
 struct AnimBlendNodeRuntime
@@ -32,6 +36,13 @@ struct AnimBlendNodeRuntime
     bool bInitialized = false;
 };
 
+// One entry of the anim graph evaluation stack.
+struct AnimGraphPoseSlot
+{
+    TArray<Mat4> Pose;
+    bool bValid = false;
+};
+
 enum class ERootMotionRootLock : uint8
 {
     RefPose,
@@ -93,6 +104,8 @@ struct SkeletalMeshComponent : SceneComponent
     TArray<Mat4> LocalPose;
     TArray<Mat4> GlobalPose;
     TArray<Mat4> FinalPalette;
+    // Reused by the animation update for intermediate poses (override clips).
+    TArray<Mat4> PoseScratch;
 
     TArray<Vector3> RuntimeBoneLocalTranslations;
     TArray<Vector3> RuntimeBoneGlobalTranslations;
@@ -100,8 +113,12 @@ struct SkeletalMeshComponent : SceneComponent
     TArray<Vector3> RuntimeBoneGlobalScales;
     TArray<Quaternion> RuntimeBoneLocalRotations;
     TArray<Quaternion> RuntimeBoneGlobalRotations;
+    // Laid out in the order of the anim graph's compiled program: one entry
+    // per state machine and per smoothed blend node.
     TArray<AnimStateMachineRuntime> StateMachineRuntimes;
     TArray<AnimBlendNodeRuntime> BlendNodeRuntimes;
+    uint32 GraphProgramRevision = 0;
+    TArray<AnimGraphPoseSlot> GraphPoseStack;
     std::unique_ptr<AnimInstance> AnimScriptInstance{};
     AssetPtr<AnimationAsset> OverrideAnimation{};
     Bool bOverrideAnimationActive = false;
@@ -153,33 +170,6 @@ struct SkeletalMeshComponent : SceneComponent
 
     AnimInstance* GetAnimInstance() const { return AnimScriptInstance.get(); }
 
-    AnimStateMachineRuntime& GetStateMachineRuntime(uint64 stateMachineID)
-    {
-        for (AnimStateMachineRuntime& runtime : StateMachineRuntimes)
-        {
-            if (runtime.StateMachineID == stateMachineID)
-                return runtime;
-        }
-
-        AnimStateMachineRuntime& runtime = StateMachineRuntimes.Emplace();
-        runtime.StateMachineID = stateMachineID;
-        return runtime;
-    }
-
-    AnimBlendNodeRuntime& GetBlendNodeRuntime(uint64 scopeID, uint64 nodeID)
-    {
-        for (AnimBlendNodeRuntime& runtime : BlendNodeRuntimes)
-        {
-            if (runtime.ScopeID == scopeID && runtime.NodeID == nodeID)
-                return runtime;
-        }
-
-        AnimBlendNodeRuntime& runtime = BlendNodeRuntimes.Emplace();
-        runtime.ScopeID = scopeID;
-        runtime.NodeID = nodeID;
-        return runtime;
-    }
-
     AnimInstance* EnsureAnimInstance(const Rebel::Core::Reflection::TypeInfo* requestedType = nullptr)
     {
         const Rebel::Core::Reflection::TypeInfo* type = requestedType;
@@ -2,10 +2,23 @@
 
 #include "Engine/Assets/AssetPtr.h"
 #include "Engine/Assets/MeshAsset.h"
-#include "Engine/Components/SceneComponent.h"
+#include "Engine/Components/PrimitiveComponent.h"
 #include "Engine/Rendering/Mesh.h"
 
-struct StaticMeshComponent : SceneComponent
+enum class EMeshCollision : uint8
+{
+    None,
+    ConvexHull,
+    TriangleMesh
+};
+
+REFLECT_ENUM(EMeshCollision)
+    ENUM_OPTION(None)
+    ENUM_OPTION(ConvexHull)
+    ENUM_OPTION(TriangleMesh)
+END_ENUM(EMeshCollision)
+
+struct StaticMeshComponent : PrimitiveComponent
 {
     AssetPtr<MeshAsset> Mesh{};
     MaterialHandle Material{};
@@ -13,7 +26,14 @@ struct StaticMeshComponent : SceneComponent
     Bool bIsVisible = true;
     Bool bCastShadows = true;
 
-    StaticMeshComponent() = default;
+    // Collision cooked from the mesh's vertices. Triangle meshes only work
+    // for static bodies; other body types get the convex hull instead.
+    EMeshCollision Collision = EMeshCollision::None;
+
+    StaticMeshComponent()
+    {
+        BodyType = ERBBodyType::Static;
+    }
 
     StaticMeshComponent(AssetHandle meshAsset,
                         MaterialHandle mat = MaterialHandle(),
@@ -23,7 +43,9 @@ struct StaticMeshComponent : SceneComponent
         , Material(mat)
         , bIsVisible(visible)
         , bCastShadows(castShadows)
-    {}
+    {
+        BodyType = ERBBodyType::Static;
+    }
 
     Bool IsValid() const
     {
@@ -31,10 +53,21 @@ struct StaticMeshComponent : SceneComponent
     }
     explicit operator Bool() const { return IsValid(); }
 
-    REFLECTABLE_CLASS(StaticMeshComponent, SceneComponent)
+    PhysicsShape CreatePhysicsShape() const override
+    {
+        if (Collision == EMeshCollision::None || !IsValid())
+            return PhysicsShape::MakeNone();
+
+        if (Collision == EMeshCollision::TriangleMesh && BodyType == ERBBodyType::Static)
+            return PhysicsShape::MakeMesh(EPhysicsShapeType::TriangleMesh, Mesh.GetHandle());
+
+        return PhysicsShape::MakeMesh(EPhysicsShapeType::ConvexHull, Mesh.GetHandle());
+    }
+
+    REFLECTABLE_CLASS(StaticMeshComponent, PrimitiveComponent)
 };
 
-REFLECT_CLASS(StaticMeshComponent, SceneComponent)
+REFLECT_CLASS(StaticMeshComponent, PrimitiveComponent)
 {
     REFLECT_PROPERTY(StaticMeshComponent, Mesh,
         EPropertyFlags::VisibleInEditor | EPropertyFlags::Editable);
@@ -47,6 +80,12 @@ REFLECT_CLASS(StaticMeshComponent, SceneComponent)
 
     REFLECT_PROPERTY(StaticMeshComponent, bCastShadows,
         EPropertyFlags::VisibleInEditor | EPropertyFlags::Editable);
+
+    REFLECT_PROPERTY(StaticMeshComponent, Collision,
+        EPropertyFlags::VisibleInEditor | EPropertyFlags::Editable);
+
+    REFLECT_PROPERTY(StaticMeshComponent, BodyType,
+        EPropertyFlags::VisibleInEditor | EPropertyFlags::Editable);
 }
 END_REFLECT_CLASS(StaticMeshComponent)
 REFLECT_ECS_COMPONENT(StaticMeshComponent)
@@ -130,7 +130,31 @@ public:
     
     void SetMovementMode(MovementMode mode){ m_State.Mode = mode;};
 
+    // Opt-in for characters not driven by a PlayerController: the tick only
+    // gathers input, and the World simulates all queued characters on the job
+    // system after the tick group, then writes their poses back in queue order.
+    void SetParallelMovement(bool bEnabled) { m_bParallelMovement = bEnabled; }
+    bool IsParallelMovement() const { return m_bParallelMovement; }
+
 protected:
+    struct MovementTickInput
+    {
+        float DeltaTime = 0.0f;
+        Vector3 MoveInput = Vector3(0.0f);
+        bool bJumpRequested = false;
+    };
+
+    MovementTickInput GatherMovementInput(float deltaTime, Pawn& pawn);
+    void SimulateMovement(const MovementTickInput& input);
+    bool ShouldMoveInParallel(const Pawn& pawn) const;
+
+    // Pose the movement code reads and writes. Forwards to UpdatedComponent,
+    // except while a queued simulation keeps it local to the component.
+    Vector3 GetMovementPosition() const;
+    void SetMovementPosition(const Vector3& position);
+    Vector3 GetMovementRotationEuler() const;
+    void SetMovementRotationEuler(const Vector3& rotationEuler);
+
     void PerformMovement(float deltaTime, const Vector3& moveInput, bool bJumpRequested);
     void StartNewPhysics(float deltaTime, const Vector3& moveInput);
     void PhysWalking(float deltaTime, const Vector3& moveInput);
@@ -179,6 +203,13 @@ protected:
     
 
 private:
+    friend class World;
+
+    // Called by World::FlushCharacterMovement: the first on a job thread, the
+    // second back on the game thread.
+    void SimulateQueuedMovement();
+    void ApplyQueuedMovement();
+
     MovementState m_State{};
     CharacterRotationMode m_RotationMode = CharacterRotationMode::OrientToMovement;
 
@@ -250,6 +281,13 @@ private:
     float m_LaunchProtectionDuration = 0.12f;
     float m_LaunchProtectionTimeRemaining = 0.0f;
     float m_LaunchProtectedHorizontalSpeed = 0.0f;
+
+    bool m_bParallelMovement = false;
+    bool m_bDeferredPose = false;
+    bool m_bDeferredRotationChanged = false;
+    Vector3 m_DeferredPosition = Vector3(0.0f);
+    Vector3 m_DeferredRotationEuler = Vector3(0.0f);
+    MovementTickInput m_QueuedInput{};
 };
 
 REFLECT_CLASS(CharacterMovementComponent, MovementComponent)
@@ -303,6 +341,8 @@ REFLECT_CLASS(CharacterMovementComponent, MovementComponent)
         Rebel::Core::Reflection::EPropertyFlags::VisibleInEditor | Rebel::Core::Reflection::EPropertyFlags::Editable);
     REFLECT_PROPERTY(CharacterMovementComponent, m_LaunchProtectionDuration,
         Rebel::Core::Reflection::EPropertyFlags::VisibleInEditor | Rebel::Core::Reflection::EPropertyFlags::Editable);
+    REFLECT_PROPERTY(CharacterMovementComponent, m_bParallelMovement,
+        Rebel::Core::Reflection::EPropertyFlags::VisibleInEditor | Rebel::Core::Reflection::EPropertyFlags::Editable);
 END_REFLECT_CLASS(CharacterMovementComponent)
 REFLECT_ECS_COMPONENT(CharacterMovementComponent)
 
@@ -4,9 +4,18 @@
 
 #include <vector>
 
+class AssetManager;
 class Scene;
 struct PrimitiveComponent;
 
+// How mesh collision shapes were obtained since Init.
+struct MeshShapeStats
+{
+    uint32 Cooked = 0;   // built from the mesh and written to the shape cache
+    uint32 Restored = 0; // read back from the shape cache on disk
+    uint32 Shared = 0;   // reused from a body created earlier
+};
+
 class PhysicsSystem
 {
 public:
@@ -14,7 +23,18 @@ public:
     void Shutdown();
     void EditorDebugDraw(Scene& scene);
 
+    // Resolves the MeshAsset behind convex-hull and triangle-mesh shapes.
+    // Without it, primitives asking for mesh collision get no body.
+    void SetAssetManagerContext(AssetManager* assetManager);
+
+    // Creates bodies for primitives the scene queued since the last step in
+    // one batch, simulates, syncs awake bodies back and then fires the hit
+    // and overlap delegates on PrimitiveComponent for contacts that began,
+    // persisted or ended during the step.
     void Step(Scene& scene, Float dt);
+
+    // Releases the body right away; it leaves the simulation with the rest of
+    // the batch at the start of the next step.
     void DestroyBodyForComponent(PrimitiveComponent& primitive);
 
     bool LineTraceSingle(const Vector3& start, const Vector3& end, TraceHit& outHit, const TraceQueryParams& params) const;
@@ -23,6 +43,21 @@ public:
     bool CapsuleTraceSingle(const Vector3& start, const Vector3& end, float halfHeight, float radius, TraceHit& outHit, const TraceQueryParams& params) const;
     bool BoxTraceSingle(const Vector3& start, const Vector3& end, const Vector3& halfExtents, const Quaternion& rotation, TraceHit& outHit, const TraceQueryParams& params) const;
 
+    // Runs queries[i] into outResults[i] against the state of the last step
+    // and returns the hit count. Reads bodies without locking, spreading
+    // large batches over the job system, so it must not overlap Step or
+    // body creation and removal.
+    uint32 RunSceneQueries(const SceneQuery* queries, SceneQueryResult* outResults, uint32 count) const;
+
+    // Owners of every body overlapping the volume, each once and in entity
+    // order. outEntities is cleared first and keeps its capacity.
+    bool OverlapSphereMulti(const Vector3& center, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+    bool OverlapCapsuleMulti(const Vector3& center, float halfHeight, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+    bool OverlapBoxMulti(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+
+    // Same as the overlaps, but tests body bounds in the broadphase only.
+    bool QueryAABB(const Vector3& min, const Vector3& max, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+
     void SetFixedDeltaTime(Float fixedDeltaTime);
     Float GetFixedDeltaTime() const { return m_FixedDT; }
 
@@ -31,11 +66,52 @@ public:
 
     uint32 GetLastSubstepCount() const { return m_LastSubstepCount; }
 
+    // Share of a fixed step left in the accumulator after the last Step, in
+    // [0, 1). Rendering is that far from the previous step's poses toward
+    // the current ones.
+    Float GetInterpolationAlpha() const { return m_FixedDT > 0.0f ? m_Accumulator / m_FixedDT : 0.0f; }
+
+    // Dynamic bodies are drawn blended between their last two simulated
+    // poses through SceneComponent render offsets, so motion stays smooth
+    // when the frame rate and the physics rate differ. Components keep the
+    // simulated pose either way. On by default.
+    void SetInterpolation(bool bEnabled) { m_bInterpolate = bEnabled; }
+    bool IsInterpolating() const { return m_bInterpolate; }
+
+    // Bodies alive in the simulation, including ones waiting for removal.
+    uint32 GetBodyCount() const;
+
+    // Awake bodies; only these are synced back to their components.
+    uint32 GetActiveBodyCount() const;
+
+    // Channel-vs-channel responses, used by the simulation and by traces.
+    // Edits apply to body pairs found from the next step on.
+    CollisionResponseMatrix& GetCollisionResponses() { return m_CollisionResponses; }
+    const CollisionResponseMatrix& GetCollisionResponses() const { return m_CollisionResponses; }
+
+    // Cooked mesh shapes are cached next to the mesh's .rasset, keyed by a
+    // hash of its vertices and indices, and shared between bodies.
+    const MeshShapeStats& GetMeshShapeStats() const;
+
 private:
+    void FlushPendingBodyRemovals();
+    void CreatePendingBodies(Scene& scene);
+    void SyncKinematicTargets(Scene& scene);
+    void DriveKinematicBodies();
+    void WriteBackActiveBodies(Scene& scene);
+    void DispatchContactEvents(Scene& scene);
+    void ReserveTempAllocator();
+    void BeginInterpolation(Scene& scene);
+    void UpdateInterpolation(Scene& scene, bool bStepped);
+    void ClearInterpolation(Scene& scene);
+
     Float m_Accumulator = 0.0f;
     Float m_FixedDT = 1.0f / 60.0f;
     uint32 m_MaxSubsteps = 8;
     uint32 m_LastSubstepCount = 0;
+    bool m_bInterpolate = true;
+    CollisionResponseMatrix m_CollisionResponses;
+    AssetManager* m_AssetManager = nullptr;
 
     struct Impl;
     Impl* m_Impl = nullptr;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/CoreMacros.h"
 #include "Core/CoreTypes.h"
 #include "Core/Math/CoreMath.h"
 
@@ -22,6 +23,34 @@ enum class CollisionChannel : uint8
 	Any
 };
 
+// Which object channels interact, both for body-vs-body simulation and for a
+// trace on one channel against bodies on another. Symmetric; Any is not a
+// row and always responds.
+class CollisionResponseMatrix
+{
+public:
+	static constexpr uint32 ChannelCount = static_cast<uint32>(CollisionChannel::Any);
+
+	// Everything responds, except camera and visibility probes, which skip
+	// pawns and triggers.
+	CollisionResponseMatrix();
+
+	void SetResponse(CollisionChannel a, CollisionChannel b, bool bResponds);
+	void SetAllResponses(CollisionChannel channel, bool bResponds);
+
+	bool Responds(CollisionChannel a, CollisionChannel b) const
+	{
+		if (a == CollisionChannel::Any || b == CollisionChannel::Any)
+			return true;
+
+		return (m_Rows[static_cast<uint32>(a)] >> static_cast<uint32>(b)) & 1u;
+	}
+
+private:
+	STATIC_ASSERT(ChannelCount <= 8, "One byte per response row");
+	uint8 m_Rows[ChannelCount];
+};
+
 namespace EDrawDebugTrace
 {
 	enum Type : uint8
@@ -50,6 +79,41 @@ struct TraceQueryParams
 	bool bTraceTriggers = false;
 };
 
+enum class ESceneQueryKind : uint8
+{
+	Trace = 0, // sweep from Start to End, closest hit
+	Overlap    // shape placed at Start, deepest penetration
+};
+
+enum class ESceneQueryShape : uint8
+{
+	Line = 0, // traces only
+	Sphere,
+	Capsule,
+	Box
+};
+
+// One request of a batched query. Rotation applies to capsules and boxes;
+// capsules stand along Z like CapsuleTraceSingle.
+struct SceneQuery
+{
+	ESceneQueryKind Kind = ESceneQueryKind::Trace;
+	ESceneQueryShape Shape = ESceneQueryShape::Line;
+	Vector3 Start{0.0f};
+	Vector3 End{0.0f};
+	Quaternion Rotation{1.0f, 0.0f, 0.0f, 0.0f};
+	Vector3 HalfExtent{0.0f};
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	TraceQueryParams Params;
+};
+
+struct SceneQueryResult
+{
+	bool bHit = false;
+	TraceHit Hit;
+};
+
 bool LineTraceSingle(
 	World& world,
 	const Vector3& start,
@@ -190,6 +254,88 @@ bool BoxTraceSingle(
 	EDrawDebugTrace::Type drawDebugType = EDrawDebugTrace::None
 );
 
+// Runs queries[i] into outResults[i] and returns the number of hits. Large
+// batches spread across the job system; call between physics steps.
+uint32 RunSceneQueries(
+	World& world,
+	const SceneQuery* queries,
+	SceneQueryResult* outResults,
+	uint32 count
+);
+
+uint32 RunSceneQueries(
+	const SceneQuery* queries,
+	SceneQueryResult* outResults,
+	uint32 count
+);
+
+// Owners of every body overlapping the volume or, for QueryAABB, whose
+// bounds intersect the box. Each entity is listed once; outEntities is
+// cleared first and keeps its capacity between calls.
+bool OverlapSphereMulti(
+	World& world,
+	const Vector3& center,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool OverlapSphereMulti(
+	const Vector3& center,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool OverlapCapsuleMulti(
+	World& world,
+	const Vector3& center,
+	float halfHeight,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool OverlapCapsuleMulti(
+	const Vector3& center,
+	float halfHeight,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool OverlapBoxMulti(
+	World& world,
+	const Vector3& center,
+	const Vector3& halfExtents,
+	const Quaternion& rotation,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool OverlapBoxMulti(
+	const Vector3& center,
+	const Vector3& halfExtents,
+	const Quaternion& rotation,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool QueryAABB(
+	World& world,
+	const Vector3& min,
+	const Vector3& max,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
+bool QueryAABB(
+	const Vector3& min,
+	const Vector3& max,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params
+);
+
 void DrawDebugLineTrace(
 	const Vector3& start,
 	const Vector3& end,
@@ -222,3 +368,5 @@ void DrawDebugHitNormal(
 // SphereTraceSingle(pos, pos + forward * 0.5f, 0.3f, hit);
 // std::vector<TraceHit> hits;
 // LineTraceMulti(muzzle, muzzle + forward * 100.0f, hits);
+// std::vector<EntityID> targets;
+// OverlapSphereMulti(blastCenter, 5.0f, targets, TraceQueryParams{});
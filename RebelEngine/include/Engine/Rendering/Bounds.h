@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Containers/TArray.h"
+#include "Core/Math/CoreMath.h"
+
+struct Vertex;
+
+// Axis-aligned box plus enclosing sphere, both around the same center.
+// Stored as center/extents so a frustum test needs no conversion.
+struct BoxSphereBounds
+{
+	Vector3 Center{0.0f};
+	Vector3 Extents{-1.0f}; // negative = empty
+	Float   Radius = 0.0f;
+
+	Bool IsValid() const { return Extents.x >= 0.0f; }
+
+	Vector3 GetMin() const { return Center - Extents; }
+	Vector3 GetMax() const { return Center + Extents; }
+
+	static BoxSphereBounds FromMinMax(const Vector3& min, const Vector3& max);
+
+	// Box and sphere are both fitted to the points, so the sphere is tighter
+	// than the box diagonal for elongated meshes.
+	static BoxSphereBounds FromVertices(const TArray<Vertex>& vertices);
+
+	// Conservative bound of the transformed box (Arvo's method); the sphere
+	// radius is scaled by the largest axis scale of the matrix.
+	BoxSphereBounds TransformBy(const Mat4& m) const;
+
+	// Union of both boxes; the sphere is re-derived from the merged box.
+	BoxSphereBounds Union(const BoxSphereBounds& other) const;
+};
+
+// Mesh-space bound per bone: the box around every vertex that bone influences
+// in the bind pose. Because linear blend skinning places a vertex inside the
+// convex hull of its per-bone transformed positions, the union of these boxes
+// after each is transformed by its skin matrix encloses the posed mesh.
+namespace SkinnedBounds
+{
+	void BuildBoneBounds(const TArray<Vertex>& vertices, TArray<BoxSphereBounds>& outBoneBounds);
+
+	// Returns the bind bound when the palette is empty or no bone box applies.
+	BoxSphereBounds ComputePosedBounds(
+		const TArray<BoxSphereBounds>& boneBounds,
+		const TArray<Mat4>& skinPalette,
+		const BoxSphereBounds& bindBounds);
+}
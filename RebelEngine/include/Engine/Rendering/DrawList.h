@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/Containers/TArray.h"
+#include "Core/Math/CoreMath.h"
+#include "Engine/Rendering/Mesh.h"
+
+enum class EDrawPass : uint8
+{
+    Opaque = 0,
+};
+
+// Per-frame list of submitted draws, kept GL-free so it can be sorted and
+// benchmarked headless.
+//
+// Submission writes the transform into a packed Mat4 array, the small draw
+// parameters into a parallel item array, and one 64-bit sort key. Sort()
+// radix-sorts (key, index) pairs; renderers walk GetSortedIndices() and never
+// move the transforms themselves.
+//
+// Key layout, most significant first:
+//   pass (4) | material (16) | mesh (24) | depth bucket (20)
+// Materials and meshes group together for batching; within one mesh, draws
+// go front to back.
+class DrawList
+{
+public:
+    struct DrawItem
+    {
+        MeshHandle Mesh;
+        uint32 MaterialId = 0;
+        uint32 ObjectId = 0;
+        uint32 BoneBase = 0;
+    };
+
+    // Clears the frame; depth buckets are measured from sortOrigin.
+    void Reset(const Vector3& sortOrigin = Vector3(0.0f));
+    void Reserve(MemSize count);
+
+    void Add(const MeshHandle& mesh, const Mat4& model, uint32 materialId, uint32 objectId,
+             uint32 boneBase = 0, EDrawPass pass = EDrawPass::Opaque);
+
+    // Stable LSD radix sort over 8-bit digits; digits shared by every key
+    // are skipped, so a single-pass frame costs a histogram and no scatter.
+    void Sort();
+
+    [[nodiscard]] MemSize Num() const { return m_Items.Num(); }
+    [[nodiscard]] Bool IsEmpty() const { return m_Items.IsEmpty(); }
+
+    // Submission order.
+    [[nodiscard]] const TArray<Mat4>& GetTransforms() const { return m_Transforms; }
+    [[nodiscard]] const TArray<DrawItem>& GetItems() const { return m_Items; }
+
+    // Valid after Sort(): draw indices and their keys in draw order.
+    [[nodiscard]] const TArray<uint32>& GetSortedIndices() const { return m_SortedIndices; }
+    [[nodiscard]] const TArray<uint64>& GetSortedKeys() const { return m_SortedKeys; }
+
+    static uint64 MakeSortKey(EDrawPass pass, uint32 materialId, const MeshHandle& mesh, Float distanceSq);
+
+private:
+    Vector3 m_SortOrigin{0.0f};
+
+    TArray<Mat4>     m_Transforms;
+    TArray<DrawItem> m_Items;
+
+    TArray<uint64> m_SortedKeys;
+    TArray<uint32> m_SortedIndices;
+
+    // Ping-pong buffers, kept across frames.
+    TArray<uint64> m_KeyScratch;
+    TArray<uint32> m_IndexScratch;
+};
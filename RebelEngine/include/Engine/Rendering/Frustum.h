@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Core/Math/CoreMath.h"
+#include "Engine/Rendering/Bounds.h"
+
+struct CameraView;
+
+// Per-frame draw culling counters.
+struct CullingStats
+{
+	uint32 Visible = 0;
+	uint32 Culled = 0;
+
+	void Reset() { Visible = 0; Culled = 0; }
+	uint32 GetTested() const { return Visible + Culled; }
+};
+
+// Six clip planes extracted from a view-projection matrix (Gribb/Hartmann).
+//
+// Planes are stored transposed (all X, all Y, ...) and padded to eight so the
+// SSE path tests four planes per instruction with no shuffles. Padding planes
+// are (0, 0, 0, 1) and therefore never reject anything.
+class ViewFrustum
+{
+public:
+	ViewFrustum();
+	explicit ViewFrustum(const Mat4& viewProj);
+
+	// Uses the unflipped camera projection; the GL Y flip done by the renderer
+	// only swaps the top and bottom planes.
+	static ViewFrustum FromCamera(const CameraView& camera);
+
+	Bool IntersectsSphere(const Vector3& center, Float radius) const;
+	Bool IntersectsBox(const Vector3& center, const Vector3& extents) const;
+
+	// Sphere first (cheaper, rejects most far-off objects), then the box.
+	// Invalid (empty) bounds are treated as visible.
+	Bool Intersects(const BoxSphereBounds& worldBounds) const;
+
+	// Transforms mesh-space bounds by the draw's model matrix, tests them and
+	// bumps the matching counter. This is the per-draw check the renderer runs.
+	Bool IsVisible(const BoxSphereBounds& localBounds, const Mat4& localToWorld, CullingStats& stats) const;
+
+	// Same result as Intersects() without SIMD; kept as a test reference.
+	Bool IntersectsScalar(const BoxSphereBounds& worldBounds) const;
+
+private:
+	static constexpr int32 kPlaneCount = 6;
+	static constexpr int32 kPaddedPlaneCount = 8;
+
+	ALIGNAS(16) Float m_PlaneX[kPaddedPlaneCount];
+	ALIGNAS(16) Float m_PlaneY[kPaddedPlaneCount];
+	ALIGNAS(16) Float m_PlaneZ[kPaddedPlaneCount];
+	ALIGNAS(16) Float m_PlaneW[kPaddedPlaneCount];
+};
@@ -1,10 +1,10 @@
 ﻿#pragma once
 #include "Engine/Rendering/RenderAPI.h"
+#include "Engine/Rendering/DrawList.h"
 #include "glad/glad.h"
 #include <vector>
 #include <cstdint>
 #include <iostream>
-#include <algorithm>    // for std::sort
 
 // assumes Vertex is FBX-ready:
 // struct Vertex {
@@ -23,6 +23,8 @@ public:
         uint32 baseVertex;
         uint32 baseInstance;
     };
+
+    static constexpr size_t PerFrameDrawCap = 65536;
     
     OpenGLRenderAPI() {
         // global VAO + packed static buffers
@@ -233,9 +235,10 @@ public:
 
     //MeshHandle AddStaticMesh(const Mesh& mesh) { return AddStaticMesh(mesh.GetVertices(), mesh.GetIndices()); }
 
-    void BeginFrame() {
-        m_PendingDraws.Clear();
-        m_PendingDraws.Reserve(4096);
+    // viewPosition only feeds the front-to-back part of the draw sort keys.
+    void BeginFrame(const Vector3& viewPosition = Vector3(0.0f)) {
+        m_DrawList.Reset(viewPosition);
+        m_DrawList.Reserve(4096);
         m_FrameBones.clear();
         m_FrameBones.emplace_back(1.0f); // index 0: identity for static meshes
     }
@@ -247,31 +250,25 @@ public:
             m_FrameBones.emplace_back(1.0f);
     }
 
-    // NEW: per-draw material id
     // NEW: per-draw material id + object id
     void SubmitDraw(const MeshHandle& h, const Mat4& model, uint32 materialId, uint32 objectId, uint32 boneBase = 0) {
-        if (m_PendingDraws.Num() >= PerFrameDrawCap) return;
-        PendingDraw d;
-        d.mesh       = h;
-        d.model      = model;
-        d.materialId = materialId;
-        d.objectId   = objectId;
-        d.boneBase   = boneBase;
-        m_PendingDraws.Add(d);
+        if (m_DrawList.Num() >= PerFrameDrawCap) return;
+        m_DrawList.Add(h, model, materialId, objectId, boneBase);
     }
 
 
     // materials: array indexed by materialId (matches what you pass to SubmitDraw)
     void EndFrameAndDraw(uint32 shaderProgram, const TArray<Material>& materials) {
-        if (m_PendingDraws.IsEmpty()) return;
+        if (m_DrawList.IsEmpty()) return;
 
-        const size_t total = (size_t)m_PendingDraws.Num();
-        PendingDraw* data  = m_PendingDraws.Data();
+        // sort keys (pass, material, mesh, depth) so we can batch per material;
+        // transforms stay where they were submitted
+        m_DrawList.Sort();
 
-        // sort draws by material so we can batch per material
-        std::sort(data, data + total, [](const PendingDraw& a, const PendingDraw& b) {
-            return a.materialId < b.materialId;
-        });
+        const size_t total = (size_t)m_DrawList.Num();
+        const uint32* order = m_DrawList.GetSortedIndices().Data();
+        const DrawList::DrawItem* items = m_DrawList.GetItems().Data();
+        const Mat4* transforms = m_DrawList.GetTransforms().Data();
 
         glBindVertexArray(m_VAO);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
@@ -294,11 +291,11 @@ public:
         size_t i = 0;
         while (i < total)
         {
-            const uint32 matId = data[i].materialId;
+            const uint32 matId = items[order[i]].MaterialId;
             if (matId >= (uint32)materials.Num()) {
                 // invalid material index, skip this batch
                 size_t j = i + 1;
-                while (j < total && data[j].materialId == matId) ++j;
+                while (j < total && items[order[j]].MaterialId == matId) ++j;
                 i = j;
                 continue;
             }
@@ -317,23 +314,23 @@ public:
             m_BoneBases.Clear();
 
             size_t j = i;
-            while (j < total && data[j].materialId == matId)
+            while (j < total && items[order[j]].MaterialId == matId)
             {
-                const PendingDraw& d = data[j];
+                const DrawList::DrawItem& d = items[order[j]];
 
                 if (m_Draws.Num() >= PerFrameDrawCap)
                     break;
 
                 DrawElementsIndirectCommand cmd{};
-                cmd.count         = d.mesh.indexCount;
+                cmd.count         = d.Mesh.indexCount;
                 cmd.instanceCount = 1;
-                cmd.firstIndex    = d.mesh.firstIndex;
-                cmd.baseVertex    = (uint32)d.mesh.baseVertex;
+                cmd.firstIndex    = d.Mesh.firstIndex;
+                cmd.baseVertex    = (uint32)d.Mesh.baseVertex;
                 cmd.baseInstance  = (uint32)m_ModelMats.Num();
 
                 m_Draws.Add(cmd);
-                m_ModelMats.Add(d.model);
-                m_BoneBases.Add(d.boneBase);
+                m_ModelMats.Add(transforms[order[j]]);
+                m_BoneBases.Add(d.BoneBase);
 
                 ++j;
             }
@@ -392,41 +389,39 @@ public:
     void DrawPicking(uint32 pickShaderProgram)
     {
         (void)pickShaderProgram; // call-site clarity
-        if (m_PendingDraws.IsEmpty()) return;
+        if (m_DrawList.IsEmpty()) return;
     
-        const size_t total = (size_t)m_PendingDraws.Num();
-        PendingDraw* data  = m_PendingDraws.Data();
+        // Picking does not care about order, so draws go out in submission
+        // order and the packed transform array is uploaded as-is.
+        const size_t total = (size_t)m_DrawList.Num();
+        const DrawList::DrawItem* items = m_DrawList.GetItems().Data();
     
         glBindVertexArray(m_VAO);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
     
         m_Draws.Clear();
-        m_ModelMats.Clear();
         m_ObjectIDs.Clear();
     
-        // Build one big MDI list. No material sorting needed for picking.
         for (size_t i = 0; i < total; ++i)
         {
-            const PendingDraw& d = data[i];
-            if (m_Draws.Num() >= PerFrameDrawCap)
-                break;
+            const DrawList::DrawItem& d = items[i];
     
             DrawElementsIndirectCommand cmd{};
-            cmd.count         = d.mesh.indexCount;
+            cmd.count         = d.Mesh.indexCount;
             cmd.instanceCount = 1;
-            cmd.firstIndex    = d.mesh.firstIndex;
-            cmd.baseVertex    = (uint32)d.mesh.baseVertex;
-            cmd.baseInstance  = (uint32)m_ModelMats.Num(); // still using DrawID indexing
+            cmd.firstIndex    = d.Mesh.firstIndex;
+            cmd.baseVertex    = (uint32)d.Mesh.baseVertex;
+            cmd.baseInstance  = (uint32)i; // still using DrawID indexing
     
             m_Draws.Add(cmd);
-            m_ModelMats.Add(d.model);
-            m_ObjectIDs.Add(d.objectId);
+            m_ObjectIDs.Add(d.ObjectId);
         }
     
         // upload model matrices (binding=0)
+        const TArray<Mat4>& transforms = m_DrawList.GetTransforms();
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ModelSSBO);
-        glBufferData(GL_SHADER_STORAGE_BUFFER, m_ModelMats.Num() * sizeof(Mat4), nullptr, GL_DYNAMIC_DRAW);
-        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, m_ModelMats.Num() * sizeof(Mat4), m_ModelMats.Data());
+        glBufferData(GL_SHADER_STORAGE_BUFFER, transforms.Num() * sizeof(Mat4), nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, transforms.Num() * sizeof(Mat4), transforms.Data());
         glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_ModelSSBO);
     
         // upload object ids (binding=1)
@@ -454,18 +449,8 @@ public:
     TArray<MeshAssetEntry> m_MeshAssets;
 
 private:
-    struct PendingDraw {
-        MeshHandle mesh;
-        Mat4  model;
-        uint32 materialId;
-        uint32 objectId;
-        uint32 boneBase = 0;
-    };
-
-    
     static constexpr GLsizeiptr StaticVBSize    = 128 * 1024 * 1024; // 128 MB vertices
     static constexpr GLsizeiptr StaticIBSize    = 64  * 1024 * 1024; // 64 MB indices
-    static constexpr size_t     PerFrameDrawCap = 65536;
 
     uint32 m_VAO = 0, m_VBO = 0, m_IBO = 0;
     uint32 m_ModelSSBO = 0, m_IndirectBuffer = 0;
@@ -480,8 +465,8 @@ private:
     TArray<uint32>                 m_BoneBases;
     std::vector<Mat4>              m_FrameBones;
 
-    // NEW: all pending draws for this frame (with material info)
-    TArray<PendingDraw>                 m_PendingDraws;
+    // all draws submitted this frame: packed transforms + 64-bit sort keys
+    DrawList                       m_DrawList;
 
     uint32  m_ObjectIdSSBO = 0;
     TArray<uint32> m_ObjectIDs;
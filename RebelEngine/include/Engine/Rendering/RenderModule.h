@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Engine/Rendering/Frustum.h"
 #include "Engine/Rendering/OpenGLRenderAPI.h"
 #include "Engine/Rendering/RenderAPI.h"
 
@@ -119,6 +120,9 @@ public:
 
     TArray<Material> GetMaterials() const { return m_Materials; }
 
+    // Frustum culling results of the last main-viewport frame.
+    [[nodiscard]] const CullingStats& GetCullingStats() const { return m_CullingStats; }
+
     // --- Mouse picking ---
     // Coordinates are in viewport pixels (origin top-left, like ImGui).
     // Returns 0 if nothing is under the cursor.
@@ -234,7 +238,8 @@ private:
     int32  m_uGridZAxisColorLoc = -1;
     EditorGridSettings m_GridSettings;
     void DrawEditorGrid(const Mat4& viewProj, const Vector3& cameraPos, uint32 viewportWidth, uint32 viewportHeight);
-    void CollectSceneDraws(Scene& scene, OpenGLRenderAPI* ogl, AssetManager& assetManager);
+    void CollectSceneDraws(Scene& scene, OpenGLRenderAPI* ogl, AssetManager& assetManager,
+                           const ViewFrustum& frustum, CullingStats& stats);
     void DrawDebugLines(const Mat4& viewProj);
 
     DirectionalLightSettings m_DirectionalLight;
@@ -245,6 +250,8 @@ private:
     std::vector<Mat4> m_FrameBoneData;
     std::vector<uint32> m_FrameBoneBase;
 
+    CullingStats m_CullingStats;
+
 
 
 
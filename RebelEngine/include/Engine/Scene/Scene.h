@@ -6,6 +6,7 @@
 
 #include "Engine/Scene/Actor.h"
 #include "Engine/Scene/ActorTemplateSerializer.h"
+#include "Engine/Scene/TransformHierarchy.h"
 #include "Engine/Components/Components.h"
 #include "Core/Serialization/YamlSerializer.h"
 
@@ -46,6 +47,12 @@ public:
 	void RegisterTickActor(Actor* actor);
 	void UnregisterTickActor(Actor* actor);
 
+	// -------- Physics registration --------
+	// Primitive entities registered since the physics system last drained the
+	// queue; their bodies are created together on the next step.
+	void QueuePhysicsBodyCreation(entt::entity primitiveEntity);
+	TArray<entt::entity>& GetPendingPhysicsBodies() { return m_PendingPhysicsBodies; }
+
 	entt::registry&       GetRegistry()       { return m_Registry; }
 	const entt::registry& GetRegistry() const { return m_Registry; }
 	void SetWorld(World* world) { m_World = world; }
@@ -61,6 +68,9 @@ public:
 
 	void UpdateTransforms();
 
+	TransformHierarchy&       GetTransformHierarchy()       { return m_Transforms; }
+	const TransformHierarchy& GetTransformHierarchy() const { return m_Transforms; }
+
 	Actor* GetActor(entt::entity e)
 	{
 		Actor** found = m_ActorsMap.Find(e);
@@ -131,8 +141,6 @@ public:
 
 private:
 
-	void UpdateTransform(entt::entity entity);
-
 	/*void UpdateComponentWorldTransforms()
 	{
 		auto view = m_Registry.view<SceneComponent>();
@@ -152,6 +160,10 @@ private:
 	// ---------- ECS ----------
 	entt::registry m_Registry;
 
+	// ---------- Transforms ----------
+	// Declared before m_Actors so it outlives every SceneComponent entry.
+	TransformHierarchy m_Transforms;
+
 	// ---------- Actor ownership ----------
 	TArray<RUniquePtr<Actor>, 16> m_Actors;   // owns Actors (unique_ptr)
 	TMap<entt::entity,Actor*> m_ActorsMap;   // owns Actors (unique_ptr)
@@ -164,6 +176,9 @@ private:
 	TArray<Actor*, 16> m_PostPhysicsTickActors;
 	TArray<Actor*, 16> m_PostUpdateTickActors;
 	TArray<Actor*, 16> m_PendingDestroyActors;
+
+	// ---------- Physics ----------
+	TArray<entt::entity> m_PendingPhysicsBodies;
 	Bool m_IsTickingActors = false;
 	Bool m_bHasBegunPlay = false;
 	World* m_World = nullptr;
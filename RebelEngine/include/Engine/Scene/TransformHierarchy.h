@@ -0,0 +1,105 @@
+// TransformHierarchy.h
+#pragma once
+
+#include <cstdint>
+
+#include "Core/Containers/TArray.h"
+#include "Core/Math/CoreMath.h"
+
+// Scene-owned structure-of-arrays transform store.
+//
+// Every SceneComponent registered with a Scene owns one entry, addressed by a
+// stable id. The dense arrays are kept sorted by depth, so a parent always
+// precedes its children and world matrices can be resolved one depth level at
+// a time with a flat loop over contiguous data. Structural changes patch the
+// levels in place: an entry changing depth is moved by shifting one entry per
+// level boundary, so reparenting costs O(subtree * depth) rather than a resort
+// of the whole scene. Large levels are split across the engine JobSystem.
+class TransformHierarchy
+{
+public:
+	static constexpr uint32 kInvalidId = UINT32_MAX;
+
+	// Levels with fewer entries than this are resolved on the calling thread.
+	static constexpr MemSize kParallelLevelThreshold = 4096;
+	static constexpr MemSize kParallelGrain = 1024;
+
+	TransformHierarchy() = default;
+	TransformHierarchy(const TransformHierarchy&) = delete;
+	TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+	// ---------- Entries ----------
+	uint32 Add(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+	// Children still linked to the entry become roots.
+	void Remove(uint32 id);
+
+	// parentId == kInvalidId makes the entry a root.
+	void SetParent(uint32 id, uint32 parentId);
+	void SetLocal(uint32 id, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+	void MarkDirty(uint32 id) { m_Dirty[m_DenseIndex[id]] = 1; }
+	Bool IsDirty(uint32 id) const { return m_Dirty[m_DenseIndex[id]] != 0; }
+
+	// Read-only, so jobs may call them while Update() is not running. A dirty
+	// entry is composed from its ancestors on the fly; nothing is cached
+	// until the next Update().
+	Mat4 GetWorldMatrix(uint32 id) const;
+	Vector3 GetWorldPosition(uint32 id) const;
+	Quaternion GetWorldRotation(uint32 id) const;
+	Vector3 GetWorldScale(uint32 id) const;
+	uint32 GetDepth(uint32 id) const { return m_Depth[m_DenseIndex[id]]; }
+
+	// ---------- Update ----------
+	// Recomputes every dirty entry level by level. Must run on the game thread.
+	void Update();
+
+	uint32 Num() const { return static_cast<uint32>(m_Ids.Num()); }
+	uint32 GetLevelCount() const { return m_LevelStart.IsEmpty() ? 0u : static_cast<uint32>(m_LevelStart.Num() - 1); }
+
+private:
+	struct WorldValues
+	{
+		Mat4 Matrix;
+		Vector3 Position;
+		Quaternion Rotation;
+		Vector3 Scale;
+	};
+
+	void ResolveLevel(uint32 begin, uint32 end);
+	void ComputeWorld(uint32 index);
+	WorldValues EvaluateWorld(uint32 index) const;
+
+	// Level bookkeeping. InsertIntoLevel returns the freed slot at the end of
+	// the level; RemoveFromLevel leaves the arrays one entry shorter.
+	uint32 InsertIntoLevel(uint32 depth);
+	void RemoveFromLevel(uint32 index);
+	void MoveEntry(uint32 from, uint32 to);
+	void SetDepth(uint32 id, uint32 depth);
+
+	void LinkChild(uint32 id, uint32 parentId);
+	void UnlinkChild(uint32 id);
+	void MarkSubtreeDirty(uint32 id);
+
+	// ---------- Dense SoA (depth-sorted) ----------
+	TArray<Vector3>    m_LocalPosition;
+	TArray<Quaternion> m_LocalRotation;
+	TArray<Vector3>    m_LocalScale;
+	TArray<Mat4>       m_WorldMatrix;
+	TArray<Vector3>    m_WorldPosition;
+	TArray<Quaternion> m_WorldRotation;
+	TArray<Vector3>    m_WorldScale;
+	TArray<uint32>     m_ParentId; // kInvalidId for roots; ids survive entries moving
+	TArray<uint16>     m_Depth;
+	TArray<uint8>      m_Dirty;
+	TArray<uint32>     m_Ids;      // dense -> id
+
+	// ---------- Per id ----------
+	TArray<uint32> m_DenseIndex;   // id -> dense index, kInvalidId once removed
+	TArray<uint32> m_FirstChild;
+	TArray<uint32> m_NextSibling;
+	TArray<uint32> m_PrevSibling;
+	TArray<uint32> m_FreeIds;
+
+	// Level d spans [m_LevelStart[d], m_LevelStart[d + 1]).
+	TArray<uint32> m_LevelStart;
+};
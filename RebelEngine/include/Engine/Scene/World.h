@@ -11,6 +11,7 @@ class ModuleManager;
 class PhysicsModule;
 class PhysicsSystem;
 class GameMode;
+class CharacterMovementComponent;
 
 class REBELENGINE_API World
 {
@@ -41,6 +42,12 @@ public:
     void ClearTimer(TimerHandle& handle);
     bool IsTimerActive(const TimerHandle& handle) const;
 
+    // Characters with parallel movement queue themselves from their tick. The
+    // scene flushes the queue after each tick group: movement is simulated on
+    // the job system, then poses are written back here in queue order.
+    void QueueCharacterMovement(CharacterMovementComponent& movement);
+    void FlushCharacterMovement();
+
     PhysicsSystem* TryGetPhysics() const;
     PhysicsSystem& GetPhysics() const;
 
@@ -49,6 +56,11 @@ public:
     bool SphereTraceSingle(const Vector3& start, const Vector3& end, float radius, TraceHit& outHit, const TraceQueryParams& params) const;
     bool CapsuleTraceSingle(const Vector3& start, const Vector3& end, float halfHeight, float radius, TraceHit& outHit, const TraceQueryParams& params) const;
     bool BoxTraceSingle(const Vector3& start, const Vector3& end, const Vector3& halfExtents, const Quaternion& rotation, TraceHit& outHit, const TraceQueryParams& params) const;
+    uint32 RunSceneQueries(const SceneQuery* queries, SceneQueryResult* outResults, uint32 count) const;
+    bool OverlapSphereMulti(const Vector3& center, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+    bool OverlapCapsuleMulti(const Vector3& center, float halfHeight, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+    bool OverlapBoxMulti(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
+    bool QueryAABB(const Vector3& min, const Vector3& max, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const;
 
 private:
     struct TimerData
@@ -72,6 +84,7 @@ private:
     uint64 m_CurrentFrameId = 0;
     uint64 m_NextTimerId = 1;
     std::vector<TimerData> m_Timers;
+    std::vector<CharacterMovementComponent*> m_QueuedCharacterMovement;
 };
 
 #include "Engine/Scene/Scene.h"
@@ -4,6 +4,7 @@
 #include "Engine/Assets/AssetManagerModule.h"
 #include "Engine/Framework/BaseEngine.h"
 
+#include <atomic>
 #include <cmath>
 #include <functional>
 
@@ -344,6 +345,284 @@ void CollectPoseSubtreeNodeIDs(const AnimGraphAsset& graph, const uint64 nodeID,
         CollectPoseSubtreeNodeIDs(graph, node->InputB, outNodeIDs);
     }
 }
+
+std::atomic<uint32> GNextAnimGraphProgramRevision{1};
+
+// Flattens the authored graph into an AnimGraphProgram. Runs once per
+// Compile(), so the name and ID searches here never reach the frame loop.
+struct AnimGraphCompiler
+{
+    const AnimGraphAsset& Graph;
+    AnimGraphProgram& Program;
+    TArray<String> BindingNames;
+    TArray<uint64> Path;
+
+    int32 ResolveProperty(const String& name)
+    {
+        if (name.length() == 0)
+            return -1;
+
+        for (int32 i = 0; i < static_cast<int32>(BindingNames.Num()); ++i)
+        {
+            if (BindingNames[i] == name)
+                return i;
+        }
+
+        const Rebel::Core::Reflection::PropertyInfo* prop = FindPropertyByName(Program.InstanceType, name);
+        if (!prop)
+            return -1;
+
+        AnimPropertyBinding& binding = Program.Bindings.Emplace();
+        binding.Offset = prop->Offset;
+        binding.Size = prop->Size;
+        binding.Type = prop->Type;
+        BindingNames.Add(name);
+        return static_cast<int32>(Program.Bindings.Num() - 1);
+    }
+
+    int32 ResolveBlendSlot(const uint64 scopeID, const uint64 nodeID)
+    {
+        for (int32 i = 0; i < static_cast<int32>(Program.BlendSlotScopes.Num()); ++i)
+        {
+            if (Program.BlendSlotScopes[i] == scopeID && Program.BlendSlotNodes[i] == nodeID)
+                return i;
+        }
+
+        Program.BlendSlotScopes.Add(scopeID);
+        Program.BlendSlotNodes.Add(nodeID);
+        return static_cast<int32>(Program.BlendSlotScopes.Num() - 1);
+    }
+
+    void AddConditions(const TArray<AnimTransitionCondition>& conditions, int32& outFirst, int32& outCount)
+    {
+        outFirst = static_cast<int32>(Program.Conditions.Num());
+        for (const AnimTransitionCondition& condition : conditions)
+        {
+            AnimProgramCondition& compiled = Program.Conditions.Emplace();
+            compiled.Op = condition.Op;
+            compiled.FloatValue = condition.FloatValue;
+            compiled.IntValue = condition.IntValue;
+            compiled.Property = ResolveProperty(condition.PropertyName);
+        }
+        outCount = static_cast<int32>(Program.Conditions.Num()) - outFirst;
+    }
+
+    int32 FindStateIndex(const AnimProgramStateMachine& stateMachine, const uint64 stateID) const
+    {
+        for (int32 i = stateMachine.FirstState; i < stateMachine.FirstState + stateMachine.StateCount; ++i)
+        {
+            if (Program.States[i].ID == stateID)
+                return i;
+        }
+        return -1;
+    }
+
+    int32 FindStateMachineIndex(const uint64 stateMachineID) const
+    {
+        for (int32 i = 0; i < static_cast<int32>(Program.StateMachines.Num()); ++i)
+        {
+            if (Program.StateMachines[i].ID == stateMachineID)
+                return i;
+        }
+        return -1;
+    }
+
+    void EmitMissing(const uint64 nodeID)
+    {
+        AnimProgramNode& node = Program.Nodes.Emplace();
+        node.Op = AnimProgramOp::Missing;
+        node.NodeID = nodeID;
+    }
+
+    // Emits the subtree under nodeID in post-order. poseGraph is null for the
+    // root graph. Shared inputs are emitted once per use; a node already on
+    // the current path (a cycle) compiles to Missing, as it failed before.
+    void EmitPose(const AnimPoseGraph* poseGraph, const uint64 nodeID, const uint64 scopeID, TArray<int32>* outClips)
+    {
+        const AnimGraphNode* source = poseGraph ? Graph.FindNode(*poseGraph, nodeID) : Graph.FindNode(nodeID);
+        if (!source || ContainsNodeID(Path, nodeID))
+        {
+            EmitMissing(nodeID);
+            return;
+        }
+
+        Path.Add(nodeID);
+        switch (source->Kind)
+        {
+        case AnimGraphNodeKind::Output:
+            EmitPose(poseGraph, source->InputPose, scopeID, outClips);
+            break;
+        case AnimGraphNodeKind::AnimationClip:
+        {
+            AnimProgramNode& node = Program.Nodes.Emplace();
+            node.Op = AnimProgramOp::Clip;
+            node.NodeID = source->ID;
+            node.AnimationClip = source->AnimationClip;
+            node.ClipStartTime = FMath::max(0.0f, source->ClipStartTime);
+            if (outClips)
+                outClips->Add(static_cast<int32>(Program.Nodes.Num() - 1));
+            break;
+        }
+        case AnimGraphNodeKind::Blend:
+        {
+            EmitPose(poseGraph, source->InputA, scopeID, outClips);
+            EmitPose(poseGraph, source->InputB, scopeID, outClips);
+
+            AnimProgramNode& node = Program.Nodes.Emplace();
+            node.Op = AnimProgramOp::Blend;
+            node.NodeID = source->ID;
+            node.BlendAlphaMode = source->BlendAlphaMode;
+            node.BlendAlpha = source->BlendAlpha;
+            node.BlendInputMin = source->BlendInputMin;
+            node.BlendInputMax = source->BlendInputMax;
+            node.BlendTime = FMath::max(0.0f, source->BlendTime);
+            node.bBlendInvertBool = source->bBlendInvertBool;
+            node.BlendProperty = ResolveProperty(source->BlendParameterName);
+            node.BlendSlot = node.BlendTime > 1.0e-6f ? ResolveBlendSlot(scopeID, source->ID) : -1;
+            break;
+        }
+        case AnimGraphNodeKind::StateMachine:
+        {
+            // State machines only run from the root graph.
+            const int32 stateMachineIndex = poseGraph ? -1 : FindStateMachineIndex(source->StateMachineID);
+            if (stateMachineIndex < 0 || Program.StateMachines[stateMachineIndex].StateCount == 0)
+            {
+                EmitMissing(source->ID);
+                break;
+            }
+
+            AnimProgramNode& node = Program.Nodes.Emplace();
+            node.Op = AnimProgramOp::StateMachine;
+            node.NodeID = source->ID;
+            node.StateMachine = stateMachineIndex;
+            break;
+        }
+        default:
+            EmitMissing(source->ID);
+            break;
+        }
+        Path.PopBack();
+    }
+
+    void CompileStateMachine(const AnimStateMachine& source)
+    {
+        AnimProgramStateMachine& stateMachine = Program.StateMachines.Emplace();
+        stateMachine.ID = source.ID;
+        stateMachine.FirstState = static_cast<int32>(Program.States.Num());
+        stateMachine.StateCount = static_cast<int32>(source.States.Num());
+        for (const AnimState& state : source.States)
+        {
+            AnimProgramState& compiled = Program.States.Emplace();
+            compiled.ID = state.ID;
+            compiled.bLoop = state.bLoop;
+        }
+
+        if (source.EntryStateID != 0)
+            stateMachine.EntryState = FindStateIndex(stateMachine, source.EntryStateID);
+        else if (stateMachine.StateCount > 0)
+            stateMachine.EntryState = stateMachine.FirstState;
+
+        TArray<int32> clips;
+        for (int32 i = 0; i < stateMachine.StateCount; ++i)
+        {
+            const AnimState& state = source.States[i];
+            const int32 stateIndex = stateMachine.FirstState + i;
+            const uint64 scopeID = (source.ID << 32) ^ state.ID;
+
+            clips.Clear();
+            const int32 firstNode = static_cast<int32>(Program.Nodes.Num());
+            if (const AnimGraphNode* output = Graph.FindOutputNode(state.StateGraph))
+            {
+                Path.Clear();
+                Path.Add(output->ID);
+                EmitPose(&state.StateGraph, output->InputPose, scopeID, &clips);
+            }
+
+            const int32 firstTransition = static_cast<int32>(Program.Transitions.Num());
+            for (const AnimTransition& transition : source.Transitions)
+            {
+                if (transition.FromStateID != state.ID)
+                    continue;
+
+                const int32 toState = FindStateIndex(stateMachine, transition.ToStateID);
+                if (toState < 0)
+                    continue;
+
+                int32 firstCondition = 0;
+                int32 conditionCount = 0;
+                AddConditions(transition.Conditions, firstCondition, conditionCount);
+
+                AnimProgramTransition& compiled = Program.Transitions.Emplace();
+                compiled.ToState = toState;
+                compiled.BlendDuration = FMath::max(0.0f, transition.BlendDuration);
+                compiled.FirstCondition = firstCondition;
+                compiled.ConditionCount = conditionCount;
+            }
+
+            AnimProgramState& compiled = Program.States[stateIndex];
+            compiled.FirstNode = firstNode;
+            compiled.NodeCount = static_cast<int32>(Program.Nodes.Num()) - firstNode;
+            compiled.FirstTransition = firstTransition;
+            compiled.TransitionCount = static_cast<int32>(Program.Transitions.Num()) - firstTransition;
+            compiled.FirstClip = static_cast<int32>(Program.StateClips.Num());
+            compiled.ClipCount = static_cast<int32>(clips.Num());
+            for (const int32 clip : clips)
+                Program.StateClips.Add(clip);
+        }
+
+        stateMachine.FirstAlias = static_cast<int32>(Program.Aliases.Num());
+        for (const AnimStateAlias& alias : source.Aliases)
+        {
+            AnimProgramAlias compiled;
+            compiled.bGlobal = alias.bGlobalAlias;
+            compiled.FirstAllowedState = static_cast<int32>(Program.AllowedStates.Num());
+            for (const uint64 allowedStateID : alias.AllowedFromStateIDs)
+            {
+                const int32 allowedState = FindStateIndex(stateMachine, allowedStateID);
+                if (allowedState >= 0)
+                    Program.AllowedStates.Add(allowedState);
+            }
+            compiled.AllowedStateCount = static_cast<int32>(Program.AllowedStates.Num()) - compiled.FirstAllowedState;
+            AddConditions(alias.Conditions, compiled.FirstCondition, compiled.ConditionCount);
+
+            // Same precedence as the authoring data: explicit targets, then
+            // the plain target list, then the legacy single target.
+            compiled.FirstTarget = static_cast<int32>(Program.Transitions.Num());
+            auto addTarget = [&](const uint64 stateID, const float blendDuration, const TArray<AnimTransitionCondition>* conditions)
+            {
+                const int32 toState = stateID != 0 ? FindStateIndex(stateMachine, stateID) : -1;
+                if (toState < 0)
+                    return;
+
+                AnimProgramTransition target;
+                target.ToState = toState;
+                target.BlendDuration = FMath::max(0.0f, blendDuration);
+                target.FirstCondition = static_cast<int32>(Program.Conditions.Num());
+                if (conditions)
+                    AddConditions(*conditions, target.FirstCondition, target.ConditionCount);
+                Program.Transitions.Add(target);
+            };
+
+            if (!alias.Targets.IsEmpty())
+            {
+                for (const AnimStateAliasTarget& target : alias.Targets)
+                    addTarget(target.StateID, target.BlendDuration, &target.Conditions);
+            }
+            else if (!alias.TargetStateIDs.IsEmpty())
+            {
+                for (const uint64 targetStateID : alias.TargetStateIDs)
+                    addTarget(targetStateID, alias.BlendDuration, nullptr);
+            }
+            else
+            {
+                addTarget(alias.ToStateID, alias.BlendDuration, nullptr);
+            }
+            compiled.TargetCount = static_cast<int32>(Program.Transitions.Num()) - compiled.FirstTarget;
+            Program.Aliases.Add(compiled);
+        }
+        stateMachine.AliasCount = static_cast<int32>(Program.Aliases.Num()) - stateMachine.FirstAlias;
+    }
+};
 }
 
 const char* ToString(const AnimGraphNodeKind kind)
@@ -774,6 +1053,34 @@ void AnimGraphAsset::PostLoad()
         if (!IsNodeReachableFromOutput(nodeID))
             RemoveNode(nodeID);
     }
+
+    Compile();
+}
+
+void AnimGraphAsset::Compile()
+{
+    m_Program = AnimGraphProgram{};
+    m_Program.InstanceType = m_AnimInstanceClass.Get() ? m_AnimInstanceClass.Get() : LocomotionAnimInstance::StaticType();
+
+    AnimGraphCompiler compiler{*this, m_Program};
+
+    // State machines first so root nodes can refer to them by index.
+    for (const AnimStateMachine& stateMachine : m_StateMachines)
+        compiler.CompileStateMachine(stateMachine);
+
+    m_Program.RootFirstNode = static_cast<int32>(m_Program.Nodes.Num());
+    if (const AnimGraphNode* output = FindOutputNode())
+    {
+        compiler.Path.Clear();
+        compiler.Path.Add(output->ID);
+        compiler.EmitPose(nullptr, output->InputPose, 0, nullptr);
+    }
+    m_Program.RootNodeCount = static_cast<int32>(m_Program.Nodes.Num()) - m_Program.RootFirstNode;
+
+    // Every op pushes at most one pose and a state machine needs one more slot
+    // for the outgoing state, so this bounds any root + state segment nesting.
+    m_Program.MaxPoseStackDepth = static_cast<int32>(m_Program.Nodes.Num()) + 2;
+    m_Program.Revision = GNextAnimGraphProgramRevision.fetch_add(1);
 }
 
 AnimGraphNode& AnimGraphAsset::AddNode(AnimGraphNodeKind kind, const String& name)
@@ -84,8 +84,10 @@ const AnimationAsset* AnimInstance::ResolveAnimationAsset(
     if (!context.AssetManager || (uint64)asset.GetHandle() == 0)
         return nullptr;
 
+    // Runs inside evaluate jobs: a clip that is not resident yet is only
+    // queued, and the caller falls back until it has streamed in.
     AnimationAsset* animation =
-        dynamic_cast<AnimationAsset*>(context.AssetManager->Load(asset.GetHandle()));
+        dynamic_cast<AnimationAsset*>(context.AssetManager->GetOrLoadAsync(asset.GetHandle()));
     if (!animation)
         return nullptr;
 
@@ -11,16 +11,6 @@ namespace
         if (count > 0)
             ar.WriteBytes(values.Data(), count * sizeof(T));
     }
-
-    template<typename T>
-    void ReadRawArray(BinaryReader& ar, TArray<T>& values)
-    {
-        uint32 count = 0;
-        ar >> count;
-        values.Resize(count);
-        if (count > 0)
-            ar.ReadBytes(values.Data(), count * sizeof(T));
-    }
 }
 
 AnimationAsset::AnimationAsset()
@@ -73,9 +63,9 @@ void AnimationAsset::Deserialize(BinaryReader& ar)
         AnimationTrack& track = m_Tracks[i];
         ar >> track.BoneName;
         ar >> track.BoneIndex;
-        ReadRawArray(ar, track.PositionKeys);
-        ReadRawArray(ar, track.RotationKeys);
-        ReadRawArray(ar, track.ScaleKeys);
+        ar >> track.PositionKeys;
+        ar >> track.RotationKeys;
+        ar >> track.ScaleKeys;
     }
 
     m_RootDriver.bEnabled = false;
@@ -94,9 +84,9 @@ void AnimationAsset::Deserialize(BinaryReader& ar)
         ar >> m_RootDriver.bAffectsRotation;
         ar >> m_RootDriver.bAffectsScale;
         ar >> m_RootDriver.NodeName;
-        ReadRawArray(ar, m_RootDriver.PositionKeys);
-        ReadRawArray(ar, m_RootDriver.RotationKeys);
-        ReadRawArray(ar, m_RootDriver.ScaleKeys);
+        ar >> m_RootDriver.PositionKeys;
+        ar >> m_RootDriver.RotationKeys;
+        ar >> m_RootDriver.ScaleKeys;
     }
     else
     {
@@ -127,6 +117,34 @@ void AnimationAsset::PostLoad()
     Asset::PostLoad();
 }
 
+void AnimationAsset::DetachSourceViews()
+{
+    for (AnimationTrack& track : m_Tracks)
+    {
+        track.PositionKeys.DetachView();
+        track.RotationKeys.DetachView();
+        track.ScaleKeys.DetachView();
+    }
+
+    m_RootDriver.PositionKeys.DetachView();
+    m_RootDriver.RotationKeys.DetachView();
+    m_RootDriver.ScaleKeys.DetachView();
+}
+
+MemSize AnimationAsset::GetMemorySize() const
+{
+    MemSize bytes = Asset::GetMemorySize() + m_ClipName.length() + m_Tracks.GetAllocatedSize();
+    for (const AnimationTrack& track : m_Tracks)
+    {
+        bytes += track.BoneName.length() + track.PositionKeys.GetAllocatedSize() +
+                 track.RotationKeys.GetAllocatedSize() + track.ScaleKeys.GetAllocatedSize();
+    }
+
+    bytes += m_RootDriver.NodeName.length() + m_RootDriver.PositionKeys.GetAllocatedSize() +
+             m_RootDriver.RotationKeys.GetAllocatedSize() + m_RootDriver.ScaleKeys.GetAllocatedSize();
+    return bytes;
+}
+
 const AnimationTrack* AnimationAsset::FindTrackForBone(int32 boneIndex) const
 {
     for (const AnimationTrack& track : m_Tracks)
@@ -2,6 +2,7 @@
 #include "Engine/Animation/AnimationModule.h"
 
 #include <cmath>
+#include <mutex>
 #include <unordered_set>
 
 #include "Engine/Animation/AnimationAsset.h"
@@ -18,6 +19,7 @@
 #include "Engine/Gameplay/Framework/CharacterMovementComponent.h"
 #include "Engine/Gameplay/Framework/LocomotionCharacter.h"
 #include "Engine/Scene/Scene.h"
+#include "Core/MultiThreading/JobSystem.h"
 
 namespace
 {
@@ -282,112 +284,12 @@ void BlendLocalPoses(
     }
 }
 
-const Rebel::Core::Reflection::PropertyInfo* FindAnimInstanceProperty(
-    const AnimInstance* animInstance,
-    const String& propertyName)
-{
-    if (!animInstance || propertyName.length() == 0)
-        return nullptr;
-
-    const Rebel::Core::Reflection::TypeInfo* type = animInstance->GetType();
-    while (type)
-    {
-        for (const Rebel::Core::Reflection::PropertyInfo& prop : type->Properties)
-        {
-            if (prop.Name == propertyName)
-                return &prop;
-        }
-        type = type->Super;
-    }
-
-    return nullptr;
-}
-
-uint64 MakeStatePoseGraphRuntimeScopeID(const uint64 stateMachineID, const uint64 stateID)
-{
-    return (stateMachineID << 32) ^ stateID;
-}
-
-float ResolveBlendAlphaTarget(const AnimGraphNode& node, const AnimInstance* animInstance)
-{
-    const float fallbackAlpha = FMath::clamp(node.BlendAlpha, 0.0f, 1.0f);
-    using Rebel::Core::Reflection::EPropertyType;
-
-    const Rebel::Core::Reflection::PropertyInfo* prop = FindAnimInstanceProperty(animInstance, node.BlendParameterName);
-    if (!prop)
-        return fallbackAlpha;
-
-    const uint8* base = reinterpret_cast<const uint8*>(animInstance);
-    const void* valuePtr = base + prop->Offset;
-    switch (node.BlendAlphaMode)
-    {
-    case AnimBlendAlphaMode::FloatProperty:
-    {
-        if (prop->Type != EPropertyType::Float)
-            return fallbackAlpha;
-
-        const float range = node.BlendInputMax - node.BlendInputMin;
-        if (std::fabs(range) <= 1.0e-6f)
-            return fallbackAlpha;
-
-        const float value = *reinterpret_cast<const float*>(valuePtr);
-        return FMath::clamp((value - node.BlendInputMin) / range, 0.0f, 1.0f);
-    }
-    case AnimBlendAlphaMode::BoolProperty:
-    {
-        if (prop->Type != EPropertyType::Bool)
-            return fallbackAlpha;
-
-        bool value = *reinterpret_cast<const bool*>(valuePtr);
-        if (node.bBlendInvertBool)
-            value = !value;
-        return value ? 1.0f : 0.0f;
-    }
-    case AnimBlendAlphaMode::Fixed:
-    default:
-        return fallbackAlpha;
-    }
-}
-
-float ResolveBlendAlpha(
-    SkeletalMeshComponent* skComp,
-    const uint64 runtimeScopeID,
-    const AnimGraphNode& node,
-    const AnimInstance* animInstance,
-    const float dt)
-{
-    const float targetAlpha = ResolveBlendAlphaTarget(node, animInstance);
-    const float blendTime = FMath::max(0.0f, node.BlendTime);
-    if (!skComp || blendTime <= 1.0e-6f || dt <= 0.0f)
-        return targetAlpha;
-
-    AnimBlendNodeRuntime& runtime = skComp->GetBlendNodeRuntime(runtimeScopeID, node.ID);
-    if (!runtime.bInitialized)
-    {
-        runtime.CurrentAlpha = targetAlpha;
-        runtime.bInitialized = true;
-        return runtime.CurrentAlpha;
-    }
-
-    const float delta = targetAlpha - runtime.CurrentAlpha;
-    const float maxStep = dt / blendTime;
-    if (std::fabs(delta) <= maxStep)
-        runtime.CurrentAlpha = targetAlpha;
-    else
-        runtime.CurrentAlpha += delta > 0.0f ? maxStep : -maxStep;
-
-    runtime.CurrentAlpha = FMath::clamp(runtime.CurrentAlpha, 0.0f, 1.0f);
-    return runtime.CurrentAlpha;
-}
-
-int32 ReadEnumPropertyValueAsInt(
-    const Rebel::Core::Reflection::PropertyInfo& prop,
-    const void* valuePtr)
+int32 ReadEnumPropertyValueAsInt(const MemSize size, const void* valuePtr)
 {
     if (!valuePtr)
         return 0;
 
-    switch (prop.Size)
+    switch (size)
     {
     case sizeof(uint8):
         return static_cast<int32>(*reinterpret_cast<const uint8*>(valuePtr));
@@ -402,349 +304,343 @@ int32 ReadEnumPropertyValueAsInt(
     }
 }
 
-float GetPoseGraphClipDuration(
-    AssetManager& assetManager,
-    const AnimGraphAsset& graph,
-    const AnimPoseGraph& poseGraph,
-    uint64 nodeID,
-    TArray<uint64>& visited)
+// Lays the component's state machine and blend runtimes out in program order.
+// Entries are carried over by ID so a recompile in the editor keeps state.
+void SyncAnimGraphRuntime(SkeletalMeshComponent& skComp, const AnimGraphProgram& program)
 {
-    if (nodeID == 0)
-        return 0.0f;
-    for (const uint64 visitedID : visited)
+    if (skComp.GraphProgramRevision == program.Revision &&
+        skComp.StateMachineRuntimes.Num() == program.StateMachines.Num() &&
+        skComp.BlendNodeRuntimes.Num() == program.BlendSlotScopes.Num())
     {
-        if (visitedID == nodeID)
-            return 0.0f;
+        return;
     }
-    visited.Add(nodeID);
 
-    const AnimGraphNode* node = graph.FindNode(poseGraph, nodeID);
-    if (!node)
-        return 0.0f;
+    auto findStateIndex = [&](const AnimProgramStateMachine& stateMachine, const uint64 stateID) -> int32
+    {
+        for (int32 i = stateMachine.FirstState; i < stateMachine.FirstState + stateMachine.StateCount; ++i)
+        {
+            if (program.States[i].ID == stateID)
+                return i;
+        }
+        return -1;
+    };
 
-    if (node->Kind == AnimGraphNodeKind::AnimationClip && IsValidAssetHandle(node->AnimationClip))
+    TArray<AnimStateMachineRuntime> stateMachines;
+    stateMachines.Resize(program.StateMachines.Num());
+    for (MemSize i = 0; i < program.StateMachines.Num(); ++i)
     {
-        const AnimationAsset* animation = dynamic_cast<const AnimationAsset*>(assetManager.Load(node->AnimationClip));
-        if (!animation)
-            return 0.0f;
+        const AnimProgramStateMachine& stateMachine = program.StateMachines[i];
+        AnimStateMachineRuntime& runtime = stateMachines[i];
+        runtime.StateMachineID = stateMachine.ID;
+        for (const AnimStateMachineRuntime& previous : skComp.StateMachineRuntimes)
+        {
+            if (previous.StateMachineID == stateMachine.ID)
+            {
+                runtime = previous;
+                break;
+            }
+        }
 
-        const float clipStartTime = FMath::max(0.0f, node->ClipStartTime);
-        return FMath::max(0.0f, animation->m_DurationSeconds - clipStartTime);
+        runtime.CurrentStateIndex = findStateIndex(stateMachine, runtime.CurrentStateID);
+        runtime.PreviousStateIndex = findStateIndex(stateMachine, runtime.PreviousStateID);
     }
 
-    if (node->Kind == AnimGraphNodeKind::Blend)
+    TArray<AnimBlendNodeRuntime> blendNodes;
+    blendNodes.Resize(program.BlendSlotScopes.Num());
+    for (MemSize i = 0; i < program.BlendSlotScopes.Num(); ++i)
     {
-        const float durationA = GetPoseGraphClipDuration(assetManager, graph, poseGraph, node->InputA, visited);
-        const float durationB = GetPoseGraphClipDuration(assetManager, graph, poseGraph, node->InputB, visited);
-        return FMath::max(durationA, durationB);
+        AnimBlendNodeRuntime& runtime = blendNodes[i];
+        runtime.ScopeID = program.BlendSlotScopes[i];
+        runtime.NodeID = program.BlendSlotNodes[i];
+        for (const AnimBlendNodeRuntime& previous : skComp.BlendNodeRuntimes)
+        {
+            if (previous.ScopeID == runtime.ScopeID && previous.NodeID == runtime.NodeID)
+            {
+                runtime = previous;
+                break;
+            }
+        }
     }
 
-    if (node->Kind == AnimGraphNodeKind::Output)
-        return GetPoseGraphClipDuration(assetManager, graph, poseGraph, node->InputPose, visited);
-
-    return 0.0f;
+    skComp.StateMachineRuntimes = std::move(stateMachines);
+    skComp.BlendNodeRuntimes = std::move(blendNodes);
+    skComp.GraphProgramRevision = program.Revision;
 }
 
-bool EvaluateStatePoseGraphNode(
-    SkeletalMeshComponent* skComp,
-    AnimInstance* animInstance,
-    AssetManager& assetManager,
-    const AnimGraphAsset& graph,
-    const AnimPoseGraph& poseGraph,
-    const AnimGraphNode& node,
-    const SkeletonAsset* skeleton,
-    const TArray<Mat4>& localBindPose,
-    const float playbackTime,
-    const float dt,
-    const bool bApplyRootMotion,
-    TArray<Mat4>& outLocalPose,
-    TArray<uint64>& visited,
-    const bool bLooping,
-    const uint64 runtimeScopeID,
-    AnimationEvaluationTrace* trace)
+// Runs a compiled AnimGraphProgram on one component. Poses live on the
+// component's GraphPoseStack, which is sized once per program, so a frame
+// does no lookups by name or ID and no pose allocations after warm-up.
+struct AnimGraphEvaluator
 {
-    for (const uint64 visitedID : visited)
+    SkeletalMeshComponent& Component;
+    const AnimGraphProgram& Program;
+    const uint8* InstanceBase;
+    AssetManager& Assets;
+    const SkeletonAsset* Skeleton;
+    const TArray<Mat4>& LocalBindPose;
+    float Dt;
+    bool bApplyRootMotion;
+    AnimationEvaluationTrace* Trace;
+
+    const AnimPropertyBinding* GetBinding(const int32 property) const
     {
-        if (visitedID == node.ID)
-            return false;
+        return InstanceBase && property >= 0 ? &Program.Bindings[property] : nullptr;
     }
-    visited.Add(node.ID);
 
-    switch (node.Kind)
+    float ResolveBlendAlphaTarget(const AnimProgramNode& node) const
     {
-    case AnimGraphNodeKind::AnimationClip:
-    {
-        AnimationAsset* animation = nullptr;
-        if (IsValidAssetHandle(node.AnimationClip))
-            animation = dynamic_cast<AnimationAsset*>(assetManager.Load(node.AnimationClip));
+        const float fallbackAlpha = FMath::clamp(node.BlendAlpha, 0.0f, 1.0f);
+        using Rebel::Core::Reflection::EPropertyType;
 
-        if (animation &&
-            (uint64)animation->m_SkeletonID != 0 &&
-            (uint64)animation->m_SkeletonID != (uint64)skeleton->ID)
+        const AnimPropertyBinding* binding = GetBinding(node.BlendProperty);
+        if (!binding)
+            return fallbackAlpha;
+
+        const void* valuePtr = InstanceBase + binding->Offset;
+        switch (node.BlendAlphaMode)
         {
-            animation = nullptr;
-        }
+        case AnimBlendAlphaMode::FloatProperty:
+        {
+            if (binding->Type != EPropertyType::Float)
+                return fallbackAlpha;
 
-        const float sampleTime = animation
-            ? AnimationRuntime::NormalizePlaybackTime(
-                playbackTime + FMath::max(0.0f, node.ClipStartTime),
-                animation->m_DurationSeconds,
-                bLooping)
-            : 0.0f;
+            const float range = node.BlendInputMax - node.BlendInputMin;
+            if (std::fabs(range) <= 1.0e-6f)
+                return fallbackAlpha;
 
-        AppendClipSummary(trace, animation);
+            const float value = *reinterpret_cast<const float*>(valuePtr);
+            return FMath::clamp((value - node.BlendInputMin) / range, 0.0f, 1.0f);
+        }
+        case AnimBlendAlphaMode::BoolProperty:
+        {
+            if (binding->Type != EPropertyType::Bool)
+                return fallbackAlpha;
 
-        return AnimationRuntime::EvaluateLocalPose(
-            skeleton,
-            animation,
-            sampleTime,
-            localBindPose,
-            outLocalPose,
-            bApplyRootMotion);
+            bool value = *reinterpret_cast<const bool*>(valuePtr);
+            if (node.bBlendInvertBool)
+                value = !value;
+            return value ? 1.0f : 0.0f;
+        }
+        case AnimBlendAlphaMode::Fixed:
+        default:
+            return fallbackAlpha;
+        }
     }
-    case AnimGraphNodeKind::Blend:
-    {
-        const AnimGraphNode* inputA = graph.FindNode(poseGraph, node.InputA);
-        const AnimGraphNode* inputB = graph.FindNode(poseGraph, node.InputB);
-        if (!inputA && !inputB)
-            return false;
 
-        TArray<Mat4> poseA = localBindPose;
-        TArray<Mat4> poseB = localBindPose;
-        TArray<uint64> visitedA = visited;
-        TArray<uint64> visitedB = visited;
-        const bool hasA = inputA && EvaluateStatePoseGraphNode(
-            skComp, animInstance, assetManager, graph, poseGraph, *inputA, skeleton, localBindPose, playbackTime, dt, bApplyRootMotion, poseA, visitedA, bLooping, runtimeScopeID, trace);
-        const bool hasB = inputB && EvaluateStatePoseGraphNode(
-            skComp, animInstance, assetManager, graph, poseGraph, *inputB, skeleton, localBindPose, playbackTime, dt, bApplyRootMotion, poseB, visitedB, bLooping, runtimeScopeID, trace);
+    float ResolveBlendAlpha(const AnimProgramNode& node)
+    {
+        const float targetAlpha = ResolveBlendAlphaTarget(node);
+        if (node.BlendSlot < 0 || Dt <= 0.0f)
+            return targetAlpha;
 
-        if (hasA && hasB)
+        AnimBlendNodeRuntime& runtime = Component.BlendNodeRuntimes[node.BlendSlot];
+        if (!runtime.bInitialized)
         {
-            BlendLocalPoses(poseA, poseB, ResolveBlendAlpha(skComp, runtimeScopeID, node, animInstance, dt), outLocalPose);
-            return true;
+            runtime.CurrentAlpha = targetAlpha;
+            runtime.bInitialized = true;
+            return runtime.CurrentAlpha;
         }
 
-        outLocalPose = hasA ? poseA : poseB;
-        return hasA || hasB;
+        const float delta = targetAlpha - runtime.CurrentAlpha;
+        const float maxStep = Dt / node.BlendTime;
+        if (std::fabs(delta) <= maxStep)
+            runtime.CurrentAlpha = targetAlpha;
+        else
+            runtime.CurrentAlpha += delta > 0.0f ? maxStep : -maxStep;
+
+        runtime.CurrentAlpha = FMath::clamp(runtime.CurrentAlpha, 0.0f, 1.0f);
+        return runtime.CurrentAlpha;
     }
-    case AnimGraphNodeKind::Output:
+
+    float GetStateClipDuration(const int32 stateIndex) const
     {
-        const AnimGraphNode* input = graph.FindNode(poseGraph, node.InputPose);
-        if (!input)
-            return false;
+        if (stateIndex < 0)
+            return 0.0f;
 
-        return EvaluateStatePoseGraphNode(
-            skComp,
-            animInstance,
-            assetManager,
-            graph,
-            poseGraph,
-            *input,
-            skeleton,
-            localBindPose,
-            playbackTime,
-            dt,
-            bApplyRootMotion,
-            outLocalPose,
-            visited,
-            bLooping,
-            runtimeScopeID,
-            trace);
-    }
-    default:
-        return false;
+        const AnimProgramState& state = Program.States[stateIndex];
+        float duration = 0.0f;
+        for (int32 i = state.FirstClip; i < state.FirstClip + state.ClipCount; ++i)
+        {
+            const AnimProgramNode& clip = Program.Nodes[Program.StateClips[i]];
+            if (!IsValidAssetHandle(clip.AnimationClip.GetHandle()))
+                continue;
+
+            const AnimationAsset* animation = dynamic_cast<const AnimationAsset*>(Assets.GetOrLoadAsync(clip.AnimationClip.GetHandle()));
+            if (animation)
+                duration = FMath::max(duration, FMath::max(0.0f, animation->m_DurationSeconds - clip.ClipStartTime));
+        }
+        return duration;
     }
-}
 
-bool EvaluateStatePoseGraph(
-    SkeletalMeshComponent* skComp,
-    AnimInstance* animInstance,
-    AssetManager& assetManager,
-    const AnimGraphAsset& graph,
-    const AnimState& state,
-    const SkeletonAsset* skeleton,
-    const TArray<Mat4>& localBindPose,
-    const float playbackTime,
-    const float dt,
-    const bool bApplyRootMotion,
-    TArray<Mat4>& outLocalPose,
-    TArray<uint64>& visited,
-    const uint64 runtimeScopeID,
-    AnimationEvaluationTrace* trace)
-{
-    const AnimGraphNode* output = graph.FindOutputNode(state.StateGraph);
-    if (!output)
-        return false;
+    bool ConditionPasses(const AnimProgramCondition& condition, const AnimStateMachineRuntime& runtime) const
+    {
+        const float stateTime = runtime.StateTime;
+        switch (condition.Op)
+        {
+        case AnimConditionOp::StateTimeGreater:
+            return stateTime > condition.FloatValue;
+        case AnimConditionOp::StateTimeLess:
+            return stateTime < condition.FloatValue;
+        case AnimConditionOp::AnimTimeRemainingLess:
+        case AnimConditionOp::AnimTimeRemainingRatioLess:
+        {
+            const float stateDuration = GetStateClipDuration(runtime.CurrentStateIndex);
+            if (stateDuration <= 1.0e-6f)
+                return false;
 
-    return EvaluateStatePoseGraphNode(
-        skComp,
-        animInstance,
-        assetManager,
-        graph,
-        state.StateGraph,
-        *output,
-        skeleton,
-        localBindPose,
-        playbackTime,
-        dt,
-        bApplyRootMotion,
-        outLocalPose,
-        visited,
-        state.bLoop,
-        runtimeScopeID,
-        trace);
-}
+            const float remainingTime = FMath::max(0.0f, stateDuration - stateTime);
+            return condition.Op == AnimConditionOp::AnimTimeRemainingLess
+                ? remainingTime < condition.FloatValue
+                : remainingTime / stateDuration < condition.FloatValue;
+        }
+        default:
+            break;
+        }
 
-bool EvaluateAnimGraphNode(
-    SkeletalMeshComponent* skComp,
-    AnimInstance* animInstance,
-    AssetManager& assetManager,
-    const AnimGraphAsset& graph,
-    const AnimGraphNode& node,
-    const SkeletonAsset* skeleton,
-    const TArray<Mat4>& localBindPose,
-    const float playbackTime,
-    const float dt,
-    const bool bApplyRootMotion,
-    TArray<Mat4>& outLocalPose,
-    TArray<uint64>& visited,
-    const bool bLooping = true,
-    const uint64 runtimeScopeID = 0,
-    AnimationEvaluationTrace* trace = nullptr)
-{
-    for (uint64 visitedID : visited)
-    {
-        if (visitedID == node.ID)
+        const AnimPropertyBinding* binding = GetBinding(condition.Property);
+        if (!binding)
+            return false;
+
+        const void* valuePtr = InstanceBase + binding->Offset;
+        using Rebel::Core::Reflection::EPropertyType;
+        switch (condition.Op)
+        {
+        case AnimConditionOp::BoolIsTrue:
+            return binding->Type == EPropertyType::Bool && *reinterpret_cast<const bool*>(valuePtr);
+        case AnimConditionOp::BoolIsFalse:
+            return binding->Type == EPropertyType::Bool && !*reinterpret_cast<const bool*>(valuePtr);
+        case AnimConditionOp::FloatGreater:
+            return binding->Type == EPropertyType::Float && *reinterpret_cast<const float*>(valuePtr) > condition.FloatValue;
+        case AnimConditionOp::FloatLess:
+            return binding->Type == EPropertyType::Float && *reinterpret_cast<const float*>(valuePtr) < condition.FloatValue;
+        case AnimConditionOp::IntGreater:
+            return binding->Type == EPropertyType::Int32 && *reinterpret_cast<const int32*>(valuePtr) > condition.IntValue;
+        case AnimConditionOp::IntLess:
+            return binding->Type == EPropertyType::Int32 && *reinterpret_cast<const int32*>(valuePtr) < condition.IntValue;
+        case AnimConditionOp::EnumEquals:
+        case AnimConditionOp::EnumNotEquals:
+        {
+            if (binding->Type != EPropertyType::Enum)
+                return false;
+
+            const bool bEquals = ReadEnumPropertyValueAsInt(binding->Size, valuePtr) == condition.IntValue;
+            return condition.Op == AnimConditionOp::EnumEquals ? bEquals : !bEquals;
+        }
+        default:
             return false;
+        }
     }
-    visited.Add(node.ID);
 
-    switch (node.Kind)
+    bool ConditionsPass(const int32 first, const int32 count, const AnimStateMachineRuntime& runtime) const
     {
-    case AnimGraphNodeKind::AnimationClip:
+        for (int32 i = first; i < first + count; ++i)
+        {
+            if (!ConditionPasses(Program.Conditions[i], runtime))
+                return false;
+        }
+        return true;
+    }
+
+    void EnterState(AnimStateMachineRuntime& runtime, const AnimProgramTransition& transition) const
+    {
+        runtime.PreviousStateIndex = runtime.CurrentStateIndex;
+        runtime.PreviousStateID = runtime.CurrentStateID;
+        runtime.PreviousStateTime = runtime.StateTime;
+        runtime.CurrentStateIndex = transition.ToState;
+        runtime.CurrentStateID = Program.States[transition.ToState].ID;
+        runtime.StateTime = 0.0f;
+        runtime.TransitionTime = 0.0f;
+        runtime.TransitionDuration = transition.BlendDuration;
+        runtime.bTransitionActive = runtime.TransitionDuration > 1.0e-6f;
+    }
+
+    void EvaluateClip(const AnimProgramNode& node, AnimGraphPoseSlot& slot, const float playbackTime, const bool bLooping)
     {
         AnimationAsset* animation = nullptr;
-        if (IsValidAssetHandle(node.AnimationClip))
-            animation = dynamic_cast<AnimationAsset*>(assetManager.Load(node.AnimationClip));
+        if (IsValidAssetHandle(node.AnimationClip.GetHandle()))
+            animation = dynamic_cast<AnimationAsset*>(Assets.GetOrLoadAsync(node.AnimationClip.GetHandle()));
 
         if (animation &&
             (uint64)animation->m_SkeletonID != 0 &&
-            (uint64)animation->m_SkeletonID != (uint64)skeleton->ID)
+            (uint64)animation->m_SkeletonID != (uint64)Skeleton->ID)
         {
             animation = nullptr;
         }
 
         const float sampleTime = animation
-            ? AnimationRuntime::NormalizePlaybackTime(
-                playbackTime + FMath::max(0.0f, node.ClipStartTime),
-                animation->m_DurationSeconds,
-                bLooping)
+            ? AnimationRuntime::NormalizePlaybackTime(playbackTime + node.ClipStartTime, animation->m_DurationSeconds, bLooping)
             : 0.0f;
 
-        AppendClipSummary(trace, animation);
+        AppendClipSummary(Trace, animation);
 
-        return AnimationRuntime::EvaluateLocalPose(
-            skeleton,
+        slot.bValid = AnimationRuntime::EvaluateLocalPose(
+            Skeleton,
             animation,
             sampleTime,
-            localBindPose,
-            outLocalPose,
+            LocalBindPose,
+            slot.Pose,
             bApplyRootMotion);
     }
-    case AnimGraphNodeKind::Blend:
-    {
-        const AnimGraphNode* inputA = graph.FindNode(node.InputA);
-        const AnimGraphNode* inputB = graph.FindNode(node.InputB);
-        if (!inputA && !inputB)
-            return false;
-
-        TArray<Mat4> poseA = localBindPose;
-        TArray<Mat4> poseB = localBindPose;
-        TArray<uint64> visitedA = visited;
-        TArray<uint64> visitedB = visited;
-        const bool hasA = inputA && EvaluateAnimGraphNode(
-            skComp, animInstance, assetManager, graph, *inputA, skeleton, localBindPose, playbackTime, dt, bApplyRootMotion, poseA, visitedA, bLooping, runtimeScopeID, trace);
-        const bool hasB = inputB && EvaluateAnimGraphNode(
-            skComp, animInstance, assetManager, graph, *inputB, skeleton, localBindPose, playbackTime, dt, bApplyRootMotion, poseB, visitedB, bLooping, runtimeScopeID, trace);
 
-        if (hasA && hasB)
-        {
-            BlendLocalPoses(poseA, poseB, ResolveBlendAlpha(skComp, runtimeScopeID, node, animInstance, dt), outLocalPose);
-            return true;
-        }
-
-        outLocalPose = hasA ? poseA : poseB;
-        return hasA || hasB;
-    }
-    case AnimGraphNodeKind::Output:
+    // Runs nodes [first, first + count) with the stack starting at base and
+    // leaves the segment's result in GraphPoseStack[base].
+    bool RunSegment(const int32 first, const int32 count, const float playbackTime, const bool bLooping, const int32 base)
     {
-        const AnimGraphNode* input = graph.FindNode(node.InputPose);
-        if (!input)
+        if (count <= 0)
             return false;
 
-        return EvaluateAnimGraphNode(
-            skComp,
-            animInstance,
-            assetManager,
-            graph,
-            *input,
-            skeleton,
-            localBindPose,
-            playbackTime,
-            dt,
-            bApplyRootMotion,
-            outLocalPose,
-            visited,
-            bLooping,
-            runtimeScopeID,
-            trace);
-    }
-    case AnimGraphNodeKind::StateMachine:
-    {
-        if (!skComp)
-            return false;
-
-        const AnimStateMachine* stateMachine = graph.FindStateMachine(node.StateMachineID);
-        if (!stateMachine || stateMachine->States.IsEmpty())
-            return false;
-
-        auto findState = [&](uint64 stateID) -> const AnimState*
+        TArray<AnimGraphPoseSlot>& stack = Component.GraphPoseStack;
+        int32 top = base;
+        for (int32 i = first; i < first + count; ++i)
         {
-            for (const AnimState& state : stateMachine->States)
+            const AnimProgramNode& node = Program.Nodes[i];
+            switch (node.Op)
+            {
+            case AnimProgramOp::Clip:
+                EvaluateClip(node, stack[top], playbackTime, bLooping);
+                ++top;
+                break;
+            case AnimProgramOp::Blend:
             {
-                if (state.ID == stateID)
-                    return &state;
+                AnimGraphPoseSlot& poseA = stack[top - 2];
+                AnimGraphPoseSlot& poseB = stack[top - 1];
+                if (poseA.bValid && poseB.bValid)
+                    BlendLocalPoses(poseA.Pose, poseB.Pose, ResolveBlendAlpha(node), poseA.Pose);
+                else if (poseB.bValid)
+                    std::swap(poseA.Pose, poseB.Pose);
+                poseA.bValid = poseA.bValid || poseB.bValid;
+                --top;
+                break;
             }
-            return nullptr;
-        };
+            case AnimProgramOp::StateMachine:
+                stack[top].bValid = RunStateMachine(node, top);
+                ++top;
+                break;
+            case AnimProgramOp::Missing:
+            default:
+                stack[top].bValid = false;
+                ++top;
+                break;
+            }
+        }
 
-        auto getStateClipDuration = [&](const AnimState& state) -> float
-        {
-            TArray<uint64> visited;
-            const AnimGraphNode* output = graph.FindOutputNode(state.StateGraph);
-            return output ? GetPoseGraphClipDuration(assetManager, graph, state.StateGraph, output->InputPose, visited) : 0.0f;
-        };
+        return stack[base].bValid;
+    }
 
-        const Rebel::Core::Reflection::TypeInfo* instanceType = animInstance ? animInstance->GetType() : nullptr;
-        auto findProperty = [&](const String& name) -> const Rebel::Core::Reflection::PropertyInfo*
+    bool RunStateMachine(const AnimProgramNode& node, const int32 base)
+    {
+        const AnimProgramStateMachine& stateMachine = Program.StateMachines[node.StateMachine];
+        AnimStateMachineRuntime& runtime = Component.StateMachineRuntimes[node.StateMachine];
+        auto ownsState = [&](const int32 stateIndex)
         {
-            const Rebel::Core::Reflection::TypeInfo* type = instanceType;
-            while (type)
-            {
-                for (const Rebel::Core::Reflection::PropertyInfo& prop : type->Properties)
-                {
-                    if (prop.Name == name)
-                        return &prop;
-                }
-                type = type->Super;
-            }
-            return nullptr;
+            return stateIndex >= stateMachine.FirstState && stateIndex < stateMachine.FirstState + stateMachine.StateCount;
         };
 
-        AnimStateMachineRuntime& runtime = skComp->GetStateMachineRuntime(stateMachine->ID);
-        if (!findState(runtime.CurrentStateID))
+        if (!ownsState(runtime.CurrentStateIndex))
         {
-            runtime.CurrentStateID = stateMachine->EntryStateID != 0 ? stateMachine->EntryStateID : stateMachine->States[0].ID;
+            runtime.CurrentStateIndex = stateMachine.EntryState;
+            runtime.CurrentStateID = stateMachine.EntryState >= 0 ? Program.States[stateMachine.EntryState].ID : 0;
+            runtime.PreviousStateIndex = -1;
             runtime.PreviousStateID = 0;
             runtime.StateTime = 0.0f;
             runtime.PreviousStateTime = 0.0f;
@@ -753,91 +649,13 @@ bool EvaluateAnimGraphNode(
             runtime.bTransitionActive = false;
         }
 
-        auto conditionPasses = [&](const AnimTransitionCondition& condition) -> bool
-        {
-            const AnimState* currentStateForTiming = findState(runtime.CurrentStateID);
-            const float stateTime = runtime.StateTime;
-            const float stateDuration = currentStateForTiming ? getStateClipDuration(*currentStateForTiming) : 0.0f;
-            const float remainingTime = stateDuration > 1.0e-6f ? FMath::max(0.0f, stateDuration - stateTime) : 0.0f;
-            const float remainingRatio = stateDuration > 1.0e-6f ? remainingTime / stateDuration : 0.0f;
-
-            switch (condition.Op)
-            {
-            case AnimConditionOp::StateTimeGreater:
-                return stateTime > condition.FloatValue;
-            case AnimConditionOp::StateTimeLess:
-                return stateTime < condition.FloatValue;
-            case AnimConditionOp::AnimTimeRemainingLess:
-                return stateDuration > 1.0e-6f && remainingTime < condition.FloatValue;
-            case AnimConditionOp::AnimTimeRemainingRatioLess:
-                return stateDuration > 1.0e-6f && remainingRatio < condition.FloatValue;
-            default:
-                break;
-            }
-
-            if (!animInstance)
-                return false;
-
-            const Rebel::Core::Reflection::PropertyInfo* prop = findProperty(condition.PropertyName);
-            if (!prop)
-                return false;
-
-            const uint8* base = reinterpret_cast<const uint8*>(animInstance);
-            const void* valuePtr = base + prop->Offset;
-            using Rebel::Core::Reflection::EPropertyType;
-            switch (condition.Op)
-            {
-            case AnimConditionOp::BoolIsTrue:
-                return prop->Type == EPropertyType::Bool && *reinterpret_cast<const bool*>(valuePtr);
-            case AnimConditionOp::BoolIsFalse:
-                return prop->Type == EPropertyType::Bool && !*reinterpret_cast<const bool*>(valuePtr);
-            case AnimConditionOp::FloatGreater:
-                return prop->Type == EPropertyType::Float && *reinterpret_cast<const float*>(valuePtr) > condition.FloatValue;
-            case AnimConditionOp::FloatLess:
-                return prop->Type == EPropertyType::Float && *reinterpret_cast<const float*>(valuePtr) < condition.FloatValue;
-            case AnimConditionOp::IntGreater:
-                return prop->Type == EPropertyType::Int32 && *reinterpret_cast<const int32*>(valuePtr) > condition.IntValue;
-            case AnimConditionOp::IntLess:
-                return prop->Type == EPropertyType::Int32 && *reinterpret_cast<const int32*>(valuePtr) < condition.IntValue;
-            case AnimConditionOp::EnumEquals:
-            case AnimConditionOp::EnumNotEquals:
-            {
-                if (prop->Type != EPropertyType::Enum)
-                    return false;
-
-                const int32 enumValue = ReadEnumPropertyValueAsInt(*prop, valuePtr);
-                const bool bEquals = enumValue == condition.IntValue;
-                return condition.Op == AnimConditionOp::EnumEquals ? bEquals : !bEquals;
-            }
-            default:
-                return false;
-            }
-        };
-
-        auto conditionsPass = [&](const TArray<AnimTransitionCondition>& conditions) -> bool
-        {
-            if (conditions.IsEmpty())
-                return true;
-
-            for (const AnimTransitionCondition& condition : conditions)
-            {
-                if (!conditionPasses(condition))
-                    return false;
-            }
-            return true;
-        };
-
-        auto transitionPasses = [&](const AnimTransition& transition) -> bool
-        {
-            return conditionsPass(transition.Conditions);
-        };
-
         if (runtime.bTransitionActive)
         {
-            runtime.TransitionTime += dt;
+            runtime.TransitionTime += Dt;
             if (runtime.TransitionTime >= runtime.TransitionDuration)
             {
                 runtime.bTransitionActive = false;
+                runtime.PreviousStateIndex = -1;
                 runtime.PreviousStateID = 0;
                 runtime.PreviousStateTime = 0.0f;
                 runtime.TransitionTime = 0.0f;
@@ -846,133 +664,73 @@ bool EvaluateAnimGraphNode(
         else
         {
             bool didAliasTransition = false;
-            for (const AnimStateAlias& alias : stateMachine->Aliases)
+            for (int32 a = stateMachine.FirstAlias; a < stateMachine.FirstAlias + stateMachine.AliasCount && !didAliasTransition; ++a)
             {
-                bool allowedFromCurrent = alias.bGlobalAlias;
-                if (!allowedFromCurrent)
-                {
-                    for (const uint64 allowedStateID : alias.AllowedFromStateIDs)
-                    {
-                        if (allowedStateID == runtime.CurrentStateID)
-                        {
-                            allowedFromCurrent = true;
-                            break;
-                        }
-                    }
-                }
+                const AnimProgramAlias& alias = Program.Aliases[a];
+                bool allowedFromCurrent = alias.bGlobal;
+                for (int32 i = alias.FirstAllowedState; !allowedFromCurrent && i < alias.FirstAllowedState + alias.AllowedStateCount; ++i)
+                    allowedFromCurrent = Program.AllowedStates[i] == runtime.CurrentStateIndex;
 
-                if (!allowedFromCurrent || !conditionsPass(alias.Conditions))
+                if (!allowedFromCurrent || !ConditionsPass(alias.FirstCondition, alias.ConditionCount, runtime))
                     continue;
 
-                auto tryAliasTarget = [&](const uint64 targetStateID, const float blendDuration, const TArray<AnimTransitionCondition>* targetConditions) -> bool
+                for (int32 t = alias.FirstTarget; t < alias.FirstTarget + alias.TargetCount; ++t)
                 {
-                    if (targetStateID == 0 || targetStateID == runtime.CurrentStateID || !findState(targetStateID))
-                        return false;
-                    if (targetConditions && !conditionsPass(*targetConditions))
-                        return false;
-
-                    runtime.PreviousStateID = runtime.CurrentStateID;
-                    runtime.PreviousStateTime = runtime.StateTime;
-                    runtime.CurrentStateID = targetStateID;
-                    runtime.StateTime = 0.0f;
-                    runtime.TransitionTime = 0.0f;
-                    runtime.TransitionDuration = FMath::max(0.0f, blendDuration);
-                    runtime.bTransitionActive = runtime.TransitionDuration > 1.0e-6f;
-                    return true;
-                };
-
-                for (const AnimStateAliasTarget& target : alias.Targets)
-                {
-                    if (tryAliasTarget(target.StateID, target.BlendDuration, &target.Conditions))
+                    const AnimProgramTransition& target = Program.Transitions[t];
+                    if (target.ToState == runtime.CurrentStateIndex ||
+                        !ConditionsPass(target.FirstCondition, target.ConditionCount, runtime))
                     {
-                        didAliasTransition = true;
-                        break;
+                        continue;
                     }
-                }
 
-                if (!didAliasTransition && alias.Targets.IsEmpty())
-                {
-                    for (const uint64 targetStateID : alias.TargetStateIDs)
-                    {
-                        if (tryAliasTarget(targetStateID, alias.BlendDuration, nullptr))
-                        {
-                            didAliasTransition = true;
-                            break;
-                        }
-                    }
-                }
-
-                if (!didAliasTransition && alias.Targets.IsEmpty() && alias.TargetStateIDs.IsEmpty())
-                    didAliasTransition = tryAliasTarget(alias.ToStateID, alias.BlendDuration, nullptr);
-
-                if (didAliasTransition)
+                    EnterState(runtime, target);
+                    didAliasTransition = true;
                     break;
+                }
             }
 
-            if (!didAliasTransition)
+            if (!didAliasTransition && runtime.CurrentStateIndex >= 0)
             {
-                for (const AnimTransition& transition : stateMachine->Transitions)
+                const AnimProgramState& state = Program.States[runtime.CurrentStateIndex];
+                for (int32 t = state.FirstTransition; t < state.FirstTransition + state.TransitionCount; ++t)
                 {
-                    if (transition.FromStateID == runtime.CurrentStateID && transitionPasses(transition) && findState(transition.ToStateID))
+                    const AnimProgramTransition& transition = Program.Transitions[t];
+                    if (ConditionsPass(transition.FirstCondition, transition.ConditionCount, runtime))
                     {
-                        runtime.PreviousStateID = runtime.CurrentStateID;
-                        runtime.PreviousStateTime = runtime.StateTime;
-                        runtime.CurrentStateID = transition.ToStateID;
-                        runtime.StateTime = 0.0f;
-                        runtime.TransitionTime = 0.0f;
-                        runtime.TransitionDuration = FMath::max(0.0f, transition.BlendDuration);
-                        runtime.bTransitionActive = runtime.TransitionDuration > 1.0e-6f;
+                        EnterState(runtime, transition);
                         break;
                     }
                 }
             }
         }
 
-        runtime.StateTime += dt;
+        runtime.StateTime += Dt;
         if (runtime.bTransitionActive)
-            runtime.PreviousStateTime += dt;
+            runtime.PreviousStateTime += Dt;
 
-        const AnimState* currentState = findState(runtime.CurrentStateID);
-        if (!currentState)
+        if (runtime.CurrentStateIndex < 0)
             return false;
 
-        TArray<uint64> currentVisited;
-        TArray<Mat4> currentPose = localBindPose;
-        const uint64 currentScopeID = MakeStatePoseGraphRuntimeScopeID(stateMachine->ID, currentState->ID);
-        const bool hasCurrent = EvaluateStatePoseGraph(
-            skComp, animInstance, assetManager, graph, *currentState, skeleton, localBindPose, runtime.StateTime, dt, bApplyRootMotion, currentPose, currentVisited, currentScopeID, trace);
-        if (!hasCurrent)
+        const AnimProgramState& currentState = Program.States[runtime.CurrentStateIndex];
+        if (!RunSegment(currentState.FirstNode, currentState.NodeCount, runtime.StateTime, currentState.bLoop, base))
             return false;
 
-        if (runtime.bTransitionActive)
+        if (runtime.bTransitionActive && ownsState(runtime.PreviousStateIndex))
         {
-            const AnimState* previousState = findState(runtime.PreviousStateID);
-            if (previousState)
+            const AnimProgramState& previousState = Program.States[runtime.PreviousStateIndex];
+            if (RunSegment(previousState.FirstNode, previousState.NodeCount, runtime.PreviousStateTime, previousState.bLoop, base + 1))
             {
-                TArray<uint64> previousVisited;
-                TArray<Mat4> previousPose = localBindPose;
-                const uint64 previousScopeID = MakeStatePoseGraphRuntimeScopeID(stateMachine->ID, previousState->ID);
-                if (EvaluateStatePoseGraph(
-                    skComp, animInstance, assetManager, graph, *previousState, skeleton, localBindPose, runtime.PreviousStateTime, dt, bApplyRootMotion, previousPose, previousVisited, previousScopeID, trace))
-                {
-                    const float alpha = runtime.TransitionDuration > 1.0e-6f
-                        ? runtime.TransitionTime / runtime.TransitionDuration
-                        : 1.0f;
-                    BlendLocalPoses(previousPose, currentPose, alpha, outLocalPose);
-                    return true;
-                }
+                TArray<Mat4>& currentPose = Component.GraphPoseStack[base].Pose;
+                const float alpha = runtime.TransitionDuration > 1.0e-6f
+                    ? runtime.TransitionTime / runtime.TransitionDuration
+                    : 1.0f;
+                BlendLocalPoses(Component.GraphPoseStack[base + 1].Pose, currentPose, alpha, currentPose);
             }
         }
 
-        outLocalPose = currentPose;
         return true;
     }
-    default:
-        break;
-    }
-
-    return false;
-}
+};
 
 bool EvaluateAnimGraph(
     SkeletalMeshComponent* skComp,
@@ -987,27 +745,27 @@ bool EvaluateAnimGraph(
     TArray<Mat4>& outLocalPose,
     AnimationEvaluationTrace* trace)
 {
-    const AnimGraphNode* output = graph.FindOutputNode();
-    if (!output)
+    const AnimGraphProgram& program = graph.GetProgram();
+    if (!program.IsValid())
+        return false;
+
+    SyncAnimGraphRuntime(*skComp, program);
+    if (skComp->GraphPoseStack.Num() < static_cast<MemSize>(program.MaxPoseStackDepth))
+        skComp->GraphPoseStack.Resize(program.MaxPoseStackDepth);
+
+    // Bindings were resolved against the graph's instance class; an instance
+    // of an unrelated class reads no properties, like a failed name lookup.
+    const uint8* instanceBase = nullptr;
+    if (animInstance && program.InstanceType && animInstance->GetType()->IsA(program.InstanceType))
+        instanceBase = reinterpret_cast<const uint8*>(animInstance);
+
+    AnimGraphEvaluator evaluator{
+        *skComp, program, instanceBase, assetManager, skeleton, localBindPose, dt, bApplyRootMotion, trace};
+    if (!evaluator.RunSegment(program.RootFirstNode, program.RootNodeCount, playbackTime, true, 0))
         return false;
 
-    TArray<uint64> visited;
-    return EvaluateAnimGraphNode(
-        skComp,
-        animInstance,
-        assetManager,
-        graph,
-        *output,
-        skeleton,
-        localBindPose,
-        playbackTime,
-        dt,
-        bApplyRootMotion,
-        outLocalPose,
-        visited,
-        true,
-        0,
-        trace);
+    outLocalPose = skComp->GraphPoseStack[0].Pose;
+    return true;
 }
 
 void LockRootBoneTranslationToBindPose(
@@ -1181,6 +939,7 @@ void StripRootMotionFromVisualPose(
     const TArray<Mat4>& localBindPose,
     TArray<Mat4>& inOutLocalPose,
     const SkeletalMeshComponent* skComp,
+    const Vector3& actorForward,
     const AnimationEvaluationTrace* trace)
 {
     if (!skeleton || localBindPose.Num() != inOutLocalPose.Num())
@@ -1209,8 +968,8 @@ void StripRootMotionFromVisualPose(
                name == "root";
     };
 
-    TArray<Mat4> bindGlobalPose;
-    AnimationRuntime::BuildGlobalPose(skeleton, localBindPose, bindGlobalPose);
+    // localBindPose is always the skeleton's cached bind pose here.
+    const TArray<Mat4>& bindGlobalPose = skeleton->GetGlobalBindPose();
     const int32 rootBoneIndex = FindNamedRootBoneIndex(skeleton);
 
     auto ComputeHorizontalVector = [](const Vector3& value) -> Vector3
@@ -1421,14 +1180,19 @@ void StripRootMotionFromVisualPose(
     }
 
     static std::unordered_map<const SkeletalMeshComponent*, float> lastLogTimeByComponent;
+    static std::mutex lastLogTimeMutex;
     const bool bShouldLog = skComp != nullptr;
     if (!bShouldLog)
         return;
 
-    float& lastLogTime = lastLogTimeByComponent[skComp];
-    if (trace && std::fabs(trace->PlaybackTime - lastLogTime) < 0.20f)
-        return;
-    lastLogTime = trace ? trace->PlaybackTime : (lastLogTime + 1.0f);
+    {
+        // Components are evaluated on job threads.
+        std::lock_guard<std::mutex> lock(lastLogTimeMutex);
+        float& lastLogTime = lastLogTimeByComponent[skComp];
+        if (trace && std::fabs(trace->PlaybackTime - lastLogTime) < 0.20f)
+            return;
+        lastLogTime = trace ? trace->PlaybackTime : (lastLogTime + 1.0f);
+    }
 
     TArray<Mat4> globalPoseBefore;
     TArray<Mat4> globalPoseAfter;
@@ -1458,10 +1222,6 @@ void StripRootMotionFromVisualPose(
         diagnosticLine += "] ";
     }
 
-    Vector3 actorForward(1.0f, 0.0f, 0.0f);
-    if (skComp->GetOwner())
-        actorForward = skComp->GetOwner()->GetActorForwardVector();
-
     auto FindBoneIndexByName = [&](const char* boneName) -> int32
     {
         for (int32 boneIndex = 0; boneIndex < skeleton->m_BoneNames.Num(); ++boneIndex)
@@ -1573,6 +1333,263 @@ AnimationLocomotionState BuildLocomotionStateForComponent(const SkeletalMeshComp
 
     return locomotionState;
 }
+
+// Evaluate phase for one component. Runs on job threads: it reads shared
+// assets and writes only the component's own pose buffers and playback state.
+void EvaluateComponentAnimation(const AnimationUpdateItem& item, AssetManager& assetManager, const float dt)
+{
+    SkeletalMeshComponent* skComp = item.Component;
+    const SkeletonAsset* skeleton = item.Skeleton;
+    AnimGraphAsset* animGraph = item.AnimGraph;
+    AnimInstance* animInstance = item.Instance;
+    const bool bWantsOverrideAnimation = item.bWantsOverrideAnimation;
+
+    const TArray<Mat4>& localBindPose = skeleton->GetLocalBindPose();
+
+    // Pose buffers live on the component and keep their capacity across
+    // frames; copy-assigning the bind pose only reallocates on growth.
+    TArray<Mat4>& localPose = skComp->LocalPose;
+    TArray<Mat4>& globalPose = skComp->GlobalPose;
+    localPose = localBindPose;
+
+    bool bPoseEvaluated = false;
+    AnimationEvaluationTrace evaluationTrace{};
+    evaluationTrace.PlaybackTime = skComp->PlaybackTime;
+    if (animInstance && !bWantsOverrideAnimation)
+    {
+        if (skComp->bPlayAnimation)
+            animInstance->Update(dt * skComp->PlaybackSpeed, skComp->LocomotionState);
+
+        AnimationEvaluationContext context{};
+        context.AssetManager = &assetManager;
+        context.Skeleton = skeleton;
+        context.LocalBindPose = &localBindPose;
+
+        if (animGraph)
+        {
+            if (skComp->bPlayAnimation)
+                skComp->PlaybackTime += dt * skComp->PlaybackSpeed;
+
+            evaluationTrace.Path = "AnimGraph";
+            evaluationTrace.PlaybackTime = skComp->PlaybackTime;
+            bPoseEvaluated = EvaluateAnimGraph(
+                skComp,
+                animInstance,
+                assetManager,
+                *animGraph,
+                skeleton,
+                localBindPose,
+                skComp->PlaybackTime,
+                dt * skComp->PlaybackSpeed,
+                skComp->bEnableRootMotion,
+                localPose,
+                &evaluationTrace);
+        }
+        else
+        {
+            evaluationTrace.Path = "AnimInstance";
+            bPoseEvaluated = animInstance->Evaluate(context, localPose);
+            skComp->PlaybackTime = animInstance->GetDebugPlaybackTime();
+            evaluationTrace.PlaybackTime = skComp->PlaybackTime;
+        }
+    }
+
+    if (!bPoseEvaluated)
+    {
+        const AnimationAsset* overrideAnimation = item.OverrideAnimation;
+        if (overrideAnimation)
+        {
+            if (skComp->bPlayAnimation)
+                skComp->OverridePlaybackTime += dt * skComp->OverridePlaybackSpeed;
+
+            skComp->OverridePlaybackTime = AnimationRuntime::NormalizePlaybackTime(
+                skComp->OverridePlaybackTime,
+                overrideAnimation->m_DurationSeconds,
+                skComp->bOverrideAnimationLooping);
+
+            TArray<Mat4>& overridePose = skComp->PoseScratch;
+            overridePose = localBindPose;
+            evaluationTrace.Path = "Override";
+            evaluationTrace.PlaybackTime = skComp->OverridePlaybackTime;
+            evaluationTrace.ClipSummary = overrideAnimation->m_ClipName;
+            evaluationTrace.PrimaryAnimation = overrideAnimation;
+            bPoseEvaluated = AnimationRuntime::EvaluateLocalPose(
+                skeleton,
+                overrideAnimation,
+                skComp->OverridePlaybackTime,
+                localBindPose,
+                overridePose,
+                skComp->bEnableRootMotion);
+
+            if (bPoseEvaluated && skComp->bOverrideBlendActive)
+            {
+                if (skComp->bPlayAnimation)
+                {
+                    skComp->OverrideBlendElapsed += dt;
+                    if (skComp->OverrideBlendElapsed > skComp->OverrideBlendDuration)
+                        skComp->OverrideBlendElapsed = skComp->OverrideBlendDuration;
+                }
+
+                const float blendAlpha = skComp->OverrideBlendDuration > 1.0e-6f
+                    ? FMath::clamp(skComp->OverrideBlendElapsed / skComp->OverrideBlendDuration, 0.0f, 1.0f)
+                    : 1.0f;
+
+                BlendLocalPoses(
+                    skComp->OverrideBlendSourcePose,
+                    overridePose,
+                    blendAlpha,
+                    localPose);
+
+                if (blendAlpha >= 1.0f - 1.0e-6f)
+                {
+                    skComp->bOverrideBlendActive = false;
+                    skComp->OverrideBlendDuration = 0.0f;
+                    skComp->OverrideBlendElapsed = 0.0f;
+                    skComp->OverrideBlendSourcePose.Clear();
+                }
+            }
+            else if (bPoseEvaluated)
+            {
+                localPose = overridePose;
+            }
+
+            if (bPoseEvaluated && skComp->bOverrideLockRootBoneTranslation)
+                LockRootBoneTranslationToBindPose(skeleton, localBindPose, localPose);
+
+            skComp->PlaybackTime = skComp->OverridePlaybackTime;
+
+            if (!skComp->bOverrideAnimationLooping &&
+                overrideAnimation->m_DurationSeconds > 0.0f &&
+                skComp->OverridePlaybackTime >= overrideAnimation->m_DurationSeconds - 1.0e-4f)
+            {
+                const float blendOutDuration = glm::max(0.0f, skComp->OverrideBlendOutDuration);
+                const bool bCanBlendOut = blendOutDuration > 1.0e-6f && !localPose.IsEmpty();
+
+                skComp->bOverrideAnimationActive = false;
+                skComp->OverrideAnimation = {};
+                skComp->OverridePlaybackTime = 0.0f;
+                skComp->bOverrideBlendActive = false;
+                skComp->OverrideBlendDuration = 0.0f;
+                skComp->OverrideBlendElapsed = 0.0f;
+                skComp->OverrideBlendSourcePose.Clear();
+                skComp->bOverrideLockRootBoneTranslation = false;
+
+                skComp->bOverrideBlendOutActive = bCanBlendOut;
+                skComp->OverrideBlendOutElapsed = 0.0f;
+                if (bCanBlendOut)
+                    skComp->OverrideBlendOutSourcePose = localPose;
+                else
+                    skComp->OverrideBlendOutSourcePose.Clear();
+            }
+        }
+
+        if (!bPoseEvaluated)
+        {
+            AnimationAsset* animation = nullptr;
+            if ((uint64)skComp->Animation.GetHandle() != 0)
+            {
+                animation = dynamic_cast<AnimationAsset*>(assetManager.GetOrLoadAsync(skComp->Animation.GetHandle()));
+
+                if (animation && (uint64)animation->m_SkeletonID != 0 &&
+                    (uint64)animation->m_SkeletonID != (uint64)skeleton->ID)
+                {
+                    animation = nullptr;
+                }
+            }
+
+            if (animation)
+            {
+                if (skComp->bPlayAnimation)
+                    skComp->PlaybackTime += dt * skComp->PlaybackSpeed;
+
+                skComp->PlaybackTime = AnimationRuntime::NormalizePlaybackTime(
+                    skComp->PlaybackTime,
+                    animation->m_DurationSeconds,
+                    skComp->bLoopAnimation);
+
+                evaluationTrace.Path = "Direct";
+                evaluationTrace.PlaybackTime = skComp->PlaybackTime;
+                evaluationTrace.ClipSummary = animation->m_ClipName;
+                evaluationTrace.PrimaryAnimation = animation;
+                bPoseEvaluated = AnimationRuntime::EvaluateLocalPose(
+                    skeleton,
+                    animation,
+                    skComp->PlaybackTime,
+                    localBindPose,
+                    localPose,
+                    skComp->bEnableRootMotion);
+
+            }
+            else
+            {
+                skComp->PlaybackTime = 0.0f;
+            }
+        }
+    }
+
+    if (!bPoseEvaluated)
+        localPose = localBindPose;
+
+    if (bPoseEvaluated && !skComp->bEnableRootMotion)
+    {
+        ApplyRootMotionRootLock(
+            skeleton,
+            localBindPose,
+            localPose,
+            evaluationTrace.PrimaryAnimation,
+            skComp->RootMotionRootLock);
+        StripRootMotionFromVisualPose(skeleton, localBindPose, localPose, skComp, item.OwnerForward, &evaluationTrace);
+    }
+
+    if (skComp->bOverrideBlendOutActive)
+    {
+        const bool bValidBlendOutSource =
+            !skComp->OverrideBlendOutSourcePose.IsEmpty() &&
+            skComp->OverrideBlendOutSourcePose.Num() == localPose.Num();
+        if (!bValidBlendOutSource)
+        {
+            skComp->bOverrideBlendOutActive = false;
+            skComp->OverrideBlendOutElapsed = 0.0f;
+            skComp->OverrideBlendOutSourcePose.Clear();
+        }
+        else
+        {
+            if (skComp->bPlayAnimation)
+            {
+                skComp->OverrideBlendOutElapsed += dt;
+                if (skComp->OverrideBlendOutElapsed > skComp->OverrideBlendOutDuration)
+                    skComp->OverrideBlendOutElapsed = skComp->OverrideBlendOutDuration;
+            }
+
+            const float blendAlpha = skComp->OverrideBlendOutDuration > 1.0e-6f
+                ? FMath::clamp(
+                    skComp->OverrideBlendOutElapsed / skComp->OverrideBlendOutDuration,
+                    0.0f,
+                    1.0f)
+                : 1.0f;
+
+            // Per-bone blend, so writing back into localPose is safe.
+            BlendLocalPoses(skComp->OverrideBlendOutSourcePose, localPose, blendAlpha, localPose);
+
+            if (blendAlpha >= 1.0f - 1.0e-6f)
+            {
+                skComp->bOverrideBlendOutActive = false;
+                skComp->OverrideBlendOutElapsed = 0.0f;
+                skComp->OverrideBlendOutSourcePose.Clear();
+            }
+        }
+    }
+
+    AnimationRuntime::BuildGlobalPose(skeleton, localPose, globalPose);
+
+    if (!AnimationRuntime::BuildSkinPalette(skeleton, globalPose, skComp->FinalPalette))
+    {
+        ClearAnimationRuntimeData(skComp);
+        return;
+    }
+
+    UpdateRuntimeBoneTransforms(skComp, skeleton, skComp->LocalPose, skComp->GlobalPose);
+}
 } // namespace
 
 AnimationModule::AnimationModule()
@@ -1602,6 +1619,10 @@ void AnimationModule::UpdateAnimations(float dt)
     auto& reg = m_Scene->GetRegistry();
     auto skelView = reg.view<SkeletalMeshComponent*>();
 
+    // Serial phase: resolve assets, create AnimInstances and snapshot the
+    // owning characters' locomotion state. Anything that allocates shared
+    // objects or reads other actors stays on this thread.
+    m_UpdateItems.Clear();
     for (auto e : skelView)
     {
         auto* skComp = skelView.get<SkeletalMeshComponent*>(e);
@@ -1612,7 +1633,7 @@ void AnimationModule::UpdateAnimations(float dt)
             continue;
 
         SkeletalMeshAsset* skAsset =
-            dynamic_cast<SkeletalMeshAsset*>(assetManager.Load(skComp->Mesh.GetHandle()));
+            dynamic_cast<SkeletalMeshAsset*>(assetManager.GetOrLoadAsync(skComp->Mesh.GetHandle(), EAssetLoadPriority::High));
         if (!skAsset)
         {
             ClearAnimationRuntimeData(skComp);
@@ -1620,93 +1641,34 @@ void AnimationModule::UpdateAnimations(float dt)
         }
 
         SkeletonAsset* skeleton =
-            dynamic_cast<SkeletonAsset*>(assetManager.Load(skAsset->m_Skeleton.GetHandle()));
+            dynamic_cast<SkeletonAsset*>(assetManager.GetOrLoadAsync(skAsset->m_Skeleton.GetHandle(), EAssetLoadPriority::High));
         if (!skeleton)
         {
             ClearAnimationRuntimeData(skComp);
             continue;
         }
 
-        TArray<Mat4> localBindPose;
-        TArray<Mat4> globalBindPose;
-        if (!AnimationRuntime::BuildBindPoses(skeleton, localBindPose, globalBindPose))
+        // Skeletons that never went through PostLoad (e.g. freshly imported)
+        // build their cache on first use.
+        if (!skeleton->HasBindPoseCache() && !skeleton->BuildBindPoseCache())
         {
             ClearAnimationRuntimeData(skComp);
             continue;
         }
 
-        ValidateBindPoseMatricesOnce(skeleton, globalBindPose);
-
-        TArray<Mat4> localPose = localBindPose;
-        TArray<Mat4> globalPose = globalBindPose;
-
-        const bool bWantsOverrideAnimation =
-            skComp->bOverrideAnimationActive &&
-            (uint64)skComp->OverrideAnimation.GetHandle() != 0;
-
-        bool bPoseEvaluated = false;
-        AnimationEvaluationTrace evaluationTrace{};
-        evaluationTrace.PlaybackTime = skComp->PlaybackTime;
-        AnimGraphAsset* animGraph = nullptr;
-        if (IsValidAssetHandle(skComp->AnimGraph.GetHandle()))
-            animGraph = dynamic_cast<AnimGraphAsset*>(assetManager.Load(skComp->AnimGraph.GetHandle()));
-
-        const Rebel::Core::Reflection::TypeInfo* requestedAnimInstanceType = nullptr;
-        if (animGraph && animGraph->m_AnimInstanceClass.Get())
-            requestedAnimInstanceType = animGraph->m_AnimInstanceClass.Get();
-        else if (skComp->AnimInstanceClass.Get())
-            requestedAnimInstanceType = skComp->AnimInstanceClass.Get();
-
-        AnimInstance* animInstance = skComp->EnsureAnimInstance(requestedAnimInstanceType);
-        if (animInstance && !bWantsOverrideAnimation)
-        {
-            animInstance->SetRootMotionEnabled(skComp->bEnableRootMotion);
-            skComp->LocomotionState = BuildLocomotionStateForComponent(skComp);
-            if (skComp->bPlayAnimation)
-                animInstance->Update(dt * skComp->PlaybackSpeed, skComp->LocomotionState);
-
-            AnimationEvaluationContext context{};
-            context.AssetManager = &assetManager;
-            context.Skeleton = skeleton;
-            context.LocalBindPose = &localBindPose;
-
-            if (animGraph)
-            {
-                if (skComp->bPlayAnimation)
-                    skComp->PlaybackTime += dt * skComp->PlaybackSpeed;
-
-                evaluationTrace.Path = "AnimGraph";
-                evaluationTrace.PlaybackTime = skComp->PlaybackTime;
-                bPoseEvaluated = EvaluateAnimGraph(
-                    skComp,
-                    animInstance,
-                    assetManager,
-                    *animGraph,
-                    skeleton,
-                    localBindPose,
-                    skComp->PlaybackTime,
-                    dt * skComp->PlaybackSpeed,
-                    skComp->bEnableRootMotion,
-                    localPose,
-                    &evaluationTrace);
-            }
-            else
-            {
-                evaluationTrace.Path = "AnimInstance";
-                bPoseEvaluated = animInstance->Evaluate(context, localPose);
-                skComp->PlaybackTime = animInstance->GetDebugPlaybackTime();
-                evaluationTrace.PlaybackTime = skComp->PlaybackTime;
-            }
-        }
+        ValidateBindPoseMatricesOnce(skeleton, skeleton->GetGlobalBindPose());
 
-        if (!bPoseEvaluated)
+        // Override clips stream at high priority. The component keeps its
+        // regular animation until the clip is ready; a clip that fails to
+        // load or targets another skeleton stops the override.
+        const AnimationAsset* overrideAnimation = nullptr;
+        if (skComp->bOverrideAnimationActive && (uint64)skComp->OverrideAnimation.GetHandle() != 0)
         {
-            AnimationAsset* overrideAnimation = nullptr;
-            if (bWantsOverrideAnimation)
+            const AssetLoadHandle request =
+                assetManager.LoadAsync(skComp->OverrideAnimation.GetHandle(), EAssetLoadPriority::High);
+            if (request->IsDone())
             {
-                overrideAnimation = dynamic_cast<AnimationAsset*>(
-                    assetManager.Load(skComp->OverrideAnimation.GetHandle()));
-
+                overrideAnimation = dynamic_cast<const AnimationAsset*>(request->GetAsset());
                 if (overrideAnimation &&
                     (uint64)overrideAnimation->m_SkeletonID != 0 &&
                     (uint64)overrideAnimation->m_SkeletonID != (uint64)skeleton->ID)
@@ -1717,205 +1679,60 @@ void AnimationModule::UpdateAnimations(float dt)
                 if (!overrideAnimation)
                     skComp->StopAnimation();
             }
-
-            if (overrideAnimation)
-            {
-                if (skComp->bPlayAnimation)
-                    skComp->OverridePlaybackTime += dt * skComp->OverridePlaybackSpeed;
-
-                skComp->OverridePlaybackTime = AnimationRuntime::NormalizePlaybackTime(
-                    skComp->OverridePlaybackTime,
-                    overrideAnimation->m_DurationSeconds,
-                    skComp->bOverrideAnimationLooping);
-
-                TArray<Mat4> overridePose = localBindPose;
-                evaluationTrace.Path = "Override";
-                evaluationTrace.PlaybackTime = skComp->OverridePlaybackTime;
-                evaluationTrace.ClipSummary = overrideAnimation->m_ClipName;
-                evaluationTrace.PrimaryAnimation = overrideAnimation;
-                bPoseEvaluated = AnimationRuntime::EvaluateLocalPose(
-                    skeleton,
-                    overrideAnimation,
-                    skComp->OverridePlaybackTime,
-                    localBindPose,
-                    overridePose,
-                    skComp->bEnableRootMotion);
-
-                if (bPoseEvaluated && skComp->bOverrideBlendActive)
-                {
-                    if (skComp->bPlayAnimation)
-                    {
-                        skComp->OverrideBlendElapsed += dt;
-                        if (skComp->OverrideBlendElapsed > skComp->OverrideBlendDuration)
-                            skComp->OverrideBlendElapsed = skComp->OverrideBlendDuration;
-                    }
-
-                    const float blendAlpha = skComp->OverrideBlendDuration > 1.0e-6f
-                        ? FMath::clamp(skComp->OverrideBlendElapsed / skComp->OverrideBlendDuration, 0.0f, 1.0f)
-                        : 1.0f;
-
-                    BlendLocalPoses(
-                        skComp->OverrideBlendSourcePose,
-                        overridePose,
-                        blendAlpha,
-                        localPose);
-
-                    if (blendAlpha >= 1.0f - 1.0e-6f)
-                    {
-                        skComp->bOverrideBlendActive = false;
-                        skComp->OverrideBlendDuration = 0.0f;
-                        skComp->OverrideBlendElapsed = 0.0f;
-                        skComp->OverrideBlendSourcePose.Clear();
-                    }
-                }
-                else if (bPoseEvaluated)
-                {
-                    localPose = std::move(overridePose);
-                }
-
-                if (bPoseEvaluated && skComp->bOverrideLockRootBoneTranslation)
-                    LockRootBoneTranslationToBindPose(skeleton, localBindPose, localPose);
-
-                skComp->PlaybackTime = skComp->OverridePlaybackTime;
-
-                if (!skComp->bOverrideAnimationLooping &&
-                    overrideAnimation->m_DurationSeconds > 0.0f &&
-                    skComp->OverridePlaybackTime >= overrideAnimation->m_DurationSeconds - 1.0e-4f)
-                {
-                    const float blendOutDuration = glm::max(0.0f, skComp->OverrideBlendOutDuration);
-                    const bool bCanBlendOut = blendOutDuration > 1.0e-6f && !localPose.IsEmpty();
-
-                    skComp->bOverrideAnimationActive = false;
-                    skComp->OverrideAnimation = {};
-                    skComp->OverridePlaybackTime = 0.0f;
-                    skComp->bOverrideBlendActive = false;
-                    skComp->OverrideBlendDuration = 0.0f;
-                    skComp->OverrideBlendElapsed = 0.0f;
-                    skComp->OverrideBlendSourcePose.Clear();
-                    skComp->bOverrideLockRootBoneTranslation = false;
-
-                    skComp->bOverrideBlendOutActive = bCanBlendOut;
-                    skComp->OverrideBlendOutElapsed = 0.0f;
-                    if (bCanBlendOut)
-                        skComp->OverrideBlendOutSourcePose = localPose;
-                    else
-                        skComp->OverrideBlendOutSourcePose.Clear();
-                }
-            }
-
-            if (!bPoseEvaluated)
-            {
-                AnimationAsset* animation = nullptr;
-                if ((uint64)skComp->Animation.GetHandle() != 0)
-                {
-                    animation = dynamic_cast<AnimationAsset*>(assetManager.Load(skComp->Animation.GetHandle()));
-
-                    if (animation && (uint64)animation->m_SkeletonID != 0 &&
-                        (uint64)animation->m_SkeletonID != (uint64)skeleton->ID)
-                    {
-                        animation = nullptr;
-                    }
-                }
-
-                if (animation)
-                {
-                    if (skComp->bPlayAnimation)
-                        skComp->PlaybackTime += dt * skComp->PlaybackSpeed;
-
-                    skComp->PlaybackTime = AnimationRuntime::NormalizePlaybackTime(
-                        skComp->PlaybackTime,
-                        animation->m_DurationSeconds,
-                        skComp->bLoopAnimation);
-
-                    evaluationTrace.Path = "Direct";
-                    evaluationTrace.PlaybackTime = skComp->PlaybackTime;
-                    evaluationTrace.ClipSummary = animation->m_ClipName;
-                    evaluationTrace.PrimaryAnimation = animation;
-                    bPoseEvaluated = AnimationRuntime::EvaluateLocalPose(
-                        skeleton,
-                        animation,
-                        skComp->PlaybackTime,
-                        localBindPose,
-                        localPose,
-                        skComp->bEnableRootMotion);
-
-                }
-                else
-                {
-                    skComp->PlaybackTime = 0.0f;
-                }
-            }
         }
+        const bool bWantsOverrideAnimation = overrideAnimation != nullptr;
 
-        if (!bPoseEvaluated)
-            localPose = localBindPose;
-
-        if (bPoseEvaluated && !skComp->bEnableRootMotion)
-        {
-            ApplyRootMotionRootLock(
-                skeleton,
-                localBindPose,
-                localPose,
-                evaluationTrace.PrimaryAnimation,
-                skComp->RootMotionRootLock);
-            StripRootMotionFromVisualPose(skeleton, localBindPose, localPose, skComp, &evaluationTrace);
-        }
-
-        if (skComp->bOverrideBlendOutActive)
-        {
-            const bool bValidBlendOutSource =
-                !skComp->OverrideBlendOutSourcePose.IsEmpty() &&
-                skComp->OverrideBlendOutSourcePose.Num() == localPose.Num();
-            if (!bValidBlendOutSource)
-            {
-                skComp->bOverrideBlendOutActive = false;
-                skComp->OverrideBlendOutElapsed = 0.0f;
-                skComp->OverrideBlendOutSourcePose.Clear();
-            }
-            else
-            {
-                if (skComp->bPlayAnimation)
-                {
-                    skComp->OverrideBlendOutElapsed += dt;
-                    if (skComp->OverrideBlendOutElapsed > skComp->OverrideBlendOutDuration)
-                        skComp->OverrideBlendOutElapsed = skComp->OverrideBlendOutDuration;
-                }
-
-                const float blendAlpha = skComp->OverrideBlendOutDuration > 1.0e-6f
-                    ? FMath::clamp(
-                        skComp->OverrideBlendOutElapsed / skComp->OverrideBlendOutDuration,
-                        0.0f,
-                        1.0f)
-                    : 1.0f;
-
-                TArray<Mat4> blendedPose;
-                BlendLocalPoses(skComp->OverrideBlendOutSourcePose, localPose, blendAlpha, blendedPose);
-                localPose = std::move(blendedPose);
+        AnimGraphAsset* animGraph = nullptr;
+        if (IsValidAssetHandle(skComp->AnimGraph.GetHandle()))
+            animGraph = dynamic_cast<AnimGraphAsset*>(assetManager.GetOrLoadAsync(skComp->AnimGraph.GetHandle(), EAssetLoadPriority::High));
 
-                if (blendAlpha >= 1.0f - 1.0e-6f)
-                {
-                    skComp->bOverrideBlendOutActive = false;
-                    skComp->OverrideBlendOutElapsed = 0.0f;
-                    skComp->OverrideBlendOutSourcePose.Clear();
-                }
-            }
-        }
+        // Loaded graphs compile in PostLoad; graphs built in code compile here,
+        // before any job reads the program.
+        if (animGraph && !animGraph->IsCompiled())
+            animGraph->Compile();
 
-        AnimationRuntime::BuildGlobalPose(skeleton, localPose, globalPose);
+        const Rebel::Core::Reflection::TypeInfo* requestedAnimInstanceType = nullptr;
+        if (animGraph && animGraph->m_AnimInstanceClass.Get())
+            requestedAnimInstanceType = animGraph->m_AnimInstanceClass.Get();
+        else if (skComp->AnimInstanceClass.Get())
+            requestedAnimInstanceType = skComp->AnimInstanceClass.Get();
 
-        TArray<Mat4> skinPalette;
-        if (!AnimationRuntime::BuildSkinPalette(skeleton, globalPose, skinPalette))
+        AnimInstance* animInstance = skComp->EnsureAnimInstance(requestedAnimInstanceType);
+        if (animInstance && !bWantsOverrideAnimation)
         {
-            ClearAnimationRuntimeData(skComp);
-            continue;
+            animInstance->SetRootMotionEnabled(skComp->bEnableRootMotion);
+            skComp->LocomotionState = BuildLocomotionStateForComponent(skComp);
         }
 
-        skComp->LocalPose = std::move(localPose);
-        skComp->GlobalPose = std::move(globalPose);
-        skComp->FinalPalette = std::move(skinPalette);
-
-        UpdateRuntimeBoneTransforms(skComp, skeleton, skComp->LocalPose, skComp->GlobalPose);
+        AnimationUpdateItem item;
+        item.Component = skComp;
+        item.Skeleton = skeleton;
+        item.AnimGraph = animGraph;
+        item.Instance = animInstance;
+        item.OverrideAnimation = overrideAnimation;
+        item.bWantsOverrideAnimation = bWantsOverrideAnimation;
+        // Resolving actor transforms may rebuild the shared hierarchy, so
+        // jobs get a snapshot instead of touching the owner.
+        if (!skComp->bEnableRootMotion && skComp->GetOwner())
+            item.OwnerForward = skComp->GetOwner()->GetActorForwardVector();
+        m_UpdateItems.Add(item);
     }
+
+    // Parallel phase: components are independent once their inputs are
+    // resolved. Clips that are not loaded yet are only queued from here;
+    // loads and their PostLoad never run on a job.
+    const AnimationUpdateItem* items = m_UpdateItems.Data();
+    auto evaluateRange = [items, &assetManager, dt](MemSize begin, MemSize end)
+    {
+        for (MemSize i = begin; i < end; ++i)
+            EvaluateComponentAnimation(items[i], assetManager, dt);
+    };
+
+    const MemSize count = m_UpdateItems.Num();
+    if (m_bParallelEvaluation && count >= kParallelEvaluateThreshold)
+        Rebel::Core::Threading::JobSystem::Get().ParallelFor(count, kParallelEvaluateGrain, evaluateRange);
+    else
+        evaluateRange(0, count);
 }
 
 void AnimationModule::Tick(float deltaTime)
@@ -18,6 +18,25 @@ void SkeletalMeshAsset::Deserialize(BinaryReader& ar)
 void SkeletalMeshAsset::PostLoad()
 {
     Asset::PostLoad();
+    ComputeBounds();
+}
+
+void SkeletalMeshAsset::DetachSourceViews()
+{
+    Vertices.DetachView();
+    Indices.DetachView();
+}
+
+MemSize SkeletalMeshAsset::GetMemorySize() const
+{
+    return Asset::GetMemorySize() + Vertices.GetAllocatedSize() + Indices.GetAllocatedSize() +
+           BoneBounds.GetAllocatedSize();
+}
+
+void SkeletalMeshAsset::ComputeBounds()
+{
+    Bounds = BoxSphereBounds::FromVertices(Vertices);
+    SkinnedBounds::BuildBoneBounds(Vertices, BoneBounds);
 }
 
 
@@ -1,5 +1,6 @@
 ﻿#include "Engine/Framework/EnginePch.h"
 #include "Engine/Animation/SkeletonAsset.h"
+#include "Engine/Animation/AnimationRuntime.h"
 #include <string>
 
 namespace
@@ -48,6 +49,110 @@ void SkeletonAsset::Deserialize(BinaryReader& ar)
 void SkeletonAsset::PostLoad()
 {
     Asset::PostLoad();
+    BuildBindPoseCache();
+}
+
+void SkeletonAsset::DetachSourceViews()
+{
+    m_Parent.DetachView();
+    m_InvBind.DetachView();
+}
+
+MemSize SkeletonAsset::GetMemorySize() const
+{
+    MemSize bytes = Asset::GetMemorySize() + m_Parent.GetAllocatedSize() + m_InvBind.GetAllocatedSize() +
+                    m_BoneNames.GetAllocatedSize();
+    for (const String& name : m_BoneNames)
+        bytes += name.length();
+
+    // Bind pose cache
+    bytes += m_EvaluationOrder.GetAllocatedSize() + m_EvaluationParents.GetAllocatedSize() +
+             m_LocalBindPose.GetAllocatedSize() + m_GlobalBindPose.GetAllocatedSize() +
+             m_BindSkinPalette.GetAllocatedSize();
+    return bytes;
+}
+
+bool SkeletonAsset::BuildBindPoseCache()
+{
+    BuildEvaluationOrder();
+
+    if (!AnimationRuntime::BuildBindPoses(this, m_LocalBindPose, m_GlobalBindPose) ||
+        !AnimationRuntime::BuildSkinPalette(this, m_GlobalBindPose, m_BindSkinPalette))
+    {
+        m_LocalBindPose.Clear();
+        m_GlobalBindPose.Clear();
+        m_BindSkinPalette.Clear();
+        return false;
+    }
+
+    return true;
+}
+
+void SkeletonAsset::BuildEvaluationOrder()
+{
+    // Runs from PostLoad while m_Parent may still be a view of the file.
+    const TArray<int32>& parents = m_Parent;
+    const int32 boneCount = static_cast<int32>(parents.Num());
+    m_EvaluationOrder.Clear();
+    m_EvaluationParents.Clear();
+    m_EvaluationOrder.Reserve(boneCount);
+    m_EvaluationParents.Reserve(boneCount);
+
+    auto IsValidParent = [boneCount](int32 parent) { return parent >= 0 && parent < boneCount; };
+
+    enum : uint8 { Unvisited, OnPath, Emitted };
+    TArray<uint8> state;
+    state.Resize(boneCount);
+    for (int32 i = 0; i < boneCount; ++i)
+        state[i] = Unvisited;
+
+    auto Emit = [&](int32 bone, int32 parent)
+    {
+        m_EvaluationOrder.Add(bone);
+        m_EvaluationParents.Add(parent);
+        state[bone] = Emitted;
+    };
+
+    // Walk up from each bone to the first emitted ancestor (or a root), then
+    // emit that chain top-down. Iterative, so deep rigs cannot blow the stack.
+    TArray<int32> chain;
+    for (int32 i = 0; i < boneCount; ++i)
+    {
+        if (state[i] == Emitted)
+            continue;
+
+        chain.Clear();
+        int32 bone = i;
+        while (true)
+        {
+            state[bone] = OnPath;
+            chain.Add(bone);
+
+            const int32 parent = parents[bone];
+            if (!IsValidParent(parent) || state[parent] == Emitted)
+                break;
+
+            if (state[parent] == OnPath)
+            {
+                // Cycle: evaluate the bone it closes on as a root, matching
+                // the old recursive resolver.
+                Emit(parent, -1);
+                break;
+            }
+
+            bone = parent;
+        }
+
+        for (int32 k = static_cast<int32>(chain.Num()) - 1; k >= 0; --k)
+        {
+            const int32 chainBone = chain[k];
+            if (state[chainBone] == Emitted)
+                continue;
+
+            const int32 parent = parents[chainBone];
+            Emit(chainBone, IsValidParent(parent) ? parent : -1);
+        }
+    }
 }
 
 
@@ -0,0 +1,244 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Assets/AssetArchive.h"
+#include "Engine/Assets/AssetFileHeader.h"
+
+DEFINE_LOG_CATEGORY(AssetArchiveLog)
+
+namespace
+{
+	// Blobs start on this boundary so a payload has the same alignment inside
+	// the archive as in its loose file, and its arrays can still be borrowed
+	// in place (MappedFileStream::View).
+	constexpr uint64 kBlobAlignment = 16;
+
+	void WritePadding(BinaryWriter& ar, uint64 alignment)
+	{
+		static constexpr uint8 zeros[kBlobAlignment] = {};
+		const uint64 padding = (alignment - ar.Tell() % alignment) % alignment;
+		if (padding > 0)
+			ar.WriteBytes(zeros, padding);
+	}
+
+	bool WriteArchive(const String& path, const TArray<String>& assetPaths, const TArray<String>& sourceRoots)
+	{
+		FileStream fs(path.c_str(), "wb");
+		if (!fs.IsOpen())
+			return false;
+
+		BinaryWriter ar(fs);
+
+		AssetArchiveHeader header{};
+		header.EntryCount = (uint32)assetPaths.Num();
+		ar.Write(header);
+
+		TArray<AssetArchiveEntry> toc;
+		toc.Reserve(assetPaths.Num());
+		std::string strings;
+
+		for (const String& assetPath : assetPaths)
+		{
+			const String filePath = assetPath + ".rasset";
+			MappedFile file(filePath.c_str());
+
+			AssetFileHeader fileHeader{};
+			if (file.IsOpen() && file.GetSize() >= sizeof(fileHeader))
+				std::memcpy(&fileHeader, file.GetData(), sizeof(fileHeader));
+
+			if (fileHeader.Magic != AssetFileHeader::MagicValue || fileHeader.AssetID == 0)
+			{
+				RB_LOG(AssetArchiveLog, error, "Cook failed: '{}' is not a valid asset file", filePath);
+				return false;
+			}
+
+			WritePadding(ar, kBlobAlignment);
+
+			AssetArchiveEntry entry{};
+			entry.AssetID = fileHeader.AssetID;
+			entry.TypeHash = fileHeader.TypeHash;
+			entry.Offset = ar.Tell();
+			entry.Size = file.GetSize();
+			entry.PathOffset = strings.size();
+			entry.PathLength = (uint32)assetPath.length();
+			toc.Add(entry);
+
+			strings.append(assetPath.c_str(), assetPath.length());
+			ar.WriteBytes(file.GetData(), file.GetSize());
+		}
+
+		std::sort(toc.begin(), toc.end(), [](const AssetArchiveEntry& a, const AssetArchiveEntry& b)
+		{
+			return a.AssetID < b.AssetID;
+		});
+
+		for (MemSize i = 1; i < toc.Num(); ++i)
+		{
+			if (toc[i].AssetID == toc[i - 1].AssetID)
+			{
+				RB_LOG(AssetArchiveLog, error, "Cook failed: asset ID {} appears twice", toc[i].AssetID);
+				return false;
+			}
+		}
+
+		WritePadding(ar, kBlobAlignment);
+		header.TocOffset = ar.Tell();
+		if (toc.Num() > 0)
+			ar.WriteBytes(toc.Data(), toc.Num() * sizeof(AssetArchiveEntry));
+
+		header.StringsOffset = ar.Tell();
+		if (!strings.empty())
+			ar.WriteBytes(strings.data(), strings.size());
+
+		header.RootsOffset = ar.Tell();
+		header.RootCount = (uint32)sourceRoots.Num();
+		for (const String& root : sourceRoots)
+		{
+			ar << (uint32)root.length();
+			ar.WriteBytes(root.c_str(), root.length());
+		}
+
+		ar.Seek(0);
+		ar.Write(header);
+		return true;
+	}
+}
+
+bool AssetArchive::Cook(const String& archivePath, const TArray<String>& assetPaths, const TArray<String>& sourceRoots)
+{
+	namespace fs = std::filesystem;
+
+	const String tempPath = archivePath + ".tmp";
+	if (!WriteArchive(tempPath, assetPaths, sourceRoots))
+	{
+		std::error_code ec;
+		fs::remove(fs::path(tempPath.c_str()), ec);
+		return false;
+	}
+
+	std::error_code ec;
+	fs::rename(fs::path(tempPath.c_str()), fs::path(archivePath.c_str()), ec);
+	if (ec)
+	{
+		RB_LOG(AssetArchiveLog, error, "Cook failed: could not replace '{}': {}", archivePath, ec.message());
+		fs::remove(fs::path(tempPath.c_str()), ec);
+		return false;
+	}
+
+	RB_LOG(AssetArchiveLog, info, "Cooked {} assets into '{}'", assetPaths.Num(), archivePath);
+	return true;
+}
+
+bool AssetArchive::Open(const String& archivePath)
+{
+	Close();
+
+	RSharedPtr<MappedFile> mapping = RMakeShared<MappedFile>(archivePath.c_str());
+	if (!mapping->IsOpen())
+		return false;
+
+	const uint64 size = mapping->GetSize();
+	AssetArchiveHeader header{};
+	if (size >= sizeof(header))
+		std::memcpy(&header, mapping->GetData(), sizeof(header));
+
+	if (header.Magic != AssetArchiveHeader::MagicValue || header.Version != AssetArchiveHeader::CurrentVersion)
+	{
+		RB_LOG(AssetArchiveLog, error, "'{}' is not a supported asset archive", archivePath);
+		return false;
+	}
+
+	const uint64 tocBytes = (uint64)header.EntryCount * sizeof(AssetArchiveEntry);
+	if (header.TocOffset % alignof(AssetArchiveEntry) != 0 ||
+		header.TocOffset > size || tocBytes > size - header.TocOffset ||
+		header.StringsOffset > size || header.RootsOffset > size)
+	{
+		RB_LOG(AssetArchiveLog, error, "Asset archive '{}' has a corrupt table of contents", archivePath);
+		return false;
+	}
+
+	// Checked once here so loads can trust every range in the TOC.
+	const AssetArchiveEntry* toc = reinterpret_cast<const AssetArchiveEntry*>(mapping->GetData() + header.TocOffset);
+	for (uint32 i = 0; i < header.EntryCount; ++i)
+	{
+		const AssetArchiveEntry& entry = toc[i];
+		const uint64 pathBegin = header.StringsOffset + entry.PathOffset;
+		if (entry.Offset > header.TocOffset || entry.Size > header.TocOffset - entry.Offset ||
+			entry.PathOffset > size - header.StringsOffset || entry.PathLength > size - pathBegin ||
+			(i > 0 && toc[i - 1].AssetID >= entry.AssetID))
+		{
+			RB_LOG(AssetArchiveLog, error, "Asset archive '{}' has a corrupt entry for asset {}", archivePath, entry.AssetID);
+			return false;
+		}
+	}
+
+	TArray<String> roots;
+	uint64 cursor = header.RootsOffset;
+	for (uint32 i = 0; i < header.RootCount; ++i)
+	{
+		uint32 length = 0;
+		if (sizeof(length) > size - cursor)
+			break;
+		std::memcpy(&length, mapping->GetData() + cursor, sizeof(length));
+		cursor += sizeof(length);
+		if (length > size - cursor)
+			break;
+		roots.Add(String(reinterpret_cast<const char*>(mapping->GetData() + cursor), length));
+		cursor += length;
+	}
+
+	if (roots.Num() != header.RootCount)
+	{
+		RB_LOG(AssetArchiveLog, error, "Asset archive '{}' has a corrupt source root list", archivePath);
+		return false;
+	}
+
+	m_Mapping = mapping;
+	m_Toc = toc;
+	m_EntryCount = header.EntryCount;
+	m_StringsOffset = header.StringsOffset;
+	m_SourceRoots = std::move(roots);
+	return true;
+}
+
+void AssetArchive::Close()
+{
+	m_Mapping.Reset();
+	m_Toc = nullptr;
+	m_EntryCount = 0;
+	m_StringsOffset = 0;
+	m_SourceRoots.Clear();
+}
+
+String AssetArchive::GetEntryPath(const AssetArchiveEntry& entry) const
+{
+	if (!m_Mapping)
+		return String();
+
+	const uint64 size = m_Mapping->GetSize();
+	const uint64 begin = m_StringsOffset + entry.PathOffset;
+	if (begin > size || entry.PathLength > size - begin)
+		return String();
+
+	return String(reinterpret_cast<const char*>(m_Mapping->GetData() + begin), entry.PathLength);
+}
+
+const AssetArchiveEntry* AssetArchive::Find(AssetHandle id) const
+{
+	const uint64 key = (uint64)id;
+	const AssetArchiveEntry* end = m_Toc + m_EntryCount;
+	const AssetArchiveEntry* it = std::lower_bound(m_Toc, end, key, [](const AssetArchiveEntry& entry, uint64 value)
+	{
+		return entry.AssetID < value;
+	});
+
+	return it != end && it->AssetID == key ? it : nullptr;
+}
+
+bool AssetArchive::CoversRoot(const String& root) const
+{
+	for (const String& sourceRoot : m_SourceRoots)
+	{
+		if (sourceRoot == root)
+			return true;
+	}
+	return false;
+}
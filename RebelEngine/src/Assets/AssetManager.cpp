@@ -0,0 +1,520 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Assets/AssetManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+DEFINE_LOG_CATEGORY(AssetMemoryLog)
+
+using Rebel::Core::Threading::JobSystem;
+
+namespace
+{
+	void RemoveRequest(std::vector<AssetLoadHandle>& requests, const AssetLoadHandle& request)
+	{
+		for (MemSize i = 0; i < requests.size(); ++i)
+		{
+			if (requests[i].Get() == request.Get())
+			{
+				requests.erase(requests.begin() + i);
+				return;
+			}
+		}
+	}
+
+	void RunCallbacks(std::vector<AssetLoadCallback>& callbacks, Asset* asset)
+	{
+		for (AssetLoadCallback& callback : callbacks)
+		{
+			if (callback)
+				callback(asset);
+		}
+	}
+}
+
+AssetManager::~AssetManager()
+{
+	CancelAsyncLoads();
+
+	// Assets about to be destroyed release the AssetPtrs they hold; they
+	// must not call back into a manager that is half torn down.
+	if (AssetPtrBase::GetReferenceTracker() == this)
+		AssetPtrBase::SetReferenceTracker(nullptr);
+
+	Clear();
+}
+
+void AssetManager::Clear()
+{
+	CancelAsyncLoads();
+
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	m_LoadedAssets.Clear();
+	m_FreeSlots.Clear();
+	m_Slots.Clear();
+	m_ResidentBytes = 0;
+}
+
+void AssetManager::StoreAsset(Asset* raw, bool bEvictable)
+{
+	uint32 slot;
+	if (!m_FreeSlots.IsEmpty())
+	{
+		slot = m_FreeSlots.Back();
+		m_FreeSlots.PopBack();
+	}
+	else
+	{
+		slot = static_cast<uint32>(m_Slots.Num());
+		m_Slots.Emplace();
+	}
+
+	AssetSlot& entry = m_Slots[slot];
+	entry.Instance.Reset(raw);
+	entry.Bytes = raw->GetMemorySize();
+	entry.LastUsed = ++m_UseCounter;
+	entry.bEvictable = bEvictable;
+
+	m_ResidentBytes += entry.Bytes;
+	m_LoadedAssets[raw->ID] = slot;
+}
+
+void AssetManager::FreeSlot(uint32 slot)
+{
+	AssetSlot& entry = m_Slots[slot];
+	m_LoadedAssets.Remove(entry.Instance->ID);
+	m_ResidentBytes -= std::min(m_ResidentBytes, entry.Bytes);
+	entry.Bytes = 0;
+	entry.bEvictable = false;
+	m_FreeSlots.Add(slot);
+
+	// Last, since the destructor can release AssetPtrs back into this manager.
+	entry.Instance.Reset();
+}
+
+void AssetManager::RemeasureSlots()
+{
+	m_ResidentBytes = 0;
+	for (AssetSlot& slot : m_Slots)
+	{
+		if (!slot.Instance)
+			continue;
+		slot.Bytes = slot.Instance->GetMemorySize();
+		m_ResidentBytes += slot.Bytes;
+	}
+}
+
+void AssetManager::AddAssetReference(AssetHandle handle)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	++m_ReferenceCounts[handle];
+}
+
+void AssetManager::ReleaseAssetReference(AssetHandle handle)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	uint32* count = m_ReferenceCounts.Find(handle);
+	if (!count)
+		return;
+	if (--*count == 0)
+		m_ReferenceCounts.Remove(handle);
+}
+
+AssetMemoryReport AssetManager::GetResidentBytes()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	RemeasureSlots();
+
+	AssetMemoryReport report;
+	report.TotalBytes = m_ResidentBytes;
+	report.BudgetBytes = m_MemoryBudget;
+
+	for (const AssetSlot& slot : m_Slots)
+	{
+		if (!slot.Instance)
+			continue;
+
+		const Rebel::Core::Reflection::TypeInfo* type = slot.Instance->GetType();
+		AssetTypeMemory* typeMemory = nullptr;
+		for (AssetTypeMemory& existing : report.Types)
+		{
+			if (existing.Type == type)
+			{
+				typeMemory = &existing;
+				break;
+			}
+		}
+		if (!typeMemory)
+		{
+			typeMemory = &report.Types.Emplace();
+			typeMemory->Type = type;
+		}
+
+		++typeMemory->Count;
+		typeMemory->Bytes += slot.Bytes;
+	}
+
+	std::sort(report.Types.begin(), report.Types.end(),
+		[](const AssetTypeMemory& a, const AssetTypeMemory& b) { return a.Bytes > b.Bytes; });
+	return report;
+}
+
+uint32 AssetManager::EnforceMemoryBudget()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	if (m_MemoryBudget == 0 || m_ResidentBytes <= m_MemoryBudget)
+		return 0;
+
+	// Sizes recorded at load miss later growth (e.g. caches built on use).
+	RemeasureSlots();
+
+	uint32 evicted = 0;
+	TArray<uint32> candidates;
+	while (m_ResidentBytes > m_MemoryBudget)
+	{
+		candidates.Clear();
+		for (uint32 i = 0; i < m_Slots.Num(); ++i)
+		{
+			const AssetSlot& slot = m_Slots[i];
+			if (slot.Instance && slot.bEvictable && slot.Instance->CanEvict() &&
+				!m_ReferenceCounts.Find(slot.Instance->ID))
+				candidates.Add(i);
+		}
+
+		std::sort(candidates.begin(), candidates.end(),
+			[this](uint32 a, uint32 b) { return m_Slots[a].LastUsed < m_Slots[b].LastUsed; });
+
+		uint32 evictedThisPass = 0;
+		for (uint32 slot : candidates)
+		{
+			if (m_ResidentBytes <= m_MemoryBudget)
+				break;
+
+			// Evicting only ever releases references, so every candidate
+			// is still unreferenced here.
+			RB_LOG(AssetMemoryLog, trace, "Evicting asset '{}' ({} bytes)",
+				m_Slots[slot].Instance->Path, m_Slots[slot].Bytes);
+			FreeSlot(slot);
+			++evictedThisPass;
+		}
+
+		// Evicted assets released their own AssetPtrs, which can leave their
+		// dependencies (a mesh's skeleton) unreferenced for another pass.
+		if (evictedThisPass == 0)
+			break;
+		evicted += evictedThisPass;
+	}
+
+	if (m_ResidentBytes > m_MemoryBudget)
+	{
+		RB_LOG(AssetMemoryLog, warn, "Assets use {} bytes, over the {} byte budget, with nothing left to evict",
+			m_ResidentBytes, m_MemoryBudget);
+	}
+	else if (evicted > 0)
+	{
+		RB_LOG(AssetMemoryLog, info, "Evicted {} assets, {} bytes resident", evicted, m_ResidentBytes);
+	}
+
+	return evicted;
+}
+
+MemSize AssetManager::FindNextAsyncLoad(const std::vector<AssetLoadHandle>& requests)
+{
+	MemSize best = 0;
+	for (MemSize i = 1; i < requests.size(); ++i)
+	{
+		const AssetLoadRequest& candidate = *requests[i];
+		const AssetLoadRequest& current = *requests[best];
+		if (candidate.m_Priority > current.m_Priority ||
+			(candidate.m_Priority == current.m_Priority && candidate.m_Sequence < current.m_Sequence))
+		{
+			best = i;
+		}
+	}
+	return best;
+}
+
+Asset* AssetManager::DeserializeAsset(const AssetMeta& meta)
+{
+	PROFILE_SCOPE("Asset loaded '" + meta.Path+"'")
+	Asset* raw = static_cast<Asset*>(meta.Type->CreateInstance());
+	raw->ID   = meta.ID;
+	raw->Path = meta.Path;
+
+	// OPEN THE REAL FILE (or its blob in the mounted archive)
+	// Mapped rather than read: raw arrays adopt the mapped bytes in place
+	// and the asset keeps the mapping alive for them.
+	String fullPath = meta.Path + ".rasset";
+	MappedFileStream fs = meta.Archive
+		? MappedFileStream(meta.Archive, meta.ArchiveOffset, meta.FileSize, true)
+		: MappedFileStream(fullPath.c_str(), true);
+	BinaryReader ar(fs);
+
+	// READ HEADER
+	AssetFileHeader header;
+	ar.Read(header);
+
+	assert(header.Magic == AssetFileHeader::MagicValue);
+	assert(header.AssetID == (uint64)meta.ID);
+	raw->SerializedVersion = header.Version;
+
+	// SEEK TO PAYLOAD
+	ar.Seek(header.PayloadOffset);
+
+	// NOW read the real asset
+	raw->Deserialize(ar);
+	if (fs.HasLentViews())
+		raw->SourceMapping = fs.GetMapping();
+
+	return raw;
+}
+
+void AssetManager::AddLoadedAsset(Asset* raw)
+{
+	raw->PostLoad();
+	StoreAsset(raw, true);
+}
+
+std::vector<AssetLoadCallback> AssetManager::CompleteAsyncLoad(const AssetLoadHandle& request, Asset* asset)
+{
+	request->m_Staged.Reset();
+	request->m_Asset = asset;
+	request->m_State.store(asset ? AssetLoadRequest::EState::Ready : AssetLoadRequest::EState::Failed,
+		std::memory_order_release);
+
+	m_AsyncRequests.Remove(request->m_ID);
+	RemoveRequest(m_AsyncQueue, request);
+	RemoveRequest(m_AsyncLoaded, request);
+
+	std::vector<AssetLoadCallback> callbacks;
+	callbacks.swap(request->m_Callbacks);
+	return callbacks;
+}
+
+Asset* AssetManager::Load(AssetHandle id)
+{
+	std::vector<AssetLoadCallback> callbacks;
+	Asset* raw = nullptr;
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (uint32* slot = m_LoadedAssets.Find(id))
+			return TouchSlot(*slot);
+
+		const AssetMeta* meta = m_Registry.Get(id);
+		if (!meta || !meta->Type || !meta->Type->CreateInstance)
+			return nullptr;
+
+		AssetLoadHandle request;
+		if (AssetLoadHandle* pending = m_AsyncRequests.Find(id))
+			request = *pending;
+
+		// A worker already did the I/O; only PostLoad is left. Otherwise load
+		// here and now, and a worker result that lands later is dropped.
+		if (request && request->GetState() == AssetLoadRequest::EState::Loaded)
+			raw = request->m_Staged.Release();
+		else
+			raw = DeserializeAsset(*meta);
+
+		AddLoadedAsset(raw);
+
+		if (request)
+			callbacks = CompleteAsyncLoad(request, raw);
+	}
+
+	RunCallbacks(callbacks, raw);
+	return raw;
+}
+
+AssetLoadHandle AssetManager::LoadAsync(AssetHandle id, EAssetLoadPriority priority, AssetLoadCallback onLoaded)
+{
+	AssetLoadHandle request;
+	Asset* loaded = nullptr;
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (AssetLoadHandle* pending = m_AsyncRequests.Find(id))
+		{
+			// Deduplicated; a more urgent caller bumps the shared request.
+			request = *pending;
+			if (priority > request->m_Priority)
+				request->m_Priority = priority;
+			if (onLoaded)
+				request->m_Callbacks.push_back(std::move(onLoaded));
+			return request;
+		}
+
+		request = RMakeShared<AssetLoadRequest>();
+		request->m_ID = id;
+		request->m_Priority = priority;
+		request->m_Sequence = m_AsyncSequence++;
+
+		if (uint32* slot = m_LoadedAssets.Find(id))
+		{
+			loaded = TouchSlot(*slot);
+			request->m_Asset = loaded;
+			request->m_State.store(AssetLoadRequest::EState::Ready, std::memory_order_release);
+		}
+		else
+		{
+			const AssetMeta* meta = m_Registry.Get(id);
+			if (!meta || !meta->Type || !meta->Type->CreateInstance)
+			{
+				request->m_State.store(AssetLoadRequest::EState::Failed, std::memory_order_release);
+			}
+			else
+			{
+				// Workers load from this copy; the registry may be rescanned or
+				// recooked on the game thread while the request is in flight.
+				request->m_Meta = *meta;
+				if (onLoaded)
+					request->m_Callbacks.push_back(std::move(onLoaded));
+
+				m_AsyncRequests[id] = request;
+				m_AsyncQueue.push_back(request);
+			}
+		}
+	}
+
+	if (!request->IsDone())
+	{
+		// Without workers nothing would run the job until someone waits, so
+		// FinalizeAsyncLoads does the deserialization itself instead.
+		JobSystem& jobs = JobSystem::Get();
+		if (jobs.GetWorkerCount() > 0)
+			jobs.Schedule([this]() { ProcessNextAsyncLoad(); }, &m_AsyncJobs);
+		return request;
+	}
+
+	if (onLoaded)
+		onLoaded(loaded);
+	return request;
+}
+
+Asset* AssetManager::GetOrLoadAsync(AssetHandle id, EAssetLoadPriority priority)
+{
+	if (!IsValidAssetHandle(id))
+		return nullptr;
+
+	if (Asset* asset = Get(id))
+		return asset;
+
+	LoadAsync(id, priority);
+	return nullptr;
+}
+
+void AssetManager::ProcessNextAsyncLoad()
+{
+	AssetLoadHandle request;
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (m_AsyncQueue.empty())
+			return;
+
+		const MemSize next = FindNextAsyncLoad(m_AsyncQueue);
+		request = m_AsyncQueue[next];
+		m_AsyncQueue.erase(m_AsyncQueue.begin() + next);
+		request->m_State.store(AssetLoadRequest::EState::Loading, std::memory_order_release);
+	}
+
+	// m_Meta is written once in LoadAsync, before the request was queued.
+	Asset* raw = DeserializeAsset(request->m_Meta);
+
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	if (request->GetState() != AssetLoadRequest::EState::Loading)
+	{
+		// A synchronous Load or a cancel got there first.
+		delete raw;
+		return;
+	}
+
+	request->m_Staged.Reset(raw);
+	request->m_State.store(AssetLoadRequest::EState::Loaded, std::memory_order_release);
+	m_AsyncLoaded.push_back(request);
+}
+
+uint32 AssetManager::FinalizeAsyncLoads(float budgetMs)
+{
+	using Clock = std::chrono::steady_clock;
+	const Clock::time_point start = Clock::now();
+	auto budgetLeft = [start, budgetMs]()
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count() < budgetMs;
+	};
+
+	// No workers: deserialize here, inside the same budget.
+	if (JobSystem::Get().GetWorkerCount() == 0)
+	{
+		auto hasQueued = [this]()
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+			return !m_AsyncQueue.empty();
+		};
+		while (hasQueued() && budgetLeft())
+			ProcessNextAsyncLoad();
+	}
+
+	uint32 finalized = 0;
+	do
+	{
+		std::vector<AssetLoadCallback> callbacks;
+		Asset* raw = nullptr;
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+			if (m_AsyncLoaded.empty())
+				break;
+
+			const AssetLoadHandle request = m_AsyncLoaded[FindNextAsyncLoad(m_AsyncLoaded)];
+			if (request->GetState() == AssetLoadRequest::EState::Loaded)
+			{
+				raw = request->m_Staged.Release();
+				AddLoadedAsset(raw);
+			}
+
+			callbacks = CompleteAsyncLoad(request, raw);
+		}
+
+		RunCallbacks(callbacks, raw);
+		++finalized;
+	}
+	while (budgetLeft());
+
+	return finalized;
+}
+
+void AssetManager::FlushAsyncLoads()
+{
+	while (GetAsyncLoadCount() > 0)
+	{
+		if (JobSystem::Get().GetWorkerCount() > 0)
+			JobSystem::Get().Wait(m_AsyncJobs);
+
+		FinalizeAsyncLoads(std::numeric_limits<float>::max());
+	}
+}
+
+void AssetManager::CancelAsyncLoads()
+{
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		for (const AssetLoadHandle& request : m_AsyncQueue)
+			request->m_State.store(AssetLoadRequest::EState::Failed, std::memory_order_release);
+		m_AsyncQueue.clear();
+	}
+
+	// Workers mid-deserialization still hold this manager.
+	if (!m_AsyncJobs.IsDone())
+		JobSystem::Get().Wait(m_AsyncJobs);
+
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+	for (const AssetLoadHandle& request : m_AsyncLoaded)
+	{
+		request->m_Staged.Reset();
+		request->m_Callbacks.clear();
+		request->m_State.store(AssetLoadRequest::EState::Failed, std::memory_order_release);
+	}
+	m_AsyncLoaded.clear();
+	m_AsyncRequests.Clear();
+}
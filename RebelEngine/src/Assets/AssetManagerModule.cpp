@@ -5,36 +5,91 @@
 
 DEFINE_LOG_CATEGORY(AssetManagerLog)
 
-void AssetManagerModule::ScanDirectory()
+namespace
 {
-    namespace fs = std::filesystem;
-
-    m_Registry.Clear();
-
-    std::vector<fs::path> roots;
-    auto addRootIfExists = [&roots](const char* path)
+    // Directories scanned for loose .rasset files, relative to the working
+    // directory; duplicates of the same path are dropped.
+    std::vector<std::filesystem::path> GatherAssetRoots()
     {
-        fs::path rootPath(path);
-        if (!fs::exists(rootPath))
-            return;
+        namespace fs = std::filesystem;
 
-        for (const fs::path& existing : roots)
+        std::vector<fs::path> roots;
+        auto addRootIfExists = [&roots](const char* path)
         {
-            if (existing == rootPath)
+            fs::path rootPath(path);
+            if (!fs::exists(rootPath))
                 return;
-        }
 
-        roots.push_back(rootPath);
-    };
+            for (const fs::path& existing : roots)
+            {
+                if (existing == rootPath)
+                    return;
+            }
+
+            roots.push_back(rootPath);
+        };
+
+        addRootIfExists("Editor/assets");
+        addRootIfExists("editor/assets");
+        addRootIfExists("Assets");
+        addRootIfExists("assets");
+        return roots;
+    }
+}
+
+void AssetManagerModule::ScanDirectory()
+{
+    m_Registry.Clear();
+
+    MountArchive();
+    ScanLooseFiles();
 
-    addRootIfExists("Editor/assets");
-    addRootIfExists("editor/assets");
-    addRootIfExists("Assets");
-    addRootIfExists("assets");
+    RB_LOG(AssetManagerLog, info, "Registered {} loose assets, {} packed",
+        m_Registry.GetAll().Num(), m_Archive.GetEntryCount());
+}
+
+void AssetManagerModule::MountArchive()
+{
+    m_Archive.Close();
+
+    std::error_code ec;
+    if (!std::filesystem::exists(AssetArchive::DefaultPath, ec))
+        return;
+
+    // Entries are resolved through the TOC on lookup, not registered here.
+    if (m_Archive.Open(AssetArchive::DefaultPath))
+        m_Registry.MountArchive(&m_Archive);
+}
+
+void AssetManagerModule::ScanLooseFiles()
+{
+    namespace fs = std::filesystem;
+
+    std::vector<fs::path> roots = GatherAssetRoots();
+
+    // Everything under a root the mounted archive was cooked from is packed
+    // already, so those directories are not walked at all.
+    if (m_Archive.IsOpen() && !m_bScanArchivedRoots)
+    {
+        roots.erase(std::remove_if(roots.begin(), roots.end(), [this](const fs::path& root)
+        {
+            return m_Archive.CoversRoot(String(root.generic_string().c_str()));
+        }), roots.end());
+    }
 
     if (roots.empty())
         return;
 
+    if (m_bUseRegistryCache && !m_bRegistryCacheLoaded)
+    {
+        m_RegistryCache.Load(AssetRegistryCache::DefaultPath);
+        m_bRegistryCacheLoaded = true;
+    }
+
+    // Rebuilt every scan so deleted files drop out of the cache.
+    AssetRegistryCache scanned;
+    uint32 headersRead = 0;
+
     for (const fs::path& root : roots)
     {
         for (const fs::directory_entry& entry : fs::recursive_directory_iterator(root))
@@ -46,19 +101,48 @@ void AssetManagerModule::ScanDirectory()
             if (filePath.extension() != ".rasset")
                 continue;
 
-            std::ifstream in(filePath, std::ios::binary);
-            if (!in.is_open())
-                continue;
-
-            AssetFileHeader header{};
-            in.read((char*)&header, sizeof(header));
-
-            if (!in || header.Magic != AssetFileHeader::MagicValue)
+            // Size and write time come from the directory walk itself; only
+            // new or changed files are opened.
+            const String fileKey = filePath.generic_string().c_str();
+            const uint64 fileSize = (uint64)entry.file_size();
+            const int64 writeTime = (int64)entry.last_write_time().time_since_epoch().count();
+
+            const AssetRegistryCache::Entry* cached =
+                m_bUseRegistryCache ? m_RegistryCache.Find(fileKey, fileSize, writeTime) : nullptr;
+
+            AssetRegistryCache::Entry header;
+            if (cached)
+            {
+                header = *cached;
+            }
+            else
+            {
+                std::ifstream in(filePath, std::ios::binary);
+                if (!in.is_open())
+                    continue;
+
+                AssetFileHeader fileHeader{};
+                in.read((char*)&fileHeader, sizeof(fileHeader));
+                ++headersRead;
+
+                header.FileSize = fileSize;
+                header.WriteTime = writeTime;
+                header.AssetID = fileHeader.AssetID;
+                header.TypeHash = fileHeader.TypeHash;
+                header.Version = fileHeader.Version;
+                header.bValidHeader = in && fileHeader.Magic == AssetFileHeader::MagicValue;
+            }
+
+            scanned.Store(fileKey, header);
+
+            if (!header.bValidHeader)
                 continue;
 
             if (header.Version < 1)
                 continue;
 
+            // Resolved every scan, not cached: the set of reflected types
+            // belongs to the build, not to the files.
             const Rebel::Core::Reflection::TypeInfo* type =
                 Rebel::Core::Reflection::TypeRegistry::Get().GetTypeByHash(header.TypeHash);
 
@@ -72,11 +156,65 @@ void AssetManagerModule::ScanDirectory()
             meta.ID         = AssetHandle(header.AssetID);
             meta.Type       = type;
             meta.Path       = String(noExt.generic_string().c_str());
-            meta.FileSize   = (uint64)entry.file_size();
+            meta.FileSize   = fileSize;
 
+            // Registered after the archive, so a loose file wins over its
+            // packed copy.
             m_Registry.Register(meta);
         }
     }
+
+    if (!m_bUseRegistryCache)
+        return;
+
+    const bool bChanged = headersRead > 0 || scanned.Num() != m_RegistryCache.Num();
+    m_RegistryCache = std::move(scanned);
+    if (bChanged)
+        m_RegistryCache.Save(AssetRegistryCache::DefaultPath);
+
+    RB_LOG(AssetManagerLog, debug, "Asset scan read {} of {} headers", headersRead, m_RegistryCache.Num());
+}
+
+void AssetManagerModule::SetScanArchivedRoots(bool bEnabled)
+{
+    if (m_bScanArchivedRoots == bEnabled)
+        return;
+
+    m_bScanArchivedRoots = bEnabled;
+    if (m_Archive.IsOpen())
+        RescanAssets();
+}
+
+void AssetManagerModule::SetRegistryCacheEnabled(bool bEnabled)
+{
+    m_bUseRegistryCache = bEnabled;
+    m_bRegistryCacheLoaded = false;
+    m_RegistryCache.Clear();
+}
+
+bool AssetManagerModule::CookArchive(const String& archivePath)
+{
+    // The archive being replaced may be mounted and mapped by loaded assets,
+    // which would block the replace on Windows. Let go of it first; loaded
+    // assets stay loaded with owned copies of their data.
+    m_Manager.ReleaseSourceMappings();
+    m_Registry.Clear();
+    m_Archive.Close();
+
+    ScanLooseFiles();
+
+    TArray<String> assetPaths;
+    for (const auto& pair : m_Registry.GetAll())
+        assetPaths.Add(pair.Value.Path);
+
+    TArray<String> sourceRoots;
+    for (const std::filesystem::path& root : GatherAssetRoots())
+        sourceRoots.Add(String(root.generic_string().c_str()));
+
+    const bool bCooked = AssetArchive::Cook(archivePath, assetPaths, sourceRoots);
+
+    ScanDirectory();
+    return bCooked;
 }
 
 
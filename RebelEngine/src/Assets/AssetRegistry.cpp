@@ -0,0 +1,32 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Assets/AssetRegistry.h"
+#include "Engine/Assets/AssetArchive.h"
+
+const AssetMeta* AssetRegistry::FindPacked(AssetHandle id) const
+{
+	std::lock_guard<std::mutex> lock(m_PackedMutex);
+
+	if (const RUniquePtr<AssetMeta>* resolved = m_Packed.Find(id))
+		return resolved->Get();
+
+	const AssetArchiveEntry* entry = m_Archive->Find(id);
+	if (!entry)
+		return nullptr;
+
+	const Rebel::Core::Reflection::TypeInfo* type =
+		Rebel::Core::Reflection::TypeRegistry::Get().GetTypeByHash(entry->TypeHash);
+	if (!type)
+		return nullptr;
+
+	RUniquePtr<AssetMeta> meta = RMakeUnique<AssetMeta>();
+	meta->ID            = id;
+	meta->Type          = type;
+	meta->Path          = m_Archive->GetEntryPath(*entry);
+	meta->FileSize      = entry->Size;
+	meta->Archive       = m_Archive->GetMapping();
+	meta->ArchiveOffset = entry->Offset;
+
+	const AssetMeta* result = meta.Get();
+	m_Packed.Emplace(id, std::move(meta));
+	return result;
+}
@@ -0,0 +1,125 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Assets/AssetRegistryCache.h"
+
+DEFINE_LOG_CATEGORY(AssetRegistryCacheLog)
+
+namespace
+{
+	struct CacheFileHeader
+	{
+		// 'RARC' = Rebel Asset Registry Cache
+		static constexpr uint32 MagicValue = 0x43524152;
+		static constexpr uint32 CurrentVersion = 1;
+
+		uint32 Magic = MagicValue;
+		uint32 Version = CurrentVersion;
+		uint64 EntryCount = 0;
+	};
+
+	// Path length plus the fixed-size fields of one entry on disk.
+	constexpr uint64 kMinEntryBytes =
+		sizeof(uint32) + sizeof(uint64) * 4 + sizeof(uint32) + sizeof(uint8);
+}
+
+bool AssetRegistryCache::Load(const String& path)
+{
+	m_Entries.Clear();
+
+	std::error_code ec;
+	if (!std::filesystem::exists(path.c_str(), ec))
+		return false;
+
+	MappedFileStream fs(path.c_str());
+	if (!fs.IsOpen())
+		return false;
+
+	const uint64 size = fs.GetMapping()->GetSize();
+	BinaryReader ar(fs);
+
+	CacheFileHeader header{};
+	if (size >= sizeof(header))
+		ar.Read(header);
+
+	if (header.Magic != CacheFileHeader::MagicValue ||
+		header.Version != CacheFileHeader::CurrentVersion ||
+		header.EntryCount > (size - sizeof(header)) / kMinEntryBytes)
+	{
+		RB_LOG(AssetRegistryCacheLog, warn, "Ignoring unreadable asset registry cache '{}'", path);
+		return false;
+	}
+
+	m_Entries.Reserve((MemSize)header.EntryCount);
+	for (uint64 i = 0; i < header.EntryCount; ++i)
+	{
+		uint32 pathLength = 0;
+		ar >> pathLength;
+		if (pathLength > size - ar.Tell())
+		{
+			RB_LOG(AssetRegistryCacheLog, warn, "Ignoring truncated asset registry cache '{}'", path);
+			m_Entries.Clear();
+			return false;
+		}
+
+		TArray<char> pathBytes;
+		pathBytes.Resize(pathLength);
+		ar.ReadBytes(pathBytes.Data(), pathLength);
+		String filePath(pathBytes.Data(), pathLength);
+
+		Entry entry;
+		uint8 bValidHeader = 0;
+		ar >> entry.FileSize;
+		ar >> entry.WriteTime;
+		ar >> entry.AssetID;
+		ar >> entry.TypeHash;
+		ar >> entry.Version;
+		ar >> bValidHeader;
+		entry.bValidHeader = bValidHeader != 0;
+
+		m_Entries[filePath] = entry;
+	}
+
+	return true;
+}
+
+bool AssetRegistryCache::Save(const String& path) const
+{
+	FileStream fs(path.c_str(), "wb");
+	if (!fs.IsOpen())
+		return false;
+
+	BinaryWriter ar(fs);
+
+	CacheFileHeader header{};
+	header.EntryCount = m_Entries.Num();
+	ar.Write(header);
+
+	for (const auto& pair : m_Entries)
+	{
+		const String& filePath = pair.Key;
+		const Entry& entry = pair.Value;
+		ar << (uint32)filePath.length();
+		ar.WriteBytes(filePath.c_str(), filePath.length());
+		ar << entry.FileSize;
+		ar << entry.WriteTime;
+		ar << entry.AssetID;
+		ar << entry.TypeHash;
+		ar << entry.Version;
+		ar << (uint8)(entry.bValidHeader ? 1 : 0);
+	}
+
+	return true;
+}
+
+const AssetRegistryCache::Entry* AssetRegistryCache::Find(const String& filePath, uint64 fileSize, int64 writeTime) const
+{
+	const Entry* entry = m_Entries.Find(filePath);
+	if (!entry || entry->FileSize != fileSize || entry->WriteTime != writeTime)
+		return nullptr;
+
+	return entry;
+}
+
+void AssetRegistryCache::Store(const String& filePath, const Entry& entry)
+{
+	m_Entries[filePath] = entry;
+}
@@ -17,9 +17,26 @@ void MeshAsset::Deserialize(BinaryReader& ar)
 
 void MeshAsset::PostLoad()
 {
+	ComputeBounds();
+
 	/*auto ogl = static_cast<OpenGLRenderAPI*>(GEngine->GetModuleManager().GetModule<RenderModule>()->GetRendererAPI());
 	Handle = ogl->AddStaticMesh(Vertices, Indices);
 	Vertices.Clear();
 	Indices.Clear();*/
 }
 
+void MeshAsset::DetachSourceViews()
+{
+	Vertices.DetachView();
+	Indices.DetachView();
+}
+
+MemSize MeshAsset::GetMemorySize() const
+{
+	return Asset::GetMemorySize() + Vertices.GetAllocatedSize() + Indices.GetAllocatedSize();
+}
+
+void MeshAsset::ComputeBounds()
+{
+	Bounds = BoxSphereBounds::FromVertices(Vertices);
+}
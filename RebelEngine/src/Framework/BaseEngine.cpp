@@ -4,6 +4,7 @@
 #include "Engine/Assets/AssetManager.h"
 #include "Engine/Gameplay/Framework/GameMode.h"
 #include "Engine/Physics/PhysicsModule.h"
+#include "Engine/Physics/PhysicsSystem.h"
 #include "Engine/Scene/World.h"
 
 // This creates the single definition that the linker needs
@@ -175,6 +176,11 @@ void BaseEngine::OnInit()
         if (AssetManagerModule* assetModule = m_ModuleManager.GetModule<AssetManagerModule>())
             animationModule->SetAssetManagerContext(&assetModule->GetManager());
     }
+
+    PhysicsModule* physicsModule = m_ModuleManager.GetModule<PhysicsModule>();
+    AssetManagerModule* assetModule = m_ModuleManager.GetModule<AssetManagerModule>();
+    if (physicsModule && physicsModule->GetPhysicsSystem() && assetModule)
+        physicsModule->GetPhysicsSystem()->SetAssetManagerContext(&assetModule->GetManager());
 }
 
 void BaseEngine::OnShutdown()
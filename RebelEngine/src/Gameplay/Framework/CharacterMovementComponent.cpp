@@ -4,6 +4,7 @@
 #include "Engine/Components/CapsuleComponent.h"
 #include "Engine/Gameplay/Framework/Controller.h"
 #include "Engine/Gameplay/Framework/Pawn.h"
+#include "Engine/Gameplay/Framework/PlayerController.h"
 #include "Engine/Physics/PhysicsDebugDraw.h"
 #include "Engine/Scene/World.h"
 
@@ -127,15 +128,45 @@ void CharacterMovementComponent::Tick(const float deltaTime)
     if (!HasValidUpdatedComponentOrLog())
         return;
 
+    World* world = ShouldMoveInParallel(*pawn) ? pawn->GetWorld() : nullptr;
+    if (world)
+    {
+        // The world runs the simulation on a job once the tick group is done and
+        // writes the pose back afterwards; until then the pose lives here.
+        m_DeferredPosition = GetUpdatedComponent()->GetWorldPosition();
+        m_DeferredRotationEuler = GetUpdatedComponent()->GetRotationEuler();
+        m_bDeferredRotationChanged = false;
+        m_bDeferredPose = true;
+
+        m_QueuedInput = GatherMovementInput(deltaTime, *pawn);
+        world->QueueCharacterMovement(*this);
+        return;
+    }
+
+    SimulateMovement(GatherMovementInput(deltaTime, *pawn));
+}
+
+CharacterMovementComponent::MovementTickInput CharacterMovementComponent::GatherMovementInput(const float deltaTime, Pawn& pawn)
+{
     m_bHasMovementInputThisFrame = false;
     m_bJumpStartedThisFrame = false;
     m_bLandedThisFrame = false;
     m_LastMoveInput = Vector3(0.0f);
 
-    const Vector3 moveInput = SanitizeMoveInput(pawn->ConsumeMovementInput());
-    const bool bJumpRequested = pawn->ConsumeJumpRequested();
+    MovementTickInput input{};
+    input.DeltaTime = deltaTime;
+    input.MoveInput = SanitizeMoveInput(pawn.ConsumeMovementInput());
+    input.bJumpRequested = pawn.ConsumeJumpRequested();
+    return input;
+}
+
+void CharacterMovementComponent::SimulateMovement(const MovementTickInput& input)
+{
+    const float deltaTime = input.DeltaTime;
+    const Vector3& moveInput = input.MoveInput;
+    const bool bJumpRequested = input.bJumpRequested;
     const MovementState previousState = m_State;
-    const Vector3 startPosition = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 startPosition = GetMovementPosition();
 
     m_LastMoveInput = moveInput;
     m_bHasMovementInputThisFrame = glm::dot(moveInput, moveInput) > 1.0e-4f;
@@ -152,7 +183,7 @@ void CharacterMovementComponent::Tick(const float deltaTime)
     if (m_bLandedThisFrame)
         m_CurrentJumpCount = 0;
 
-    const Vector3 endPosition = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 endPosition = GetMovementPosition();
     const float inputMagnitudeSq = glm::dot(moveInput, moveInput);
     const float displacementSq = glm::dot(endPosition - startPosition, endPosition - startPosition);
     if (inputMagnitudeSq > 0.01f && displacementSq < 1.0e-6f)
@@ -189,6 +220,69 @@ void CharacterMovementComponent::Tick(const float deltaTime)
     SyncBaseState();
 }
 
+void CharacterMovementComponent::SimulateQueuedMovement()
+{
+    SimulateMovement(m_QueuedInput);
+}
+
+void CharacterMovementComponent::ApplyQueuedMovement()
+{
+    if (!m_bDeferredPose)
+        return;
+
+    m_bDeferredPose = false;
+    SceneComponent* updatedComponent = GetUpdatedComponent();
+    if (!updatedComponent)
+        return;
+
+    updatedComponent->SetWorldPosition(m_DeferredPosition);
+    if (m_bDeferredRotationChanged)
+        updatedComponent->SetRotationEuler(m_DeferredRotationEuler);
+}
+
+bool CharacterMovementComponent::ShouldMoveInParallel(const Pawn& pawn) const
+{
+    if (!m_bParallelMovement)
+        return false;
+
+    // Player characters keep moving inside their own tick so input, camera
+    // and movement stay in step within the frame.
+    return dynamic_cast<const PlayerController*>(pawn.GetController()) == nullptr;
+}
+
+Vector3 CharacterMovementComponent::GetMovementPosition() const
+{
+    return m_bDeferredPose ? m_DeferredPosition : GetUpdatedComponent()->GetWorldPosition();
+}
+
+void CharacterMovementComponent::SetMovementPosition(const Vector3& position)
+{
+    if (m_bDeferredPose)
+    {
+        m_DeferredPosition = position;
+        return;
+    }
+
+    GetUpdatedComponent()->SetWorldPosition(position);
+}
+
+Vector3 CharacterMovementComponent::GetMovementRotationEuler() const
+{
+    return m_bDeferredPose ? m_DeferredRotationEuler : GetUpdatedComponent()->GetRotationEuler();
+}
+
+void CharacterMovementComponent::SetMovementRotationEuler(const Vector3& rotationEuler)
+{
+    if (m_bDeferredPose)
+    {
+        m_DeferredRotationEuler = rotationEuler;
+        m_bDeferredRotationChanged = true;
+        return;
+    }
+
+    GetUpdatedComponent()->SetRotationEuler(rotationEuler);
+}
+
 AnimationLocomotionState CharacterMovementComponent::BuildAnimationLocomotionState() const
 {
     AnimationLocomotionState locomotionState{};
@@ -392,7 +486,7 @@ void CharacterMovementComponent::PhysWalking(const float deltaTime, const Vector
     // must come from floor projection/step-up/snap, not from stored velocity.
     m_State.Velocity.z = 0.0f;
 
-    const Vector3 start = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 start = GetMovementPosition();
     const Vector3 horizontalMove(m_State.Velocity.x * deltaTime, m_State.Velocity.y * deltaTime, 0.0f);
 
     Vector3 solvedVelocity = m_State.Velocity;
@@ -404,7 +498,7 @@ void CharacterMovementComponent::PhysWalking(const float deltaTime, const Vector
     m_State.CurrentFloor = FindFloor();
     UpdateMovementModeFromFloor(m_State.CurrentFloor);
 
-    const Vector3 end = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 end = GetMovementPosition();
     const Vector3 actualVelocity = (end - start) / glm::max(deltaTime, kTinyNumber);
 
     // Walking keeps vertical velocity locked; horizontal velocity is driven by solved displacement.
@@ -419,7 +513,7 @@ void CharacterMovementComponent::PhysFalling(const float deltaTime, const Vector
 {
     ApplyFalling(deltaTime, moveInput);
 
-    const Vector3 start = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 start = GetMovementPosition();
 
     // Falling intentionally stays on the generic sweep-and-slide path. Walking gets a separate
     // floor-aware resolver because ground locomotion needs ramp, curb, and stair semantics that
@@ -428,7 +522,7 @@ void CharacterMovementComponent::PhysFalling(const float deltaTime, const Vector
     Vector3 solvedVelocity = m_State.Velocity;
     MoveWithIterativeCollision(desiredMove, solvedVelocity, nullptr);
 
-    const Vector3 end = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 end = GetMovementPosition();
     const Vector3 actualVelocity = (end - start) / glm::max(deltaTime, kTinyNumber);
 
     // Falling uses solved displacement velocity to keep collision response and state coherent.
@@ -444,7 +538,7 @@ FloorResult CharacterMovementComponent::FindFloor() const
     if (!HasValidUpdatedComponent())
         return {};
 
-    return FindFloorFromPosition(GetUpdatedComponent()->GetWorldPosition());
+    return FindFloorFromPosition(GetMovementPosition());
 }
 
 FloorResult CharacterMovementComponent::FindFloorFromPosition(const Vector3& position) const
@@ -680,7 +774,7 @@ bool CharacterMovementComponent::SafeMove(const Vector3& delta, TraceHit& outHit
     if (!capsule)
         return false;
 
-    const Vector3 start = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 start = GetMovementPosition();
     const Vector3 end = start + delta;
 
     TraceQueryParams params{};
@@ -689,7 +783,7 @@ bool CharacterMovementComponent::SafeMove(const Vector3& delta, TraceHit& outHit
     const bool bHit = capsule->SweepCapsule(start, end, outHit, params);
     if (!bHit)
     {
-        GetUpdatedComponent()->SetWorldPosition(end);
+        SetMovementPosition(end);
         outAppliedFraction = 1.0f;
         return true;
     }
@@ -702,7 +796,7 @@ bool CharacterMovementComponent::SafeMove(const Vector3& delta, TraceHit& outHit
     }
 
     const float safeFraction = ComputeSafeMoveFraction(outHit.Distance, moveDistance);
-    GetUpdatedComponent()->SetWorldPosition(start + delta * safeFraction);
+    SetMovementPosition(start + delta * safeFraction);
     outAppliedFraction = safeFraction;
 
     return true;
@@ -796,7 +890,7 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
         return false;
 
     const Vector3 up(0.0f, 0.0f, 1.0f);
-    const Vector3 startLocation = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 startLocation = GetMovementPosition();
 
     Vector3 stepDelta(delta.x, delta.y, 0.0f);
     if (glm::dot(stepDelta, stepDelta) <= kSmallMoveSqr)
@@ -820,7 +914,7 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
     if (appliedFraction < 1.0f)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: up blocked");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
@@ -831,7 +925,7 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
     if (appliedFraction < 1.0f)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: forward blocked");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
@@ -847,7 +941,7 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
     if (appliedFraction >= 1.0f)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: no landing floor");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
@@ -855,30 +949,30 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
     if (!moveHit.bBlockingHit)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: no landing floor");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
-    const Vector3 candidateCenter = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 candidateCenter = GetMovementPosition();
     const FloorResult landingFloor = FindFloorFromPosition(candidateCenter);
     if (!landingFloor.bBlockingHit)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: landing candidate invalid");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
     if (!landingFloor.bWalkableFloor)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: landing floor not walkable");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
     if (landingFloor.FloorDistance > m_MaxStepDownDistance + m_SurfaceContactOffset)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: landing candidate invalid");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
@@ -887,7 +981,7 @@ bool CharacterMovementComponent::StepUp(const Vector3& delta, const TraceHit& bl
     if (rise < -kTinyNumber || rise > maxStepHeight + m_SurfaceContactOffset)
     {
         RB_LOG(characterMovementLog, info, "StepUp failed: landing candidate invalid");
-        GetUpdatedComponent()->SetWorldPosition(startLocation);
+        SetMovementPosition(startLocation);
         return false;
     }
 
@@ -942,7 +1036,7 @@ bool CharacterMovementComponent::ResolvePenetration(const TraceHit& hit, const V
         else
             hitNormal = glm::normalize(hitNormal);
     }
-    const Vector3 start = GetUpdatedComponent()->GetWorldPosition();
+    const Vector3 start = GetMovementPosition();
 
     // Without penetration depth from trace hits, use a bounded single-step push-out.
     // Scale depenetration by attempted move size so tiny overlaps do not get a large fixed pop.
@@ -955,7 +1049,7 @@ bool CharacterMovementComponent::ResolvePenetration(const TraceHit& hit, const V
     const float moveSize = glm::sqrt(glm::max(glm::dot(moveDelta, moveDelta), 0.0f));
     const float heuristicResolveDistance = glm::clamp(moveSize + minResolveDistance, minResolveDistance, preferredResolveDistance);
     const float resolveDistance = glm::clamp(heuristicResolveDistance, minResolveDistance, maxResolveDistance);
-    GetUpdatedComponent()->SetWorldPosition(start + hitNormal * resolveDistance);
+    SetMovementPosition(start + hitNormal * resolveDistance);
 
     return true;
 }
@@ -1045,8 +1139,8 @@ bool CharacterMovementComponent::TryApplyGroundSnap()
     if (snapDistance <= 0.0f)
         return false;
 
-    const Vector3 position = GetUpdatedComponent()->GetWorldPosition();
-    GetUpdatedComponent()->SetWorldPosition(position - Vector3(0.0f, 0.0f, snapDistance));
+    const Vector3 position = GetMovementPosition();
+    SetMovementPosition(position - Vector3(0.0f, 0.0f, snapDistance));
     return true;
 }
 
@@ -1471,11 +1565,10 @@ bool CharacterMovementComponent::ComputeDesiredYaw(const Vector3& moveInput, flo
 
 void CharacterMovementComponent::ApplyCharacterRotation(const float deltaTime, const float desiredYawDegrees)
 {
-    SceneComponent* updatedComponent = GetUpdatedComponent();
-    if (!updatedComponent)
+    if (!GetUpdatedComponent())
         return;
 
-    Vector3 currentRotation = updatedComponent->GetRotationEuler();
+    Vector3 currentRotation = GetMovementRotationEuler();
     const float currentYawDegrees = currentRotation.z;
     const float deltaYawDegrees = NormalizeDegrees(desiredYawDegrees - currentYawDegrees);
     if (glm::abs(deltaYawDegrees) <= kTinyNumber)
@@ -1493,7 +1586,7 @@ void CharacterMovementComponent::ApplyCharacterRotation(const float deltaTime, c
     currentRotation.z = NormalizeDegrees(currentYawDegrees + appliedYawDeltaDegrees);
     currentRotation.x = 0.0f;
     currentRotation.y = 0.0f;
-    updatedComponent->SetRotationEuler(currentRotation);
+    SetMovementRotationEuler(currentRotation);
 }
 
 CapsuleComponent* CharacterMovementComponent::GetUpdatedCapsule() const
@@ -1,24 +1,37 @@
 ﻿#include "Engine/Framework/EnginePch.h"
 #include "Engine/Physics/PhysicsSystem.h"
 
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/MeshAsset.h"
 #include "Engine/Components/Components.h"
 #include "Engine/Physics/PhysicsDebugDraw.h"
 #include "Engine/Scene/Scene.h"
 
+#include "Core/MultiThreading/JobSystem.h"
+
 #include <Jolt/Jolt.h>
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/StreamIn.h>
+#include <Jolt/Core/StreamOut.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
 #include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseQuery.h>
 #include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/ContactListener.h>
 #include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
 #include <Jolt/Physics/Collision/RayCast.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
 #include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
 #include <Jolt/Physics/Collision/Shape/RotatedTranslatedShape.h>
+#include <Jolt/Physics/Collision/Shape/ScaledShape.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
 #include <Jolt/Physics/Collision/ShapeCast.h>
 #include <Jolt/Physics/PhysicsSystem.h>
@@ -26,7 +39,11 @@
 #include <glm/gtc/constants.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
 #include <thread>
 #include <type_traits>
 
@@ -34,47 +51,105 @@ namespace
 {
 	constexpr float kSmallTraceDistance = 1.0e-5f;
 
-	constexpr JPH::ObjectLayer kLayerWorldStatic = 0;
-	constexpr JPH::ObjectLayer kLayerWorldDynamic = 1;
-	constexpr JPH::ObjectLayer kLayerPawn = 2;
-	constexpr JPH::ObjectLayer kLayerVisibility = 3;
-	constexpr JPH::ObjectLayer kLayerCamera = 4;
-	constexpr JPH::ObjectLayer kLayerTrigger = 5;
+	// Sized for levels with thousands of static props.
+	constexpr JPH::uint kMaxBodies = 65536;
+	constexpr JPH::uint kMaxBodyPairs = 65536;
+	constexpr JPH::uint kMaxContactConstraints = 10240;
+	// Per-step scratch for contact constraints and islands. Every active step
+	// reserves kMaxContactConstraints contact constraints (~8.4 MB) plus the
+	// body pair and island buffers regardless of scene size, so the floor
+	// covers those with headroom and the per-body term grows on top of it.
+	constexpr MemSize kMinTempAllocatorSize = 32 * 1024 * 1024;
+	constexpr MemSize kTempAllocatorBytesPerBody = 448;
+	constexpr MemSize kTempAllocatorGranularity = 1024 * 1024;
+
+	// Batches at least this large rebuild the broadphase tree after adding.
+	constexpr uint32 kOptimizeBroadPhaseBatch = 256;
+
+	// Batched scene queries handed to one job at a time.
+	constexpr MemSize kSceneQueryGrain = 32;
+
+	// User data of bodies queued for removal; traces skip them until the
+	// next step removes them for real.
+	constexpr uint64 kRemovedBodyUserData = ~uint64(0);
+
+	// Object layers pack the collision channel with a moving bit so the
+	// broadphase can keep static geometry in its own tree:
+	//   layer = channel * 2 + (moving ? 1 : 0)
+	constexpr JPH::ObjectLayer kNumObjectLayers = CollisionResponseMatrix::ChannelCount * 2;
+
+	namespace BroadPhaseLayers
+	{
+		constexpr JPH::BroadPhaseLayer NonMoving(0);
+		constexpr JPH::BroadPhaseLayer Moving(1);
+		constexpr JPH::uint Count = 2;
+	}
+
+	inline JPH::ObjectLayer MakeObjectLayer(CollisionChannel channel, bool bMoving)
+	{
+		return static_cast<JPH::ObjectLayer>(static_cast<uint32>(channel) * 2 + (bMoving ? 1 : 0));
+	}
+
+	inline CollisionChannel GetLayerChannel(JPH::ObjectLayer layer)
+	{
+		return static_cast<CollisionChannel>(layer / 2);
+	}
+
+	inline bool IsMovingLayer(JPH::ObjectLayer layer)
+	{
+		return (layer & 1) != 0;
+	}
 
-	class SimpleBroadPhaseLayerInterface : public JPH::BroadPhaseLayerInterface
+	class ChannelBroadPhaseLayerInterface : public JPH::BroadPhaseLayerInterface
 	{
 	public:
 		JPH::uint GetNumBroadPhaseLayers() const override
 		{
-			return 1;
+			return BroadPhaseLayers::Count;
 		}
 
-		JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer) const override
+		JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer layer) const override
 		{
-			return JPH::BroadPhaseLayer(0);
+			JPH_ASSERT(layer < kNumObjectLayers);
+			return IsMovingLayer(layer) ? BroadPhaseLayers::Moving : BroadPhaseLayers::NonMoving;
 		}
 
-		const char* GetBroadPhaseLayerName(JPH::BroadPhaseLayer) const override
+#if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
+		const char* GetBroadPhaseLayerName(JPH::BroadPhaseLayer layer) const override
 		{
-			return "DEFAULT";
+			return layer == BroadPhaseLayers::Moving ? "MOVING" : "NON_MOVING";
 		}
+#endif
 	};
 
-	class SimpleObjectLayerPairFilter : public JPH::ObjectLayerPairFilter
+	// Static bodies never need to be tested against each other; everything
+	// else goes through the channel matrix.
+	class ChannelObjectLayerPairFilter : public JPH::ObjectLayerPairFilter
 	{
 	public:
-		bool ShouldCollide(JPH::ObjectLayer, JPH::ObjectLayer) const override
+		explicit ChannelObjectLayerPairFilter(const CollisionResponseMatrix& responses)
+			: m_Responses(responses)
 		{
-			return true;
 		}
+
+		bool ShouldCollide(JPH::ObjectLayer a, JPH::ObjectLayer b) const override
+		{
+			if (!IsMovingLayer(a) && !IsMovingLayer(b))
+				return false;
+
+			return m_Responses.Responds(GetLayerChannel(a), GetLayerChannel(b));
+		}
+
+	private:
+		const CollisionResponseMatrix& m_Responses;
 	};
 
-	class SimpleObjectVsBroadPhaseLayerFilter : public JPH::ObjectVsBroadPhaseLayerFilter
+	class ChannelObjectVsBroadPhaseLayerFilter : public JPH::ObjectVsBroadPhaseLayerFilter
 	{
 	public:
-		bool ShouldCollide(JPH::ObjectLayer, JPH::BroadPhaseLayer) const override
+		bool ShouldCollide(JPH::ObjectLayer layer, JPH::BroadPhaseLayer broadPhaseLayer) const override
 		{
-			return true;
+			return IsMovingLayer(layer) || broadPhaseLayer == BroadPhaseLayers::Moving;
 		}
 	};
 
@@ -108,30 +183,6 @@ namespace
 		return Quaternion((float)v.GetW(), (float)v.GetX(), (float)v.GetY(), (float)v.GetZ());
 	}
 
-	inline JPH::ObjectLayer ToObjectLayer(CollisionChannel channel)
-	{
-		switch (channel)
-		{
-		case CollisionChannel::WorldStatic: return kLayerWorldStatic;
-		case CollisionChannel::WorldDynamic: return kLayerWorldDynamic;
-		case CollisionChannel::Pawn: return kLayerPawn;
-		case CollisionChannel::Visibility: return kLayerVisibility;
-		case CollisionChannel::Camera: return kLayerCamera;
-		case CollisionChannel::Trigger: return kLayerTrigger;
-		case CollisionChannel::Any: break;
-		}
-
-		return kLayerWorldDynamic;
-	}
-
-	inline bool ChannelMatchesLayer(CollisionChannel channel, JPH::ObjectLayer layer)
-	{
-		if (channel == CollisionChannel::Any)
-			return true;
-
-		return layer == ToObjectLayer(channel);
-	}
-
 	inline CollisionChannel ResolveBodyCollisionChannel(const PrimitiveComponent& primitive)
 	{
 		if (primitive.ObjectChannel != CollisionChannel::Any)
@@ -156,18 +207,20 @@ namespace
 	class TraceObjectLayerFilter final : public JPH::ObjectLayerFilter
 	{
 	public:
-		explicit TraceObjectLayerFilter(CollisionChannel channel)
+		TraceObjectLayerFilter(CollisionChannel channel, const CollisionResponseMatrix& responses)
 			: m_Channel(channel)
+			, m_Responses(responses)
 		{
 		}
 
 		bool ShouldCollide(JPH::ObjectLayer layer) const override
 		{
-			return ChannelMatchesLayer(m_Channel, layer);
+			return m_Responses.Responds(m_Channel, GetLayerChannel(layer));
 		}
 
 	private:
 		CollisionChannel m_Channel;
+		const CollisionResponseMatrix& m_Responses;
 	};
 
 	class TraceBodyFilter final : public JPH::BodyFilter
@@ -180,6 +233,9 @@ namespace
 
 		bool ShouldCollideLocked(const JPH::Body& body) const override
 		{
+			if (body.GetUserData() == kRemovedBodyUserData)
+				return false;
+
 			if (!m_Params.bTraceTriggers && body.IsSensor())
 				return false;
 
@@ -200,14 +256,23 @@ namespace
 		const TraceQueryParams& m_Params;
 	};
 
+	// Narrowphase and body access for one query. Game-thread calls lock the
+	// bodies they touch; batches run between steps and read without locks.
+	struct QueryContext
+	{
+		const JPH::BroadPhaseQuery& BroadPhase;
+		const JPH::NarrowPhaseQuery& Query;
+		const JPH::BodyLockInterface& Locks;
+		const CollisionResponseMatrix& Responses;
+	};
+
 	bool FillTraceHitFromRay(
-		const JPH::PhysicsSystem& physicsSystem,
+		const JPH::BodyLockInterface& lockInterface,
 		const JPH::RRayCast& ray,
 		float totalDistance,
 		const JPH::RayCastResult& rayHit,
 		TraceHit& outHit)
 	{
-		const JPH::BodyLockInterface& lockInterface = physicsSystem.GetBodyLockInterface();
 		JPH::BodyLockRead lock(lockInterface, rayHit.mBodyID);
 		if (!lock.Succeeded())
 			return false;
@@ -224,12 +289,11 @@ namespace
 	}
 
 	bool FillTraceHitFromShapeCast(
-		const JPH::PhysicsSystem& physicsSystem,
+		const JPH::BodyLockInterface& lockInterface,
 		float totalDistance,
 		const JPH::ShapeCastResult& shapeHit,
 		TraceHit& outHit)
 	{
-		const JPH::BodyLockInterface& lockInterface = physicsSystem.GetBodyLockInterface();
 		JPH::BodyLockRead lock(lockInterface, shapeHit.mBodyID2);
 		if (!lock.Succeeded())
 			return false;
@@ -250,8 +314,52 @@ namespace
 		return true;
 	}
 
+	bool FillTraceHitFromCollide(
+		const JPH::BodyLockInterface& lockInterface,
+		const JPH::CollideShapeResult& collideHit,
+		TraceHit& outHit)
+	{
+		JPH::BodyLockRead lock(lockInterface, collideHit.mBodyID2);
+		if (!lock.Succeeded())
+			return false;
+
+		const JPH::Body& body = lock.GetBody();
+		const Vector3 penetrationAxis = ToRebel(collideHit.mPenetrationAxis);
+
+		outHit.bBlockingHit = !body.IsSensor();
+		outHit.Position = ToRebel(collideHit.mContactPointOn2);
+		if (glm::dot(penetrationAxis, penetrationAxis) > 0.0f)
+			outHit.Normal = -glm::normalize(penetrationAxis);
+		outHit.Distance = 0.0f;
+		outHit.HitEntity = DecodeEntityID(body.GetUserData());
+		return true;
+	}
+
+	bool RayCastSingleInternal(
+		const QueryContext& context,
+		const Vector3& start,
+		const Vector3& end,
+		const TraceQueryParams& params,
+		TraceHit& outHit)
+	{
+		const Vector3 displacement = end - start;
+		const float distance = glm::length(displacement);
+		if (distance <= kSmallTraceDistance)
+			return false;
+
+		TraceObjectLayerFilter objectFilter(params.Channel, context.Responses);
+		TraceBodyFilter bodyFilter(params);
+
+		const JPH::RRayCast ray(ToJoltR(start), ToJolt(displacement));
+		JPH::RayCastResult rayHit;
+		if (!context.Query.CastRay(ray, rayHit, {}, objectFilter, bodyFilter))
+			return false;
+
+		return FillTraceHitFromRay(context.Locks, ray, distance, rayHit, outHit);
+	}
+
 	bool CastShapeSingleInternal(
-		const JPH::PhysicsSystem& physicsSystem,
+		const QueryContext& context,
 		const JPH::Shape& shape,
 		const Vector3& start,
 		const Quaternion& startRotation,
@@ -259,13 +367,11 @@ namespace
 		const TraceQueryParams& params,
 		TraceHit& outHit)
 	{
-		outHit = {};
-
 		const float distance = glm::length(displacement);
 		if (distance <= kSmallTraceDistance)
 			return false;
 
-		TraceObjectLayerFilter objectFilter(params.Channel);
+		TraceObjectLayerFilter objectFilter(params.Channel, context.Responses);
 		TraceBodyFilter bodyFilter(params);
 
 		const JPH::RMat44 castStart = JPH::RMat44::sRotationTranslation(ToJoltQ(startRotation), ToJoltR(start));
@@ -274,7 +380,7 @@ namespace
 		JPH::ShapeCastSettings settings;
 		JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
 
-		physicsSystem.GetNarrowPhaseQuery().CastShape(
+		context.Query.CastShape(
 			shapeCast,
 			settings,
 			JPH::RVec3::sZero(),
@@ -286,7 +392,223 @@ namespace
 		if (!collector.HadHit())
 			return false;
 
-		return FillTraceHitFromShapeCast(physicsSystem, distance, collector.mHit, outHit);
+		return FillTraceHitFromShapeCast(context.Locks, distance, collector.mHit, outHit);
+	}
+
+	// Deepest penetrating body for a shape placed at position.
+	bool CollideShapeSingleInternal(
+		const QueryContext& context,
+		const JPH::Shape& shape,
+		const Vector3& position,
+		const Quaternion& rotation,
+		const TraceQueryParams& params,
+		TraceHit& outHit)
+	{
+		TraceObjectLayerFilter objectFilter(params.Channel, context.Responses);
+		TraceBodyFilter bodyFilter(params);
+
+		const JPH::RMat44 transform = JPH::RMat44::sRotationTranslation(ToJoltQ(rotation), ToJoltR(position));
+		JPH::CollideShapeSettings settings;
+		JPH::ClosestHitCollisionCollector<JPH::CollideShapeCollector> collector;
+
+		context.Query.CollideShape(
+			&shape,
+			JPH::Vec3::sReplicate(1.0f),
+			transform,
+			settings,
+			JPH::RVec3::sZero(),
+			collector,
+			{},
+			objectFilter,
+			bodyFilter);
+
+		if (!collector.HadHit())
+			return false;
+
+		return FillTraceHitFromCollide(context.Locks, collector.mHit, outHit);
+	}
+
+	// Gathers the owner of every body the query shape touches, once per body.
+	class OverlapEntityCollector final : public JPH::CollideShapeCollector
+	{
+	public:
+		explicit OverlapEntityCollector(std::vector<EntityID>& entities)
+			: m_Entities(entities)
+		{
+		}
+
+		void OnBody(const JPH::Body& body) override
+		{
+			m_BodyEntity = DecodeEntityID(body.GetUserData());
+			m_bBodyAdded = false;
+		}
+
+		void AddHit(const JPH::CollideShapeResult&) override
+		{
+			if (m_bBodyAdded)
+				return;
+
+			m_Entities.push_back(m_BodyEntity);
+			m_bBodyAdded = true;
+		}
+
+	private:
+		std::vector<EntityID>& m_Entities;
+		EntityID m_BodyEntity = entt::null;
+		bool m_bBodyAdded = false;
+	};
+
+	// Broadphase hits, passed through the same body filter as narrowphase queries.
+	class BoundsEntityCollector final : public JPH::CollideShapeBodyCollector
+	{
+	public:
+		BoundsEntityCollector(const JPH::BodyLockInterface& locks, const JPH::BodyFilter& filter, std::vector<EntityID>& entities)
+			: m_Locks(locks)
+			, m_Filter(filter)
+			, m_Entities(entities)
+		{
+		}
+
+		void AddHit(const JPH::BodyID& bodyID) override
+		{
+			if (!m_Filter.ShouldCollide(bodyID))
+				return;
+
+			JPH::BodyLockRead lock(m_Locks, bodyID);
+			if (!lock.Succeeded() || !m_Filter.ShouldCollideLocked(lock.GetBody()))
+				return;
+
+			m_Entities.push_back(DecodeEntityID(lock.GetBody().GetUserData()));
+		}
+
+	private:
+		const JPH::BodyLockInterface& m_Locks;
+		const JPH::BodyFilter& m_Filter;
+		std::vector<EntityID>& m_Entities;
+	};
+
+	// Actors with several primitives show up once, in entity order.
+	bool FinishEntityList(std::vector<EntityID>& entities)
+	{
+		std::sort(entities.begin(), entities.end());
+		entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+		return !entities.empty();
+	}
+
+	bool CollideShapeMultiInternal(
+		const QueryContext& context,
+		const JPH::Shape& shape,
+		const Vector3& position,
+		const Quaternion& rotation,
+		const TraceQueryParams& params,
+		std::vector<EntityID>& outEntities)
+	{
+		TraceObjectLayerFilter objectFilter(params.Channel, context.Responses);
+		TraceBodyFilter bodyFilter(params);
+
+		const JPH::RMat44 transform = JPH::RMat44::sRotationTranslation(ToJoltQ(rotation), ToJoltR(position));
+		JPH::CollideShapeSettings settings;
+		OverlapEntityCollector collector(outEntities);
+
+		context.Query.CollideShape(
+			&shape,
+			JPH::Vec3::sReplicate(1.0f),
+			transform,
+			settings,
+			JPH::RVec3::sZero(),
+			collector,
+			{},
+			objectFilter,
+			bodyFilter);
+
+		return FinishEntityList(outEntities);
+	}
+
+	// Engine capsules stand along Z, Jolt's along Y.
+	Quaternion CapsuleQueryRotation(const Quaternion& rotation)
+	{
+		return rotation * glm::angleAxis(glm::half_pi<float>(), Vector3(1.0f, 0.0f, 0.0f));
+	}
+
+	// Builds the query's volume on the stack and hands it to visit(shape,
+	// rotation); nothing here touches the heap. Lines and degenerate sizes
+	// have no volume.
+	template<typename Visitor>
+	bool VisitQueryShape(const SceneQuery& query, const Visitor& visit)
+	{
+		const Quaternion identity(1.0f, 0.0f, 0.0f, 0.0f);
+
+		switch (query.Shape)
+		{
+		case ESceneQueryShape::Line:
+			return false;
+		case ESceneQueryShape::Sphere:
+		{
+			if (query.Radius <= 0.0f)
+				return false;
+
+			JPH::SphereShape sphere(query.Radius);
+			sphere.SetEmbedded();
+			return visit(sphere, identity);
+		}
+		case ESceneQueryShape::Capsule:
+		{
+			if (query.Radius <= 0.0f || query.HalfHeight <= 0.0f)
+				return false;
+
+			if (query.HalfHeight <= query.Radius + kSmallTraceDistance)
+			{
+				JPH::SphereShape sphere(query.Radius);
+				sphere.SetEmbedded();
+				return visit(sphere, identity);
+			}
+
+			JPH::CapsuleShape capsule(std::max(query.HalfHeight - query.Radius, 0.001f), query.Radius);
+			capsule.SetEmbedded();
+			return visit(capsule, CapsuleQueryRotation(query.Rotation));
+		}
+		case ESceneQueryShape::Box:
+		{
+			const Vector3& halfExtent = query.HalfExtent;
+			if (halfExtent.x <= 0.0f || halfExtent.y <= 0.0f || halfExtent.z <= 0.0f)
+				return false;
+
+			JPH::BoxShape box(ToJolt(halfExtent));
+			box.SetEmbedded();
+			return visit(box, query.Rotation);
+		}
+		}
+
+		return false;
+	}
+
+	bool RunSceneQuery(const QueryContext& context, const SceneQuery& query, TraceHit& outHit)
+	{
+		outHit = {};
+
+		if (query.Shape == ESceneQueryShape::Line)
+		{
+			return query.Kind == ESceneQueryKind::Trace
+				&& RayCastSingleInternal(context, query.Start, query.End, query.Params, outHit);
+		}
+
+		return VisitQueryShape(query, [&](const JPH::Shape& shape, const Quaternion& rotation)
+		{
+			if (query.Kind == ESceneQueryKind::Overlap)
+				return CollideShapeSingleInternal(context, shape, query.Start, rotation, query.Params, outHit);
+
+			return CastShapeSingleInternal(context, shape, query.Start, rotation, query.End - query.Start, query.Params, outHit);
+		});
+	}
+
+	// Every owner whose body overlaps the query volume placed at query.Start.
+	bool OverlapMultiInternal(const QueryContext& context, const SceneQuery& query, std::vector<EntityID>& outEntities)
+	{
+		outEntities.clear();
+		return VisitQueryShape(query, [&](const JPH::Shape& shape, const Quaternion& rotation)
+		{
+			return CollideShapeMultiInternal(context, shape, query.Start, rotation, query.Params, outEntities);
+		});
 	}
 
 	static JPH::Ref<JPH::Shape> BuildJoltShape(
@@ -338,119 +660,920 @@ namespace
 
 			return transformedResult.Get();
 		}
+		default:
+			break;
 		}
 
 		return nullptr;
 	}
-}
 
-struct PhysicsSystem::Impl
-{
-	SimpleBroadPhaseLayerInterface BroadPhase;
-	SimpleObjectLayerPairFilter LayerPairFilter;
-	SimpleObjectVsBroadPhaseLayerFilter ObjectVsBPFilter;
+	// Bump when the cooking settings change so stale shape caches get rebuilt.
+	constexpr uint32 kMeshShapeCookVersion = 1;
+	constexpr uint32 kShapeCacheMagic = 0x50485352; // 'RSHP'
 
-	JPH::PhysicsSystem System;
-	JPH::TempAllocatorImpl* TempAllocator = nullptr;
-	JPH::JobSystemThreadPool* JobSystem = nullptr;
-};
+	// Shape caches are this header followed by the shape's SaveWithChildren
+	// stream.
+	struct ShapeCacheHeader
+	{
+		uint32 Magic = kShapeCacheMagic;
+		uint32 Version = kMeshShapeCookVersion;
+		uint64 ContentHash = 0;
+		uint64 PayloadSize = 0;
+	};
 
-DEFINE_LOG_CATEGORY(PhysicsSystemLog)
+	class ByteStreamOut final : public JPH::StreamOut
+	{
+	public:
+		explicit ByteStreamOut(TArray<uint8>& bytes) : m_Bytes(bytes) {}
 
-void PhysicsSystem::Init()
-{
-	JPH::RegisterDefaultAllocator();
-	JPH::Factory::sInstance = new JPH::Factory();
-	JPH::RegisterTypes();
+		void WriteBytes(const void* data, size_t numBytes) override
+		{
+			const MemSize offset = m_Bytes.Num();
+			m_Bytes.Resize(offset + numBytes);
+			std::memcpy(m_Bytes.Data() + offset, data, numBytes);
+		}
 
-	m_Impl = new Impl();
-	m_Impl->TempAllocator = new JPH::TempAllocatorImpl(5 * 1024 * 1024);
-	m_Impl->JobSystem = new JPH::JobSystemThreadPool(
-		JPH::cMaxPhysicsJobs,
-		JPH::cMaxPhysicsBarriers,
-		std::thread::hardware_concurrency());
+		bool IsFailed() const override { return false; }
 
-	m_Impl->System.Init(
-		1024,
-		0,
-		1024,
-		1024,
-		m_Impl->BroadPhase,
-		m_Impl->ObjectVsBPFilter,
-		m_Impl->LayerPairFilter);
-	m_Impl->System.SetGravity({0.0f, 0.0f, -9.81f});
-}
+	private:
+		TArray<uint8>& m_Bytes;
+	};
 
-void PhysicsSystem::Shutdown()
-{
-	if (m_Impl != nullptr)
+	class ByteStreamIn final : public JPH::StreamIn
 	{
-		delete m_Impl->JobSystem;
-		delete m_Impl->TempAllocator;
-		delete m_Impl;
-		m_Impl = nullptr;
+	public:
+		explicit ByteStreamIn(const TArray<uint8>& bytes) : m_Bytes(bytes) {}
+
+		void ReadBytes(void* outData, size_t numBytes) override
+		{
+			if (m_bFailed || numBytes > m_Bytes.Num() - m_Offset)
+			{
+				m_bFailed = true;
+				std::memset(outData, 0, numBytes);
+				return;
+			}
+
+			std::memcpy(outData, m_Bytes.Data() + m_Offset, numBytes);
+			m_Offset += numBytes;
+		}
+
+		// Like std::istream, only set once a read ran past the end.
+		bool IsEOF() const override { return m_bFailed; }
+		bool IsFailed() const override { return m_bFailed; }
+
+	private:
+		const TArray<uint8>& m_Bytes;
+		MemSize m_Offset = 0;
+		bool m_bFailed = false;
+	};
+
+	// FNV-1a over what the cooked shape depends on.
+	uint64 HashMeshContent(const MeshAsset& mesh, EPhysicsShapeType type)
+	{
+		uint64 hash = 14695981039346656037ull;
+		auto mix = [&hash](const void* data, size_t size)
+		{
+			const uint8* bytes = static_cast<const uint8*>(data);
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+		};
+
+		const uint32 key[2] = {static_cast<uint32>(type), kMeshShapeCookVersion};
+		mix(key, sizeof(key));
+		for (const Vertex& vertex : mesh.Vertices)
+			mix(&vertex.Position, sizeof(Vector3));
+		mix(mesh.Indices.Data(), mesh.Indices.Num() * sizeof(uint32));
+		return hash;
 	}
 
-	JPH::UnregisterTypes();
-	delete JPH::Factory::sInstance;
-	JPH::Factory::sInstance = nullptr;
-}
+	// Sits next to the mesh's .rasset; meshes without a file get no cache.
+	bool GetShapeCachePath(const MeshAsset& mesh, EPhysicsShapeType type, String& outPath)
+	{
+		const MemSize length = mesh.Path.length();
+		if (length == 0 || mesh.Path[length - 1] == '/')
+			return false;
 
-void PhysicsSystem::SetFixedDeltaTime(Float fixedDeltaTime)
-{
-	if (fixedDeltaTime <= 0.0f)
-		return;
+		outPath = mesh.Path + (type == EPhysicsShapeType::TriangleMesh ? ".mesh.rshape" : ".hull.rshape");
+		return true;
+	}
+
+	JPH::Ref<JPH::Shape> CookMeshShape(const MeshAsset& mesh, EPhysicsShapeType type)
+	{
+		const MemSize vertexCount = mesh.Vertices.Num();
+		if (vertexCount == 0)
+			return nullptr;
+
+		if (type == EPhysicsShapeType::ConvexHull)
+		{
+			JPH::Array<JPH::Vec3> points;
+			points.reserve(vertexCount);
+			for (const Vertex& vertex : mesh.Vertices)
+				points.push_back(ToJolt(vertex.Position));
+
+			JPH::ConvexHullShapeSettings settings(points);
+			auto result = settings.Create();
+			if (result.HasError())
+				return nullptr;
+
+			return result.Get();
+		}
+
+		JPH::VertexList vertices;
+		vertices.reserve(vertexCount);
+		for (const Vertex& vertex : mesh.Vertices)
+			vertices.push_back(JPH::Float3(vertex.Position.x, vertex.Position.y, vertex.Position.z));
+
+		JPH::IndexedTriangleList triangles;
+		triangles.reserve(mesh.Indices.Num() / 3);
+		for (MemSize i = 0; i + 2 < mesh.Indices.Num(); i += 3)
+		{
+			const uint32 a = mesh.Indices[i];
+			const uint32 b = mesh.Indices[i + 1];
+			const uint32 c = mesh.Indices[i + 2];
+			if (a < vertexCount && b < vertexCount && c < vertexCount)
+				triangles.push_back(JPH::IndexedTriangle(a, b, c));
+		}
+
+		if (triangles.empty())
+			return nullptr;
+
+		JPH::MeshShapeSettings settings(std::move(vertices), std::move(triangles));
+		auto result = settings.Create();
+		if (result.HasError())
+			return nullptr;
+
+		return result.Get();
+	}
+
+	JPH::Ref<JPH::Shape> RestoreCachedMeshShape(const String& path, uint64 contentHash)
+	{
+		std::error_code error;
+		const uint64 fileSize = std::filesystem::file_size(path.c_str(), error);
+		if (error || fileSize < sizeof(ShapeCacheHeader))
+			return nullptr;
+
+		FileStream file(path.c_str(), "rb");
+		if (!file.IsOpen())
+			return nullptr;
+
+		ShapeCacheHeader header;
+		file.Read(&header, sizeof(header));
+		if (header.Magic != kShapeCacheMagic ||
+			header.Version != kMeshShapeCookVersion ||
+			header.ContentHash != contentHash ||
+			header.PayloadSize != fileSize - sizeof(ShapeCacheHeader))
+		{
+			return nullptr;
+		}
+
+		TArray<uint8> payload;
+		payload.Resize(header.PayloadSize);
+		file.Read(payload.Data(), payload.Num());
+
+		ByteStreamIn stream(payload);
+		JPH::Shape::IDToShapeMap shapeMap;
+		JPH::Shape::IDToMaterialMap materialMap;
+		JPH::Shape::ShapeResult result = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+		if (stream.IsFailed() || result.HasError())
+			return nullptr;
+
+		return result.Get();
+	}
+
+	void WriteCachedMeshShape(const String& path, uint64 contentHash, const JPH::Shape& shape)
+	{
+		TArray<uint8> payload;
+		ByteStreamOut stream(payload);
+		JPH::Shape::ShapeToIDMap shapeMap;
+		JPH::Shape::MaterialToIDMap materialMap;
+		shape.SaveWithChildren(stream, shapeMap, materialMap);
+
+		FileStream file(path.c_str(), "wb");
+		if (!file.IsOpen())
+			return;
+
+		ShapeCacheHeader header;
+		header.ContentHash = contentHash;
+		header.PayloadSize = payload.Num();
+		file.Write(&header, sizeof(header));
+		file.Write(payload.Data(), payload.Num());
+	}
+}
+
+namespace
+{
+	constexpr uint8 kBodyEventOverlap = 1 << 0; // sensor: begin/end overlap
+	constexpr uint8 kBodyEventHit = 1 << 1;     // solid, opted in: begin/persist/end hit
+
+	struct BodyRecord
+	{
+		entt::entity Entity = entt::null; // owning primitive's ECS entity
+		JPH::BodyID BodyID;
+		uint8 EventFlags = 0;
+	};
+
+	// Body pairs are keyed by raw ID, lower ID in the high half.
+	uint64 MakeContactPairKey(const JPH::BodyID& a, const JPH::BodyID& b)
+	{
+		const uint64 idA = a.GetIndexAndSequenceNumber();
+		const uint64 idB = b.GetIndexAndSequenceNumber();
+		return idA < idB ? (idA << 32) | idB : (idB << 32) | idA;
+	}
+
+	JPH::BodyID GetContactPairLow(uint64 key) { return JPH::BodyID(static_cast<uint32>(key >> 32)); }
+	JPH::BodyID GetContactPairHigh(uint64 key) { return JPH::BodyID(static_cast<uint32>(key)); }
+
+	// One sub-shape contact change as reported by Jolt, from any thread.
+	struct RawContactEvent
+	{
+		uint64 PairKey = 0;
+		int8 Delta = 0; // +1 added, -1 removed, 0 persisted
+		uint8 EventFlags = 0;
+		EntityID OwnerLow = entt::null;
+		EntityID OwnerHigh = entt::null;
+		Vector3 Position{0.0f};
+		Vector3 Normal{0.0f}; // from the low body toward the high one
+	};
+
+	// Body pair in contact at the end of the last step.
+	struct ContactPair
+	{
+		uint64 PairKey = 0;
+		uint32 Count = 0; // touching sub-shape pairs
+		uint8 EventFlags = 0;
+		EntityID OwnerLow = entt::null;
+		EntityID OwnerHigh = entt::null;
+		Vector3 Position{0.0f};
+		Vector3 Normal{0.0f};
+	};
+
+	struct ContactDispatch
+	{
+		ContactPair Pair;
+		EContactPhase Phase = EContactPhase::Begin;
+	};
+
+	std::atomic<uint64> GNextContactEpoch{1};
+
+	// Jolt calls this from its worker threads during System.Update. Each
+	// thread claims its own buffer once per step, so recording never locks;
+	// the game thread collects all buffers after the update.
+	class ContactEventListener final : public JPH::ContactListener
+	{
+	public:
+		explicit ContactEventListener(const TArray<BodyRecord>& bodies)
+			: m_Bodies(bodies)
+		{
+		}
+
+		void BeginStep()
+		{
+			m_Epoch = GNextContactEpoch.fetch_add(1, std::memory_order_relaxed);
+			m_NextBuffer.store(0, std::memory_order_relaxed);
+		}
+
+		void Collect(TArray<RawContactEvent>& outEvents)
+		{
+			const uint32 usedBuffers = std::min(m_NextBuffer.load(std::memory_order_acquire), kMaxThreadBuffers);
+			for (uint32 i = 0; i < usedBuffers; ++i)
+			{
+				for (const RawContactEvent& event : m_Buffers[i].Events)
+					outEvents.Add(event);
+				m_Buffers[i].Events.Clear();
+			}
+
+			for (const RawContactEvent& event : m_Overflow)
+				outEvents.Add(event);
+			m_Overflow.Clear();
+		}
+
+		void OnContactAdded(const JPH::Body& body1, const JPH::Body& body2, const JPH::ContactManifold& manifold, JPH::ContactSettings&) override
+		{
+			Record(body1, body2, 1, manifold);
+		}
+
+		void OnContactPersisted(const JPH::Body& body1, const JPH::Body& body2, const JPH::ContactManifold& manifold, JPH::ContactSettings&) override
+		{
+			Record(body1, body2, 0, manifold);
+		}
+
+		void OnContactRemoved(const JPH::SubShapeIDPair& pair) override
+		{
+			const uint8 flags = GetEventFlags(pair.GetBody1ID()) | GetEventFlags(pair.GetBody2ID());
+			if (flags == 0)
+				return;
+
+			RawContactEvent event;
+			event.PairKey = MakeContactPairKey(pair.GetBody1ID(), pair.GetBody2ID());
+			event.Delta = -1;
+			event.EventFlags = flags;
+			Push(event);
+		}
+
+	private:
+		static constexpr uint32 kMaxThreadBuffers = 64;
+
+		struct alignas(64) ThreadBuffer
+		{
+			TArray<RawContactEvent> Events;
+		};
+
+		uint8 GetEventFlags(const JPH::BodyID& bodyID) const
+		{
+			const uint32 index = bodyID.GetIndex();
+			if (index >= m_Bodies.Num() || m_Bodies[index].BodyID != bodyID)
+				return 0;
+
+			return m_Bodies[index].EventFlags;
+		}
+
+		void Record(const JPH::Body& body1, const JPH::Body& body2, int8 delta, const JPH::ContactManifold& manifold)
+		{
+			const uint8 flags = GetEventFlags(body1.GetID()) | GetEventFlags(body2.GetID());
+			if (flags == 0)
+				return;
+
+			// Overlaps only report begin and end.
+			if (delta == 0 && (flags & kBodyEventOverlap) != 0)
+				return;
+
+			const bool bSwapped = body2.GetID() < body1.GetID();
+
+			RawContactEvent event;
+			event.PairKey = MakeContactPairKey(body1.GetID(), body2.GetID());
+			event.Delta = delta;
+			event.EventFlags = flags;
+			event.OwnerLow = DecodeEntityID((bSwapped ? body2 : body1).GetUserData());
+			event.OwnerHigh = DecodeEntityID((bSwapped ? body1 : body2).GetUserData());
+			if (!manifold.mRelativeContactPointsOn1.empty())
+				event.Position = ToRebel(manifold.GetWorldSpaceContactPointOn1(0));
+			event.Normal = ToRebel(bSwapped ? -manifold.mWorldSpaceNormal : manifold.mWorldSpaceNormal);
+			Push(event);
+		}
+
+		void Push(const RawContactEvent& event)
+		{
+			thread_local uint64 tlsEpoch = 0;
+			thread_local uint32 tlsBuffer = 0;
+			if (tlsEpoch != m_Epoch)
+			{
+				tlsEpoch = m_Epoch;
+				tlsBuffer = m_NextBuffer.fetch_add(1, std::memory_order_acq_rel);
+			}
+
+			if (tlsBuffer < kMaxThreadBuffers)
+			{
+				m_Buffers[tlsBuffer].Events.Add(event);
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(m_OverflowMutex);
+			m_Overflow.Add(event);
+		}
+
+		const TArray<BodyRecord>& m_Bodies;
+		uint64 m_Epoch = 0;
+		std::atomic<uint32> m_NextBuffer{0};
+		ThreadBuffer m_Buffers[kMaxThreadBuffers];
+
+		std::mutex m_OverflowMutex;
+		TArray<RawContactEvent> m_Overflow;
+	};
+
+	// Runs Jolt's jobs on the engine-wide worker pool instead of a thread pool
+	// of its own. Barriers come from JobSystemWithBarrier, so the thread inside
+	// PhysicsSystem::Update helps with its own jobs while it waits.
+	class EngineJoltJobSystem final : public JPH::JobSystemWithBarrier
+	{
+	public:
+		EngineJoltJobSystem(JPH::uint maxJobs, JPH::uint maxBarriers)
+			: JobSystemWithBarrier(maxBarriers)
+		{
+			m_Jobs.Init(maxJobs, maxJobs);
+		}
+
+		~EngineJoltJobSystem() override
+		{
+			// A queued copy may drop the last reference after the barrier has
+			// already let Update return, freeing its job back into m_Jobs.
+			if (!m_QueuedJobs.IsDone())
+				Rebel::Core::Threading::JobSystem::Get().Wait(m_QueuedJobs);
+		}
+
+		int GetMaxConcurrency() const override
+		{
+			return static_cast<int>(Rebel::Core::Threading::JobSystem::Get().GetThreadCount());
+		}
+
+		JPH::JobHandle CreateJob(const char* name, JPH::ColorArg color, const JobFunction& function, JPH::uint32 numDependencies = 0) override
+		{
+			uint32 index;
+			for (;;)
+			{
+				index = m_Jobs.ConstructObject(name, color, this, function, numDependencies);
+				if (index != JobList::cInvalidObjectIndex)
+					break;
+				JPH_ASSERT(false, "No physics jobs available!");
+				std::this_thread::yield();
+			}
+
+			// The handle keeps the job alive; it may finish as soon as it is queued.
+			Job* job = &m_Jobs.Get(index);
+			JPH::JobHandle handle(job);
+			if (numDependencies == 0)
+				QueueJob(job);
+			return handle;
+		}
+
+		void QueueJob(Job* job) override
+		{
+			Rebel::Core::Threading::JobSystem& pool = Rebel::Core::Threading::JobSystem::Get();
+
+			// Without workers nobody would pick it up before the barrier runs it.
+			if (pool.GetWorkerCount() == 0)
+				return;
+
+			// The queued copy holds its own reference, dropped once it has run.
+			job->AddRef();
+			pool.Schedule([job]()
+			{
+				job->Execute();
+				job->Release();
+			}, &m_QueuedJobs);
+		}
+
+		void QueueJobs(Job** jobs, JPH::uint numJobs) override
+		{
+			for (JPH::uint i = 0; i < numJobs; ++i)
+				QueueJob(jobs[i]);
+		}
+
+		void FreeJob(Job* job) override
+		{
+			m_Jobs.DestructObject(job);
+		}
+
+	private:
+		using JobList = JPH::FixedSizeFreeList<Job>;
+		JobList m_Jobs;
+		Rebel::Core::Threading::JobCounter m_QueuedJobs;
+	};
+}
+
+struct PhysicsSystem::Impl
+{
+	explicit Impl(const CollisionResponseMatrix& responses)
+		: LayerPairFilter(responses)
+		, Contacts(BodyRecords)
+	{
+	}
+
+	ChannelBroadPhaseLayerInterface BroadPhase;
+	ChannelObjectLayerPairFilter LayerPairFilter;
+	ChannelObjectVsBroadPhaseLayerFilter ObjectVsBPFilter;
+
+	JPH::PhysicsSystem System;
+	JPH::TempAllocatorImpl* TempAllocator = nullptr;
+	MemSize TempAllocatorSize = 0;
+	EngineJoltJobSystem* JobSystem = nullptr;
+
+	// Bodies released by DestroyBodyForComponent, removed together next step.
+	TArray<JPH::BodyID> PendingRemovals;
+
+	// Per body, indexed by BodyID::GetIndex().
+	TArray<BodyRecord> BodyRecords;
+
+	ContactEventListener Contacts;
+	TArray<RawContactEvent> ContactEvents;
+	TArray<ContactPair> TouchingPairs; // sorted by key
+	TArray<ContactPair> TouchingScratch;
+	TArray<ContactDispatch> ContactDispatches;
+
+	struct KinematicBody
+	{
+		entt::entity Entity = entt::null;
+		JPH::BodyID BodyID;
+		Vector3 TargetPosition{0.0f};
+		Quaternion TargetRotation{1.0f, 0.0f, 0.0f, 0.0f};
+		bool bNeedsMove = false; // target changed, not driven yet
+		bool bSettling = false;  // reached the target last substep, velocity still set
+	};
+	TArray<KinematicBody> Kinematics;
+
+	// Dynamic bodies that were awake going into the last substep, with the
+	// poses rendering blends between until the next substep.
+	struct InterpolatedBody
+	{
+		entt::entity Entity = entt::null;
+		JPH::BodyID BodyID;
+		Vector3 PrevPosition{0.0f};
+		Quaternion PrevRotation{1.0f, 0.0f, 0.0f, 0.0f};
+		Vector3 Position{0.0f};
+		Quaternion Rotation{1.0f, 0.0f, 0.0f, 0.0f};
+	};
+	TArray<InterpolatedBody> Interpolated;
+
+	// Scratch for the per-step add batches, kept across steps.
+	TArray<JPH::BodyID> AddActive;
+	TArray<JPH::BodyID> AddInactive;
+	TArray<JPH::BodyID> RemoveScratch;
+
+	// Unscaled mesh shapes per MeshAsset, shared by every body using them.
+	// Edits to an already cooked mesh are picked up after the next Init.
+	struct CookedMeshShapes
+	{
+		JPH::Ref<JPH::Shape> ConvexHull;
+		JPH::Ref<JPH::Shape> TriangleMesh;
+	};
+	AssetManager* Assets = nullptr;
+	TMap<uint64, CookedMeshShapes> MeshShapes;
+	MeshShapeStats MeshStats;
+
+	QueryContext MakeQueryContext(const CollisionResponseMatrix& responses, bool bLockBodies) const
+	{
+		if (bLockBodies)
+			return {System.GetBroadPhaseQuery(), System.GetNarrowPhaseQuery(), System.GetBodyLockInterface(), responses};
+
+		return {System.GetBroadPhaseQuery(), System.GetNarrowPhaseQueryNoLock(), System.GetBodyLockInterfaceNoLock(), responses};
+	}
+
+	void MapBody(const JPH::BodyID& bodyID, entt::entity entity, uint8 eventFlags)
+	{
+		const uint32 index = bodyID.GetIndex();
+		if (index >= BodyRecords.Num())
+			BodyRecords.Resize(index + 1);
+
+		BodyRecord& record = BodyRecords[index];
+		record.Entity = entity;
+		record.BodyID = bodyID;
+		record.EventFlags = eventFlags;
+	}
+
+	// Restores the cooked shape from the mesh's shape cache, or cooks it
+	// and writes the cache when it is missing or out of date.
+	JPH::Ref<JPH::Shape> GetMeshShape(const PhysicsShape& shape)
+	{
+		if (!Assets)
+			return nullptr;
+
+		CookedMeshShapes& cooked = MeshShapes[static_cast<uint64>(shape.Mesh)];
+		JPH::Ref<JPH::Shape>& slot = shape.Type == EPhysicsShapeType::TriangleMesh ? cooked.TriangleMesh : cooked.ConvexHull;
+		if (slot != nullptr)
+		{
+			++MeshStats.Shared;
+			return slot;
+		}
+
+		const MeshAsset* mesh = dynamic_cast<MeshAsset*>(Assets->Load(shape.Mesh));
+		if (!mesh)
+			return nullptr;
+
+		const uint64 contentHash = HashMeshContent(*mesh, shape.Type);
+		String cachePath;
+		const bool bCacheable = GetShapeCachePath(*mesh, shape.Type, cachePath);
+		if (bCacheable)
+		{
+			slot = RestoreCachedMeshShape(cachePath, contentHash);
+			if (slot != nullptr)
+			{
+				++MeshStats.Restored;
+				return slot;
+			}
+		}
+
+		slot = CookMeshShape(*mesh, shape.Type);
+		if (slot == nullptr)
+			return nullptr;
+
+		++MeshStats.Cooked;
+		if (bCacheable)
+			WriteCachedMeshShape(cachePath, contentHash, *slot);
+		return slot;
+	}
+
+	JPH::Ref<JPH::Shape> BuildMeshShape(const PhysicsShape& shape, const Vector3& worldScale)
+	{
+		JPH::Ref<JPH::Shape> meshShape = GetMeshShape(shape);
+		if (meshShape == nullptr)
+			return nullptr;
+
+		if (glm::all(glm::lessThan(glm::abs(worldScale - Vector3(1.0f)), Vector3(1.0e-4f))))
+			return meshShape;
+
+		JPH::ScaledShapeSettings settings(meshShape, ToJolt(worldScale));
+		auto result = settings.Create();
+		if (result.HasError())
+			return nullptr;
+
+		return result.Get();
+	}
+
+	entt::entity GetBodyEntity(const JPH::BodyID& bodyID) const
+	{
+		const uint32 index = bodyID.GetIndex();
+		if (index >= BodyRecords.Num() || BodyRecords[index].BodyID != bodyID)
+			return entt::null;
+
+		return BodyRecords[index].Entity;
+	}
+
+	// Queues a body for removal at the start of the next step.
+	void ReleaseBody(const JPH::BodyID& bodyID)
+	{
+		System.GetBodyInterfaceNoLock().SetUserData(bodyID, kRemovedBodyUserData);
+		PendingRemovals.Add(bodyID);
+		if (bodyID.GetIndex() < BodyRecords.Num())
+			BodyRecords[bodyID.GetIndex()] = BodyRecord{};
+	}
+};
+
+namespace
+{
+	// The primitive a body was created for, if it is still registered with
+	// a body; null when the component went away without releasing it.
+	PrimitiveComponent* ResolveBodyPrimitive(entt::registry& registry, entt::entity entity, const JPH::BodyID& bodyID)
+	{
+		if (entity == entt::null || !registry.valid(entity))
+			return nullptr;
+
+		PrimitiveComponent* const* primitivePtr = registry.try_get<PrimitiveComponent*>(entity);
+		PrimitiveComponent* primitive = primitivePtr ? *primitivePtr : nullptr;
+		if (!primitive || !primitive->IsBodyCreated() || primitive->GetBodyHandle() != bodyID.GetIndexAndSequenceNumber())
+			return nullptr;
+
+		return primitive;
+	}
+}
+
+DEFINE_LOG_CATEGORY(PhysicsSystemLog)
+
+void PhysicsSystem::Init()
+{
+	JPH::RegisterDefaultAllocator();
+	JPH::Factory::sInstance = new JPH::Factory();
+	JPH::RegisterTypes();
+
+	m_Impl = new Impl(m_CollisionResponses);
+	m_Impl->Assets = m_AssetManager;
+	ReserveTempAllocator();
+	m_Impl->JobSystem = new EngineJoltJobSystem(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+
+	m_Impl->System.Init(
+		kMaxBodies,
+		0,
+		kMaxBodyPairs,
+		kMaxContactConstraints,
+		m_Impl->BroadPhase,
+		m_Impl->ObjectVsBPFilter,
+		m_Impl->LayerPairFilter);
+	m_Impl->System.SetGravity({0.0f, 0.0f, -9.81f});
+	m_Impl->System.SetContactListener(&m_Impl->Contacts);
+}
+
+void PhysicsSystem::ReserveTempAllocator()
+{
+	const MemSize wanted = kMinTempAllocatorSize + static_cast<MemSize>(m_Impl->System.GetNumBodies()) * kTempAllocatorBytesPerBody;
+	const MemSize size = (wanted + kTempAllocatorGranularity - 1) / kTempAllocatorGranularity * kTempAllocatorGranularity;
+	if (size <= m_Impl->TempAllocatorSize)
+		return;
+
+	// Only ever grows, and only between steps while nothing is allocated.
+	delete m_Impl->TempAllocator;
+	m_Impl->TempAllocator = new JPH::TempAllocatorImpl(size);
+	m_Impl->TempAllocatorSize = size;
+}
+
+void PhysicsSystem::Shutdown()
+{
+	if (m_Impl != nullptr)
+	{
+		FlushPendingBodyRemovals();
+		delete m_Impl->JobSystem;
+		delete m_Impl->TempAllocator;
+		delete m_Impl;
+		m_Impl = nullptr;
+	}
+
+	JPH::UnregisterTypes();
+	delete JPH::Factory::sInstance;
+	JPH::Factory::sInstance = nullptr;
+}
+
+void PhysicsSystem::SetAssetManagerContext(AssetManager* assetManager)
+{
+	if (m_Impl != nullptr)
+		m_Impl->Assets = assetManager;
+	m_AssetManager = assetManager;
+}
+
+const MeshShapeStats& PhysicsSystem::GetMeshShapeStats() const
+{
+	static const MeshShapeStats Empty;
+	return m_Impl != nullptr ? m_Impl->MeshStats : Empty;
+}
+
+void PhysicsSystem::SetFixedDeltaTime(Float fixedDeltaTime)
+{
+	if (fixedDeltaTime <= 0.0f)
+		return;
+
+	m_FixedDT = fixedDeltaTime;
+	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
+	if (m_Accumulator > maxAccumulatedTime)
+		m_Accumulator = maxAccumulatedTime;
+}
+
+void PhysicsSystem::SetMaxSubsteps(uint32 maxSubsteps)
+{
+	m_MaxSubsteps = std::max<uint32>(1u, maxSubsteps);
+	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
+	if (m_Accumulator > maxAccumulatedTime)
+		m_Accumulator = maxAccumulatedTime;
+}
+
+uint32 PhysicsSystem::GetBodyCount() const
+{
+	return m_Impl != nullptr ? m_Impl->System.GetNumBodies() : 0u;
+}
+
+uint32 PhysicsSystem::GetActiveBodyCount() const
+{
+	return m_Impl != nullptr ? m_Impl->System.GetNumActiveBodies(JPH::EBodyType::RigidBody) : 0u;
+}
+
+void PhysicsSystem::DestroyBodyForComponent(PrimitiveComponent& primitive)
+{
+	if (!primitive.IsBodyCreated())
+	{
+		primitive.ClearBodyHandle();
+		return;
+	}
+
+	if (primitive.GetBodyHandle() == 0 || m_Impl == nullptr)
+	{
+		primitive.ClearBodyHandle();
+		return;
+	}
+
+	const JPH::BodyID bodyID(primitive.GetBodyHandle());
+	if (bodyID.IsInvalid())
+	{
+		primitive.ClearBodyHandle();
+		return;
+	}
+
+	{
+		const JPH::BodyLockInterface& lockInterface = m_Impl->System.GetBodyLockInterface();
+		JPH::BodyLockRead lock(lockInterface, bodyID);
+		if (!lock.Succeeded())
+		{
+			primitive.ClearBodyHandle();
+			return;
+		}
+	}
+
+	// Removing from the broadphase one body at a time is the expensive part;
+	// batch it with everything else released before the next step.
+	m_Impl->ReleaseBody(bodyID);
+	primitive.ClearBodyHandle();
+	primitive.ClearRenderOffset();
+}
+
+void PhysicsSystem::FlushPendingBodyRemovals()
+{
+	if (m_Impl == nullptr || m_Impl->PendingRemovals.IsEmpty())
+		return;
+
+	auto& bodies = m_Impl->System.GetBodyInterface();
+	TArray<JPH::BodyID>& added = m_Impl->RemoveScratch;
+	added.Clear();
+	for (const JPH::BodyID& bodyID : m_Impl->PendingRemovals)
+	{
+		if (bodies.IsAdded(bodyID))
+			added.Add(bodyID);
+	}
+
+	if (!added.IsEmpty())
+		bodies.RemoveBodies(added.Data(), static_cast<int>(added.Num()));
+
+	bodies.DestroyBodies(m_Impl->PendingRemovals.Data(), static_cast<int>(m_Impl->PendingRemovals.Num()));
+	m_Impl->PendingRemovals.Clear();
+}
+
+void PhysicsSystem::CreatePendingBodies(Scene& scene)
+{
+	TArray<entt::entity>& pending = scene.GetPendingPhysicsBodies();
+	if (pending.IsEmpty())
+		return;
+
+	auto& registry = scene.GetRegistry();
+	auto& bodies = m_Impl->System.GetBodyInterface();
+	TArray<JPH::BodyID>& active = m_Impl->AddActive;
+	TArray<JPH::BodyID>& inactive = m_Impl->AddInactive;
+	active.Clear();
+	inactive.Clear();
+
+	for (const entt::entity entity : pending)
+	{
+		// The component may have been removed again before this step.
+		if (!registry.valid(entity))
+			continue;
+
+		PrimitiveComponent* const* primitivePtr = registry.try_get<PrimitiveComponent*>(entity);
+		PrimitiveComponent* primitive = primitivePtr ? *primitivePtr : nullptr;
+		if (!primitive || primitive->IsBodyCreated())
+			continue;
+
+		Actor* owner = primitive->GetOwner();
+		if (!owner || owner->IsPendingDestroy())
+			continue;
+
+		const PhysicsShape engineShape = primitive->CreatePhysicsShape();
+		if (engineShape.Type == EPhysicsShapeType::None)
+			continue;
+
+		const bool bMeshShape =
+			engineShape.Type == EPhysicsShapeType::ConvexHull ||
+			engineShape.Type == EPhysicsShapeType::TriangleMesh;
+		JPH::Ref<JPH::Shape> joltShape = bMeshShape
+			? m_Impl->BuildMeshShape(engineShape, primitive->GetWorldScale())
+			: BuildJoltShape(engineShape, primitive);
+		if (joltShape == nullptr)
+		{
+			RB_LOG(PhysicsSystemLog, warn, "Failed to build a collision shape for {}", primitive->GetEditorName().c_str())
+			continue;
+		}
+
+		JPH::EMotionType motionType = JPH::EMotionType::Dynamic;
+		switch (primitive->BodyType)
+		{
+		case ERBBodyType::Static: motionType = JPH::EMotionType::Static; break;
+		case ERBBodyType::Dynamic: motionType = JPH::EMotionType::Dynamic; break;
+		case ERBBodyType::Kinematic: motionType = JPH::EMotionType::Kinematic; break;
+		}
+
+		const CollisionChannel channel = ResolveBodyCollisionChannel(*primitive);
+		const JPH::ObjectLayer objectLayer = MakeObjectLayer(channel, motionType != JPH::EMotionType::Static);
+
+		// Spawn body from the owning primitive's world transform (not actor root).
+		JPH::BodyCreationSettings settings(
+			joltShape,
+			ToJoltR(primitive->GetWorldPosition()),
+			ToJoltQ(primitive->GetWorldRotationQuat()),
+			motionType,
+			objectLayer);
+
+		settings.mIsSensor = primitive->bIsTrigger || channel == CollisionChannel::Trigger;
+		settings.mUserData = EncodeEntityID(owner->GetHandle());
+
+		// Moving triggers should still notice level geometry.
+		if (settings.mIsSensor && motionType == JPH::EMotionType::Kinematic)
+			settings.mCollideKinematicVsNonDynamic = true;
 
-	m_FixedDT = fixedDeltaTime;
-	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
-	if (m_Accumulator > maxAccumulatedTime)
-		m_Accumulator = maxAccumulatedTime;
-}
+		JPH::Body* body = bodies.CreateBody(settings);
+		if (!body)
+			continue;
 
-void PhysicsSystem::SetMaxSubsteps(uint32 maxSubsteps)
-{
-	m_MaxSubsteps = std::max<uint32>(1u, maxSubsteps);
-	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
-	if (m_Accumulator > maxAccumulatedTime)
-		m_Accumulator = maxAccumulatedTime;
-}
-void PhysicsSystem::DestroyBodyForComponent(PrimitiveComponent& primitive)
-{
-	if (!primitive.IsBodyCreated())
-	{
-		primitive.ClearBodyHandle();
-		return;
-	}
+		// AddBodiesPrepare reorders its input, so hand out the handle now.
+		primitive->SetBodyHandle(body->GetID().GetIndexAndSequenceNumber());
+		const uint8 eventFlags = settings.mIsSensor ? kBodyEventOverlap : (primitive->bGenerateHitEvents ? kBodyEventHit : 0);
+		m_Impl->MapBody(body->GetID(), entity, eventFlags);
 
-	if (primitive.GetBodyHandle() == 0 || m_Impl == nullptr)
-	{
-		primitive.ClearBodyHandle();
-		return;
-	}
+		if (motionType == JPH::EMotionType::Kinematic)
+		{
+			Impl::KinematicBody& kinematic = m_Impl->Kinematics.Emplace();
+			kinematic.Entity = entity;
+			kinematic.BodyID = body->GetID();
+			kinematic.TargetPosition = primitive->GetWorldPosition();
+			kinematic.TargetRotation = primitive->GetWorldRotationQuat();
+		}
 
-	auto& bodies = m_Impl->System.GetBodyInterface();
-	const JPH::BodyID bodyID(primitive.GetBodyHandle());
-	if (bodyID.IsInvalid())
-	{
-		primitive.ClearBodyHandle();
-		return;
+		if (motionType == JPH::EMotionType::Dynamic)
+			active.Add(body->GetID());
+		else
+			inactive.Add(body->GetID());
 	}
 
+	pending.Clear();
+
+	auto addBatch = [&bodies](TArray<JPH::BodyID>& batch, JPH::EActivation activation)
 	{
-		const JPH::BodyLockInterface& lockInterface = m_Impl->System.GetBodyLockInterface();
-		JPH::BodyLockRead lock(lockInterface, bodyID);
-		if (!lock.Succeeded())
-		{
-			primitive.ClearBodyHandle();
+		if (batch.IsEmpty())
 			return;
-		}
-	}
 
-	if (bodies.IsAdded(bodyID))
-		bodies.RemoveBody(bodyID);
+		const int count = static_cast<int>(batch.Num());
+		const JPH::BodyInterface::AddState state = bodies.AddBodiesPrepare(batch.Data(), count);
+		bodies.AddBodiesFinalize(batch.Data(), count, state, activation);
+	};
+	addBatch(inactive, JPH::EActivation::DontActivate);
+	addBatch(active, JPH::EActivation::Activate);
 
-	bodies.DestroyBody(bodyID);
-	primitive.ClearBodyHandle();
+	// Bulk loads leave the broadphase tree unbalanced until rebuilt.
+	if (active.Num() + inactive.Num() >= kOptimizeBroadPhaseBatch)
+		m_Impl->System.OptimizeBroadPhase();
 }
 
 static void DebugDrawHalfSphereAt(
@@ -630,140 +1753,345 @@ void PhysicsSystem::EditorDebugDraw(Scene& scene)
 		case EPhysicsShapeType::Box: DebugDrawBox(shape, primitive, color); break;
 		case EPhysicsShapeType::Sphere: DebugDrawSphere(shape, primitive, color); break;
 		case EPhysicsShapeType::Capsule: DebugDrawCapsule(shape, primitive, color); break;
+		// Mesh collision matches the rendered mesh closely enough to skip.
+		default: break;
 		}
 	}
 }
 
-void PhysicsSystem::Step(Scene& scene, Float dt)
+void PhysicsSystem::SyncKinematicTargets(Scene& scene)
 {
-	if (m_Impl == nullptr)
-		return;
-
 	auto& registry = scene.GetRegistry();
-	auto& bodies = m_Impl->System.GetBodyInterface();
+	TArray<Impl::KinematicBody>& kinematics = m_Impl->Kinematics;
 
-	auto view = registry.view<PrimitiveComponent*>();
-	for (auto entity : view)
+	for (MemSize i = 0; i < kinematics.Num();)
 	{
-		PrimitiveComponent* primitive = view.get<PrimitiveComponent*>(entity);
-		if (!primitive)
-			continue;
-
-		Actor* owner = primitive->GetOwner();
+		Impl::KinematicBody& kinematic = kinematics[i];
+		PrimitiveComponent* primitive = ResolveBodyPrimitive(registry, kinematic.Entity, kinematic.BodyID);
+		Actor* owner = primitive ? primitive->GetOwner() : nullptr;
 		if (!owner || owner->IsPendingDestroy())
 		{
-			DestroyBodyForComponent(*primitive);
+			if (primitive)
+				DestroyBodyForComponent(*primitive);
+			else if (m_Impl->GetBodyEntity(kinematic.BodyID) == kinematic.Entity)
+				m_Impl->ReleaseBody(kinematic.BodyID);
+
+			kinematics.EraseAtSwap(i);
 			continue;
 		}
 
-		if (primitive->IsBodyCreated())
+		// Drive kinematic bodies from the owning primitive's world transform.
+		const Vector3 position = primitive->GetWorldPosition();
+		const Quaternion rotation = primitive->GetWorldRotationQuat();
+		if (position != kinematic.TargetPosition || rotation != kinematic.TargetRotation)
+		{
+			kinematic.TargetPosition = position;
+			kinematic.TargetRotation = rotation;
+			kinematic.bNeedsMove = true;
+		}
+		++i;
+	}
+}
+
+void PhysicsSystem::DriveKinematicBodies()
+{
+	auto& bodies = m_Impl->System.GetBodyInterfaceNoLock();
+	for (Impl::KinematicBody& kinematic : m_Impl->Kinematics)
+	{
+		if (!kinematic.bNeedsMove && !kinematic.bSettling)
 			continue;
 
-		const PhysicsShape engineShape = primitive->CreatePhysicsShape();
-		JPH::Ref<JPH::Shape> joltShape = BuildJoltShape(engineShape, primitive);
-		if (joltShape == nullptr)
+		// A body already at its target gets zero velocity from MoveKinematic,
+		// which stops it one substep after it arrives.
+		bodies.MoveKinematic(kinematic.BodyID, ToJoltR(kinematic.TargetPosition), ToJoltQ(kinematic.TargetRotation), m_FixedDT);
+		kinematic.bSettling = kinematic.bNeedsMove;
+		kinematic.bNeedsMove = false;
+	}
+}
+
+void PhysicsSystem::WriteBackActiveBodies(Scene& scene)
+{
+	auto& registry = scene.GetRegistry();
+	const JPH::BodyLockInterfaceNoLock& lockInterface = m_Impl->System.GetBodyLockInterfaceNoLock();
+
+	// Sleeping bodies have not moved; only Jolt's active list needs syncing.
+	const uint32 activeCount = m_Impl->System.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+	const JPH::BodyID* activeBodies = m_Impl->System.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+	for (uint32 i = 0; i < activeCount; ++i)
+	{
+		const JPH::BodyID bodyID = activeBodies[i];
+		const entt::entity entity = m_Impl->GetBodyEntity(bodyID);
+		if (entity == entt::null)
 			continue;
 
-		JPH::EMotionType motionType = JPH::EMotionType::Dynamic;
-		switch (primitive->BodyType)
+		PrimitiveComponent* primitive = ResolveBodyPrimitive(registry, entity, bodyID);
+		if (!primitive)
 		{
-		case ERBBodyType::Static: motionType = JPH::EMotionType::Static; break;
-		case ERBBodyType::Dynamic: motionType = JPH::EMotionType::Dynamic; break;
-		case ERBBodyType::Kinematic: motionType = JPH::EMotionType::Kinematic; break;
+			m_Impl->ReleaseBody(bodyID);
+			continue;
 		}
 
-		if (primitive->BodyType == ERBBodyType::Kinematic)
+		Actor* owner = primitive->GetOwner();
+		if (!owner || owner->IsPendingDestroy())
 		{
-			RB_LOG(PhysicsSystemLog, info, "test")
+			DestroyBodyForComponent(*primitive);
+			continue;
 		}
 
-		const CollisionChannel channel = ResolveBodyCollisionChannel(*primitive);
-		const JPH::ObjectLayer objectLayer = ToObjectLayer(channel);
+		if (primitive->BodyType != ERBBodyType::Dynamic)
+			continue;
 
-		// Spawn body from the owning primitive's world transform (not actor root).
-		JPH::BodyCreationSettings settings(
-			joltShape,
-			ToJoltR(primitive->GetWorldPosition()),
-			ToJoltQ(primitive->GetWorldRotationQuat()),
-			motionType,
-			objectLayer);
+		JPH::BodyLockRead lock(lockInterface, bodyID);
+		if (!lock.Succeeded())
+			continue;
 
-		settings.mIsSensor = primitive->bIsTrigger || channel == CollisionChannel::Trigger;
-		settings.mUserData = EncodeEntityID(owner->GetHandle());
+		// Write dynamic simulation results back to the owning primitive in world space.
+		const JPH::Body& body = lock.GetBody();
+		primitive->SetWorldPosition(ToRebel(body.GetPosition()));
+		primitive->SetWorldRotationQuat(ToRebel(body.GetRotation()));
+	}
+}
 
-		JPH::Body* body = bodies.CreateBody(settings);
-		if (!body)
+void PhysicsSystem::BeginInterpolation(Scene& scene)
+{
+	ClearInterpolation(scene);
+
+	const JPH::BodyLockInterfaceNoLock& lockInterface = m_Impl->System.GetBodyLockInterfaceNoLock();
+	const uint32 activeCount = m_Impl->System.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+	const JPH::BodyID* activeBodies = m_Impl->System.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+	for (uint32 i = 0; i < activeCount; ++i)
+	{
+		const JPH::BodyID bodyID = activeBodies[i];
+		const entt::entity entity = m_Impl->GetBodyEntity(bodyID);
+		if (entity == entt::null)
 			continue;
 
-		const JPH::EActivation activation = motionType == JPH::EMotionType::Dynamic
-			? JPH::EActivation::Activate
-			: JPH::EActivation::DontActivate;
-		bodies.AddBody(body->GetID(), activation);
+		JPH::BodyLockRead lock(lockInterface, bodyID);
+		if (!lock.Succeeded() || !lock.GetBody().IsDynamic())
+			continue;
 
-		primitive->SetBodyHandle(body->GetID().GetIndexAndSequenceNumber());
+		const JPH::Body& body = lock.GetBody();
+		Impl::InterpolatedBody& entry = m_Impl->Interpolated.Emplace();
+		entry.Entity = entity;
+		entry.BodyID = bodyID;
+		entry.PrevPosition = ToRebel(body.GetPosition());
+		entry.PrevRotation = ToRebel(body.GetRotation());
+		entry.Position = entry.PrevPosition;
+		entry.Rotation = entry.PrevRotation;
 	}
+}
 
-	const Float safeDt = std::max<Float>(0.0f, dt);
-	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
-	m_Accumulator = std::min(m_Accumulator + safeDt, maxAccumulatedTime);
-	m_LastSubstepCount = 0;
+void PhysicsSystem::UpdateInterpolation(Scene& scene, bool bStepped)
+{
+	auto& registry = scene.GetRegistry();
+	const JPH::BodyLockInterfaceNoLock& lockInterface = m_Impl->System.GetBodyLockInterfaceNoLock();
+	const Float alpha = std::clamp(GetInterpolationAlpha(), 0.0f, 1.0f);
 
-	while (m_Accumulator >= m_FixedDT && m_LastSubstepCount < m_MaxSubsteps)
+	for (Impl::InterpolatedBody& entry : m_Impl->Interpolated)
 	{
-		for (auto entity : view)
+		PrimitiveComponent* primitive = ResolveBodyPrimitive(registry, entry.Entity, entry.BodyID);
+		if (!primitive)
+			continue;
+
+		if (bStepped)
 		{
-			PrimitiveComponent* primitive = view.get<PrimitiveComponent*>(entity);
-			if (!primitive)
-				continue;
+			JPH::BodyLockRead lock(lockInterface, entry.BodyID);
+			if (lock.Succeeded())
+			{
+				entry.Position = ToRebel(lock.GetBody().GetPosition());
+				entry.Rotation = ToRebel(lock.GetBody().GetRotation());
+			}
+		}
+
+		const Vector3 position = glm::mix(entry.PrevPosition, entry.Position, alpha);
+		const Quaternion rotation = glm::slerp(entry.PrevRotation, entry.Rotation, alpha);
 
-			if (primitive->BodyType != ERBBodyType::Kinematic)
-				continue;
+		// Takes the simulated pose the component holds to the blended one.
+		const Mat4 offset =
+			glm::translate(Mat4(1.0f), position) *
+			glm::toMat4(rotation * glm::inverse(entry.Rotation)) *
+			glm::translate(Mat4(1.0f), -entry.Position);
+		primitive->SetRenderOffset(offset);
+	}
+}
 
-			if (!primitive->IsBodyCreated() || primitive->GetBodyHandle() == 0)
-				continue;
+void PhysicsSystem::ClearInterpolation(Scene& scene)
+{
+	auto& registry = scene.GetRegistry();
+	for (const Impl::InterpolatedBody& entry : m_Impl->Interpolated)
+	{
+		if (PrimitiveComponent* primitive = ResolveBodyPrimitive(registry, entry.Entity, entry.BodyID))
+			primitive->ClearRenderOffset();
+	}
+	m_Impl->Interpolated.Clear();
+}
 
-			Actor* owner = primitive->GetOwner();
-			if (!owner || owner->IsPendingDestroy())
+void PhysicsSystem::DispatchContactEvents(Scene& scene)
+{
+	TArray<RawContactEvent>& events = m_Impl->ContactEvents;
+	events.Clear();
+	m_Impl->Contacts.Collect(events);
+
+	std::sort(events.Data(), events.Data() + events.Num(),
+		[](const RawContactEvent& a, const RawContactEvent& b) { return a.PairKey < b.PairKey; });
+
+	auto isMapped = [this](const JPH::BodyID& bodyID) { return m_Impl->GetBodyEntity(bodyID) != entt::null; };
+
+	// Merge this step's sub-shape changes into the per-pair touching set. Both
+	// lists are sorted, so one walk yields each pair once.
+	const TArray<ContactPair>& previous = m_Impl->TouchingPairs;
+	TArray<ContactPair>& next = m_Impl->TouchingScratch;
+	TArray<ContactDispatch>& dispatches = m_Impl->ContactDispatches;
+	next.Clear();
+	dispatches.Clear();
+
+	MemSize p = 0;
+	MemSize e = 0;
+	while (p < previous.Num() || e < events.Num())
+	{
+		uint64 key = p < previous.Num() ? previous[p].PairKey : ~uint64(0);
+		if (e < events.Num() && events[e].PairKey < key)
+			key = events[e].PairKey;
+
+		const bool bWasTouching = p < previous.Num() && previous[p].PairKey == key;
+		ContactPair pair;
+		if (bWasTouching)
+			pair = previous[p++];
+		else
+			pair.PairKey = key;
+
+		int64 count = pair.Count;
+		uint32 added = 0;
+		bool bReported = false;
+		for (; e < events.Num() && events[e].PairKey == key; ++e)
+		{
+			const RawContactEvent& event = events[e];
+			bReported = true;
+			pair.EventFlags |= event.EventFlags;
+			count += event.Delta;
+			if (event.Delta > 0)
 			{
-				DestroyBodyForComponent(*primitive);
-				continue;
+				++added;
+				pair.OwnerLow = event.OwnerLow;
+				pair.OwnerHigh = event.OwnerHigh;
+			}
+			if (event.Delta >= 0)
+			{
+				pair.Position = event.Position;
+				pair.Normal = event.Normal;
 			}
+		}
 
-			const JPH::BodyID bodyID(primitive->GetBodyHandle());
-			// Drive kinematic bodies from the owning primitive's world transform.
-			bodies.MoveKinematic(bodyID, ToJoltR(primitive->GetWorldPosition()), ToJoltQ(primitive->GetWorldRotationQuat()), m_FixedDT);
+		// A released body ends its contacts even if Jolt reports nothing.
+		if (count > 0 && (!isMapped(GetContactPairLow(key)) || !isMapped(GetContactPairHigh(key))))
+			count = 0;
+
+		const bool bTouching = count > 0;
+		if (!bWasTouching && added > 0)
+		{
+			dispatches.Add({pair, EContactPhase::Begin});
+			if (!bTouching)
+				dispatches.Add({pair, EContactPhase::End});
+		}
+		else if (bWasTouching && !bTouching)
+		{
+			dispatches.Add({pair, EContactPhase::End});
+		}
+		else if (bWasTouching && bReported && (pair.EventFlags & kBodyEventOverlap) == 0)
+		{
+			// Sleeping pairs report nothing and stay quiet.
+			dispatches.Add({pair, EContactPhase::Persist});
 		}
 
-		m_Impl->System.Update(m_FixedDT, 8, m_Impl->TempAllocator, m_Impl->JobSystem);
-		m_Accumulator -= m_FixedDT;
-		++m_LastSubstepCount;
+		if (bTouching)
+		{
+			pair.Count = static_cast<uint32>(count);
+			next.Add(pair);
+		}
 	}
 
-	for (auto entity : view)
+	std::swap(m_Impl->TouchingPairs, m_Impl->TouchingScratch);
+
+	// Handlers run with the touching set already updated; they may spawn or
+	// destroy freely, so every component is resolved right before its call.
+	auto& registry = scene.GetRegistry();
+	auto resolve = [this, &registry](const JPH::BodyID& bodyID) -> PrimitiveComponent*
 	{
-		PrimitiveComponent* primitive = view.get<PrimitiveComponent*>(entity);
-		if (!primitive)
-			continue;
+		return ResolveBodyPrimitive(registry, m_Impl->GetBodyEntity(bodyID), bodyID);
+	};
 
-		if (!primitive->IsBodyCreated() || primitive->GetBodyHandle() == 0)
-			continue;
+	auto notify = [&resolve](const ContactDispatch& dispatch, const JPH::BodyID& self, const JPH::BodyID& other, EntityID otherActor, const Vector3& normal)
+	{
+		PrimitiveComponent* selfComponent = resolve(self);
+		if (!selfComponent)
+			return;
 
-		Actor* owner = primitive->GetOwner();
-		if (!owner || owner->IsPendingDestroy())
+		PrimitiveContact contact;
+		contact.Other = resolve(other);
+		contact.OtherActor = otherActor;
+		contact.Position = dispatch.Pair.Position;
+		contact.Normal = normal;
+		contact.Phase = dispatch.Phase;
+
+		if ((dispatch.Pair.EventFlags & kBodyEventOverlap) != 0)
 		{
-			DestroyBodyForComponent(*primitive);
-			continue;
+			if (dispatch.Phase == EContactPhase::Begin)
+				selfComponent->OnBeginOverlap.Broadcast(*selfComponent, contact);
+			else if (dispatch.Phase == EContactPhase::End)
+				selfComponent->OnEndOverlap.Broadcast(*selfComponent, contact);
 		}
-
-		const JPH::BodyID bodyID(primitive->GetBodyHandle());
-		if (primitive->BodyType == ERBBodyType::Dynamic)
+		else if (selfComponent->bGenerateHitEvents)
 		{
-			// Write dynamic simulation results back to the owning primitive in world space.
-			primitive->SetWorldPosition(ToRebel(bodies.GetPosition(bodyID)));
-			primitive->SetWorldRotationQuat(ToRebel(bodies.GetRotation(bodyID)));
+			selfComponent->OnHit.Broadcast(*selfComponent, contact);
 		}
+	};
+
+	for (const ContactDispatch& dispatch : dispatches)
+	{
+		const JPH::BodyID low = GetContactPairLow(dispatch.Pair.PairKey);
+		const JPH::BodyID high = GetContactPairHigh(dispatch.Pair.PairKey);
+		notify(dispatch, low, high, dispatch.Pair.OwnerHigh, dispatch.Pair.Normal);
+		notify(dispatch, high, low, dispatch.Pair.OwnerLow, -dispatch.Pair.Normal);
+	}
+}
+
+void PhysicsSystem::Step(Scene& scene, Float dt)
+{
+	if (m_Impl == nullptr)
+		return;
+
+	FlushPendingBodyRemovals();
+	CreatePendingBodies(scene);
+	SyncKinematicTargets(scene);
+	ReserveTempAllocator();
+	m_Impl->Contacts.BeginStep();
+
+	const Float safeDt = std::max<Float>(0.0f, dt);
+	const Float maxAccumulatedTime = m_FixedDT * static_cast<Float>(m_MaxSubsteps);
+	m_Accumulator = std::min(m_Accumulator + safeDt, maxAccumulatedTime);
+	m_LastSubstepCount = 0;
+
+	while (m_Accumulator >= m_FixedDT && m_LastSubstepCount < m_MaxSubsteps)
+	{
+		DriveKinematicBodies();
+
+		// Rendering blends from the poses going into the last substep.
+		const bool bLastSubstep = m_Accumulator - m_FixedDT < m_FixedDT || m_LastSubstepCount + 1 == m_MaxSubsteps;
+		if (m_bInterpolate && bLastSubstep)
+			BeginInterpolation(scene);
+
+		m_Impl->System.Update(m_FixedDT, 8, m_Impl->TempAllocator, m_Impl->JobSystem);
+		m_Accumulator -= m_FixedDT;
+		++m_LastSubstepCount;
 	}
 
+	WriteBackActiveBodies(scene);
+	if (m_bInterpolate)
+		UpdateInterpolation(scene, m_LastSubstepCount > 0);
+	else if (!m_Impl->Interpolated.IsEmpty())
+		ClearInterpolation(scene);
+	DispatchContactEvents(scene);
+
 	EditorDebugDraw(scene);
 }
 
@@ -773,20 +2101,7 @@ bool PhysicsSystem::LineTraceSingle(const Vector3& start, const Vector3& end, Tr
 	if (m_Impl == nullptr)
 		return false;
 
-	const Vector3 displacement = end - start;
-	const float distance = glm::length(displacement);
-	if (distance <= kSmallTraceDistance)
-		return false;
-
-	TraceObjectLayerFilter objectFilter(params.Channel);
-	TraceBodyFilter bodyFilter(params);
-
-	const JPH::RRayCast ray(ToJoltR(start), ToJolt(displacement));
-	JPH::RayCastResult rayHit;
-	if (!m_Impl->System.GetNarrowPhaseQuery().CastRay(ray, rayHit, {}, objectFilter, bodyFilter))
-		return false;
-
-	return FillTraceHitFromRay(m_Impl->System, ray, distance, rayHit, outHit);
+	return RayCastSingleInternal(m_Impl->MakeQueryContext(m_CollisionResponses, true), start, end, params, outHit);
 }
 
 bool PhysicsSystem::LineTraceMulti(const Vector3& start, const Vector3& end, std::vector<TraceHit>& outHits, const TraceQueryParams& params) const
@@ -800,12 +2115,15 @@ bool PhysicsSystem::LineTraceMulti(const Vector3& start, const Vector3& end, std
 	if (distance <= kSmallTraceDistance)
 		return false;
 
-	TraceObjectLayerFilter objectFilter(params.Channel);
+	TraceObjectLayerFilter objectFilter(params.Channel, m_CollisionResponses);
 	TraceBodyFilter bodyFilter(params);
 
 	const JPH::RRayCast ray(ToJoltR(start), ToJolt(displacement));
 	JPH::RayCastSettings settings;
-	JPH::AllHitCollisionCollector<JPH::CastRayCollector> collector;
+
+	// Reused per thread so repeated traces keep the hit storage.
+	thread_local JPH::AllHitCollisionCollector<JPH::CastRayCollector> collector;
+	collector.Reset();
 
 	m_Impl->System.GetNarrowPhaseQuery().CastRay(ray, settings, collector, {}, objectFilter, bodyFilter);
 	if (!collector.HadHit())
@@ -814,10 +2132,11 @@ bool PhysicsSystem::LineTraceMulti(const Vector3& start, const Vector3& end, std
 	collector.Sort();
 	outHits.reserve(collector.mHits.size());
 
+	const JPH::BodyLockInterface& lockInterface = m_Impl->System.GetBodyLockInterface();
 	for (const JPH::RayCastResult& joltHit : collector.mHits)
 	{
 		TraceHit hit;
-		if (FillTraceHitFromRay(m_Impl->System, ray, distance, joltHit, hit))
+		if (FillTraceHitFromRay(lockInterface, ray, distance, joltHit, hit))
 			outHits.push_back(hit);
 	}
 
@@ -827,47 +2146,32 @@ bool PhysicsSystem::LineTraceMulti(const Vector3& start, const Vector3& end, std
 bool PhysicsSystem::SphereTraceSingle(const Vector3& start, const Vector3& end, float radius, TraceHit& outHit, const TraceQueryParams& params) const
 {
 	outHit = {};
-	if (m_Impl == nullptr || radius <= 0.0f)
+	if (m_Impl == nullptr)
 		return false;
 
-	const Vector3 displacement = end - start;
-	const JPH::SphereShape sphere(radius);
-	return CastShapeSingleInternal(m_Impl->System, sphere, start, Quaternion(1.0f, 0.0f, 0.0f, 0.0f), displacement, params, outHit);
+	SceneQuery query;
+	query.Shape = ESceneQueryShape::Sphere;
+	query.Start = start;
+	query.End = end;
+	query.Radius = radius;
+	query.Params = params;
+	return RunSceneQuery(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outHit);
 }
 
 bool PhysicsSystem::CapsuleTraceSingle(const Vector3& start, const Vector3& end, float halfHeight, float radius, TraceHit& outHit, const TraceQueryParams& params) const
 {
 	outHit = {};
-	if (m_Impl == nullptr || radius <= 0.0f || halfHeight <= 0.0f)
-		return false;
-
-	if (halfHeight <= radius + kSmallTraceDistance)
-		return SphereTraceSingle(start, end, radius, outHit, params);
-
-	const Vector3 displacement = end - start;
-	const float capsuleHalfHeight = std::max(halfHeight - radius, 0.001f);
-
-	JPH::CapsuleShapeSettings capsuleSettings(capsuleHalfHeight, radius);
-	auto capsuleResult = capsuleSettings.Create();
-	if (capsuleResult.HasError())
-		return false;
-
-	const JPH::Quat rotation = JPH::Quat::sRotation(JPH::Vec3::sAxisX(), JPH::DegreesToRadians(90.0f));
-	JPH::RotatedTranslatedShapeSettings orientedCapsuleSettings(JPH::Vec3::sZero(), rotation, capsuleResult.Get());
-	auto orientedCapsuleResult = orientedCapsuleSettings.Create();
-	if (orientedCapsuleResult.HasError())
+	if (m_Impl == nullptr)
 		return false;
 
-	JPH::Ref<JPH::Shape> orientedCapsule = orientedCapsuleResult.Get();
-
-	return CastShapeSingleInternal(
-		m_Impl->System,
-		*orientedCapsule,
-		start,
-		Quaternion(1.0f, 0.0f, 0.0f, 0.0f),
-		displacement,
-		params,
-		outHit);
+	SceneQuery query;
+	query.Shape = ESceneQueryShape::Capsule;
+	query.Start = start;
+	query.End = end;
+	query.Radius = radius;
+	query.HalfHeight = halfHeight;
+	query.Params = params;
+	return RunSceneQuery(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outHit);
 }
 
 bool PhysicsSystem::BoxTraceSingle(
@@ -879,12 +2183,109 @@ bool PhysicsSystem::BoxTraceSingle(
 	const TraceQueryParams& params) const
 {
 	outHit = {};
-	if (m_Impl == nullptr || halfExtents.x <= 0.0f || halfExtents.y <= 0.0f || halfExtents.z <= 0.0f)
+	if (m_Impl == nullptr)
 		return false;
 
-	const Vector3 displacement = end - start;
-	const JPH::BoxShape box(ToJolt(halfExtents));
-	return CastShapeSingleInternal(m_Impl->System, box, start, rotation, displacement, params, outHit);
+	SceneQuery query;
+	query.Shape = ESceneQueryShape::Box;
+	query.Start = start;
+	query.End = end;
+	query.HalfExtent = halfExtents;
+	query.Rotation = rotation;
+	query.Params = params;
+	return RunSceneQuery(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outHit);
+}
+
+uint32 PhysicsSystem::RunSceneQueries(const SceneQuery* queries, SceneQueryResult* outResults, uint32 count) const
+{
+	if (m_Impl == nullptr)
+	{
+		for (uint32 i = 0; i < count; ++i)
+			outResults[i] = {};
+		return 0;
+	}
+
+	// Nothing writes bodies between steps, so workers read without locks.
+	const QueryContext context = m_Impl->MakeQueryContext(m_CollisionResponses, false);
+	std::atomic<uint32> hitCount{0};
+
+	Rebel::Core::Threading::JobSystem::Get().ParallelFor(count, kSceneQueryGrain,
+		[&](MemSize begin, MemSize end)
+		{
+			uint32 hits = 0;
+			for (MemSize i = begin; i < end; ++i)
+			{
+				SceneQueryResult& result = outResults[i];
+				result.bHit = RunSceneQuery(context, queries[i], result.Hit);
+				hits += result.bHit ? 1u : 0u;
+			}
+			hitCount.fetch_add(hits, std::memory_order_relaxed);
+		});
+
+	return hitCount.load(std::memory_order_relaxed);
+}
+
+bool PhysicsSystem::OverlapSphereMulti(const Vector3& center, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+	outEntities.clear();
+	if (m_Impl == nullptr)
+		return false;
+
+	SceneQuery query;
+	query.Kind = ESceneQueryKind::Overlap;
+	query.Shape = ESceneQueryShape::Sphere;
+	query.Start = center;
+	query.Radius = radius;
+	query.Params = params;
+	return OverlapMultiInternal(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outEntities);
+}
+
+bool PhysicsSystem::OverlapCapsuleMulti(const Vector3& center, float halfHeight, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+	outEntities.clear();
+	if (m_Impl == nullptr)
+		return false;
+
+	SceneQuery query;
+	query.Kind = ESceneQueryKind::Overlap;
+	query.Shape = ESceneQueryShape::Capsule;
+	query.Start = center;
+	query.HalfHeight = halfHeight;
+	query.Radius = radius;
+	query.Params = params;
+	return OverlapMultiInternal(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outEntities);
+}
+
+bool PhysicsSystem::OverlapBoxMulti(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+	outEntities.clear();
+	if (m_Impl == nullptr)
+		return false;
+
+	SceneQuery query;
+	query.Kind = ESceneQueryKind::Overlap;
+	query.Shape = ESceneQueryShape::Box;
+	query.Start = center;
+	query.HalfExtent = halfExtents;
+	query.Rotation = rotation;
+	query.Params = params;
+	return OverlapMultiInternal(m_Impl->MakeQueryContext(m_CollisionResponses, true), query, outEntities);
+}
+
+bool PhysicsSystem::QueryAABB(const Vector3& min, const Vector3& max, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+	outEntities.clear();
+	if (m_Impl == nullptr)
+		return false;
+
+	const QueryContext context = m_Impl->MakeQueryContext(m_CollisionResponses, true);
+	TraceObjectLayerFilter objectFilter(params.Channel, m_CollisionResponses);
+	TraceBodyFilter bodyFilter(params);
+	BoundsEntityCollector collector(context.Locks, bodyFilter, outEntities);
+
+	const JPH::AABox bounds(ToJolt(glm::min(min, max)), ToJolt(glm::max(min, max)));
+	context.BroadPhase.CollideAABox(bounds, collector, {}, objectFilter);
+	return FinishEntityList(outEntities);
 }
 
 
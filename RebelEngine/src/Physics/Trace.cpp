@@ -71,6 +71,41 @@ namespace
 	}
 }
 
+CollisionResponseMatrix::CollisionResponseMatrix()
+{
+	for (uint32 i = 0; i < ChannelCount; ++i)
+		m_Rows[i] = static_cast<uint8>((1u << ChannelCount) - 1u);
+
+	SetResponse(CollisionChannel::Camera, CollisionChannel::Pawn, false);
+	SetResponse(CollisionChannel::Camera, CollisionChannel::Trigger, false);
+	SetResponse(CollisionChannel::Visibility, CollisionChannel::Trigger, false);
+}
+
+void CollisionResponseMatrix::SetResponse(CollisionChannel a, CollisionChannel b, bool bResponds)
+{
+	if (a == CollisionChannel::Any || b == CollisionChannel::Any)
+		return;
+
+	const uint32 ia = static_cast<uint32>(a);
+	const uint32 ib = static_cast<uint32>(b);
+	if (bResponds)
+	{
+		m_Rows[ia] |= static_cast<uint8>(1u << ib);
+		m_Rows[ib] |= static_cast<uint8>(1u << ia);
+	}
+	else
+	{
+		m_Rows[ia] &= static_cast<uint8>(~(1u << ib));
+		m_Rows[ib] &= static_cast<uint8>(~(1u << ia));
+	}
+}
+
+void CollisionResponseMatrix::SetAllResponses(CollisionChannel channel, bool bResponds)
+{
+	for (uint32 i = 0; i < ChannelCount; ++i)
+		SetResponse(channel, static_cast<CollisionChannel>(i), bResponds);
+}
+
 bool LineTraceSingle(
 	const Vector3& start,
 	const Vector3& end,
@@ -305,6 +340,139 @@ bool BoxTraceSingle(
 	return BoxTraceSingle(*world, start, end, halfExtents, rotation, outHit, params, drawDebugType);
 }
 
+uint32 RunSceneQueries(
+	World& world,
+	const SceneQuery* queries,
+	SceneQueryResult* outResults,
+	uint32 count)
+{
+	return world.RunSceneQueries(queries, outResults, count);
+}
+
+uint32 RunSceneQueries(
+	const SceneQuery* queries,
+	SceneQueryResult* outResults,
+	uint32 count)
+{
+	World* world = GetActiveWorld();
+	if (!world)
+	{
+		for (uint32 i = 0; i < count; ++i)
+			outResults[i] = {};
+		return 0;
+	}
+
+	return RunSceneQueries(*world, queries, outResults, count);
+}
+
+bool OverlapSphereMulti(
+	World& world,
+	const Vector3& center,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	return world.OverlapSphereMulti(center, radius, outEntities, params);
+}
+
+bool OverlapSphereMulti(
+	const Vector3& center,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	World* world = GetActiveWorld();
+	if (!world)
+	{
+		outEntities.clear();
+		return false;
+	}
+
+	return OverlapSphereMulti(*world, center, radius, outEntities, params);
+}
+
+bool OverlapCapsuleMulti(
+	World& world,
+	const Vector3& center,
+	float halfHeight,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	return world.OverlapCapsuleMulti(center, halfHeight, radius, outEntities, params);
+}
+
+bool OverlapCapsuleMulti(
+	const Vector3& center,
+	float halfHeight,
+	float radius,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	World* world = GetActiveWorld();
+	if (!world)
+	{
+		outEntities.clear();
+		return false;
+	}
+
+	return OverlapCapsuleMulti(*world, center, halfHeight, radius, outEntities, params);
+}
+
+bool OverlapBoxMulti(
+	World& world,
+	const Vector3& center,
+	const Vector3& halfExtents,
+	const Quaternion& rotation,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	return world.OverlapBoxMulti(center, halfExtents, rotation, outEntities, params);
+}
+
+bool OverlapBoxMulti(
+	const Vector3& center,
+	const Vector3& halfExtents,
+	const Quaternion& rotation,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	World* world = GetActiveWorld();
+	if (!world)
+	{
+		outEntities.clear();
+		return false;
+	}
+
+	return OverlapBoxMulti(*world, center, halfExtents, rotation, outEntities, params);
+}
+
+bool QueryAABB(
+	World& world,
+	const Vector3& min,
+	const Vector3& max,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	return world.QueryAABB(min, max, outEntities, params);
+}
+
+bool QueryAABB(
+	const Vector3& min,
+	const Vector3& max,
+	std::vector<EntityID>& outEntities,
+	const TraceQueryParams& params)
+{
+	World* world = GetActiveWorld();
+	if (!world)
+	{
+		outEntities.clear();
+		return false;
+	}
+
+	return QueryAABB(*world, min, max, outEntities, params);
+}
+
 void DrawDebugLineTrace(const Vector3& start, const Vector3& end, const TraceHit* hit)
 {
 	if (hit != nullptr && (hit->HitEntity != entt::null || hit->bBlockingHit))
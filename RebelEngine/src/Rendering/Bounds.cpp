@@ -0,0 +1,141 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Rendering/Bounds.h"
+
+#include "Engine/Rendering/Buffers.h"
+
+BoxSphereBounds BoxSphereBounds::FromMinMax(const Vector3& min, const Vector3& max)
+{
+	BoxSphereBounds bounds;
+	bounds.Center = (min + max) * 0.5f;
+	bounds.Extents = (max - min) * 0.5f;
+	bounds.Radius = FMath::length(bounds.Extents);
+	return bounds;
+}
+
+BoxSphereBounds BoxSphereBounds::FromVertices(const TArray<Vertex>& vertices)
+{
+	if (vertices.IsEmpty())
+		return {};
+
+	Vector3 min = vertices[0].Position;
+	Vector3 max = vertices[0].Position;
+	for (MemSize i = 1; i < vertices.Num(); ++i)
+	{
+		min = FMath::min(min, vertices[i].Position);
+		max = FMath::max(max, vertices[i].Position);
+	}
+
+	BoxSphereBounds bounds = FromMinMax(min, max);
+
+	// Second pass: farthest vertex from the box center is usually well inside
+	// the box corner for rounded meshes.
+	Float maxDistSq = 0.0f;
+	for (MemSize i = 0; i < vertices.Num(); ++i)
+	{
+		const Vector3 d = vertices[i].Position - bounds.Center;
+		maxDistSq = FMath::max(maxDistSq, FMath::dot(d, d));
+	}
+	bounds.Radius = FMath::sqrt(maxDistSq);
+	return bounds;
+}
+
+BoxSphereBounds BoxSphereBounds::TransformBy(const Mat4& m) const
+{
+	if (!IsValid())
+		return *this;
+
+	BoxSphereBounds result;
+	result.Center = Vector3(m * Vector4(Center, 1.0f));
+
+	const Vector3 axisX(m[0]);
+	const Vector3 axisY(m[1]);
+	const Vector3 axisZ(m[2]);
+	result.Extents = FMath::abs(axisX) * Extents.x +
+	                 FMath::abs(axisY) * Extents.y +
+	                 FMath::abs(axisZ) * Extents.z;
+
+	const Float maxScaleSq = FMath::max(
+		FMath::dot(axisX, axisX),
+		FMath::max(FMath::dot(axisY, axisY), FMath::dot(axisZ, axisZ)));
+	result.Radius = FMath::min(Radius * FMath::sqrt(maxScaleSq), FMath::length(result.Extents));
+	return result;
+}
+
+BoxSphereBounds BoxSphereBounds::Union(const BoxSphereBounds& other) const
+{
+	if (!IsValid())
+		return other;
+	if (!other.IsValid())
+		return *this;
+
+	return FromMinMax(FMath::min(GetMin(), other.GetMin()), FMath::max(GetMax(), other.GetMax()));
+}
+
+namespace SkinnedBounds
+{
+	void BuildBoneBounds(const TArray<Vertex>& vertices, TArray<BoxSphereBounds>& outBoneBounds)
+	{
+		outBoneBounds.Clear();
+
+		TArray<Vector3> mins;
+		TArray<Vector3> maxs;
+		for (MemSize i = 0; i < vertices.Num(); ++i)
+		{
+			const Vertex& v = vertices[i];
+			for (int32 k = 0; k < 4; ++k)
+			{
+				if (v.BoneWeight[k] <= 0.0f)
+					continue;
+
+				const MemSize bone = v.BoneIndex[k];
+				while (mins.Num() <= bone)
+				{
+					mins.Add(Vector3(FLT_MAX));
+					maxs.Add(Vector3(-FLT_MAX));
+				}
+				mins[bone] = FMath::min(mins[bone], v.Position);
+				maxs[bone] = FMath::max(maxs[bone], v.Position);
+			}
+		}
+
+		outBoneBounds.Resize(mins.Num());
+		for (MemSize bone = 0; bone < mins.Num(); ++bone)
+		{
+			if (mins[bone].x <= maxs[bone].x)
+				outBoneBounds[bone] = BoxSphereBounds::FromMinMax(mins[bone], maxs[bone]);
+			else
+				outBoneBounds[bone] = BoxSphereBounds{};
+		}
+	}
+
+	BoxSphereBounds ComputePosedBounds(
+		const TArray<BoxSphereBounds>& boneBounds,
+		const TArray<Mat4>& skinPalette,
+		const BoxSphereBounds& bindBounds)
+	{
+		const MemSize count = FMath::min(boneBounds.Num(), skinPalette.Num());
+		if (count == 0)
+			return bindBounds;
+
+		Vector3 min(FLT_MAX);
+		Vector3 max(-FLT_MAX);
+		for (MemSize bone = 0; bone < count; ++bone)
+		{
+			if (!boneBounds[bone].IsValid())
+				continue;
+
+			const BoxSphereBounds boneBox = boneBounds[bone].TransformBy(skinPalette[bone]);
+			min = FMath::min(min, boneBox.GetMin());
+			max = FMath::max(max, boneBox.GetMax());
+		}
+
+		BoxSphereBounds posed = min.x <= max.x ? BoxSphereBounds::FromMinMax(min, max) : BoxSphereBounds{};
+
+		// Vertices weighted to bones past the end of the palette cannot be
+		// predicted; keep the bind box around them instead.
+		if (boneBounds.Num() > skinPalette.Num())
+			posed = posed.Union(bindBounds);
+
+		return posed.IsValid() ? posed : bindBounds;
+	}
+}
@@ -0,0 +1,138 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Rendering/DrawList.h"
+
+#include <cstring>
+
+namespace
+{
+    constexpr uint32 kPassBits = 4;
+    constexpr uint32 kMaterialBits = 16;
+    constexpr uint32 kMeshBits = 24;
+    constexpr uint32 kDepthBits = 20;
+    STATIC_ASSERT(kPassBits + kMaterialBits + kMeshBits + kDepthBits == 64, "Draw sort key must fill 64 bits");
+
+    constexpr uint32 kDepthShift = 0;
+    constexpr uint32 kMeshShift = kDepthShift + kDepthBits;
+    constexpr uint32 kMaterialShift = kMeshShift + kMeshBits;
+    constexpr uint32 kPassShift = kMaterialShift + kMaterialBits;
+
+    constexpr uint64 Mask(uint32 bits) { return (uint64(1) << bits) - 1; }
+
+    // Non-negative IEEE floats order the same as their bit patterns, so the
+    // top bits of the distance form a logarithmic depth bucket.
+    uint32 DepthBucket(Float distanceSq)
+    {
+        if (!(distanceSq > 0.0f))
+            return 0;
+
+        uint32 bits = 0;
+        std::memcpy(&bits, &distanceSq, sizeof(bits));
+        return bits >> (32 - 1 - kDepthBits); // drop the (zero) sign bit
+    }
+}
+
+uint64 DrawList::MakeSortKey(EDrawPass pass, uint32 materialId, const MeshHandle& mesh, Float distanceSq)
+{
+    // firstIndex identifies the mesh inside the packed index buffer; 24 bits
+    // covers the whole 64 MB buffer of 32-bit indices.
+    return ((uint64(pass) & Mask(kPassBits)) << kPassShift) |
+           ((uint64(materialId) & Mask(kMaterialBits)) << kMaterialShift) |
+           ((uint64(mesh.firstIndex) & Mask(kMeshBits)) << kMeshShift) |
+           ((uint64(DepthBucket(distanceSq)) & Mask(kDepthBits)) << kDepthShift);
+}
+
+void DrawList::Reset(const Vector3& sortOrigin)
+{
+    m_SortOrigin = sortOrigin;
+    m_Transforms.Clear();
+    m_Items.Clear();
+    m_SortedKeys.Clear();
+    m_SortedIndices.Clear();
+}
+
+void DrawList::Reserve(MemSize count)
+{
+    m_Transforms.Reserve(count);
+    m_Items.Reserve(count);
+    m_SortedKeys.Reserve(count);
+    m_SortedIndices.Reserve(count);
+}
+
+void DrawList::Add(const MeshHandle& mesh, const Mat4& model, uint32 materialId, uint32 objectId,
+                   uint32 boneBase, EDrawPass pass)
+{
+    const uint32 index = static_cast<uint32>(m_Items.Num());
+
+    DrawItem item;
+    item.Mesh = mesh;
+    item.MaterialId = materialId;
+    item.ObjectId = objectId;
+    item.BoneBase = boneBase;
+    m_Items.Add(item);
+    m_Transforms.Add(model);
+
+    const Vector3 offset = Vector3(model[3]) - m_SortOrigin;
+    m_SortedKeys.Add(MakeSortKey(pass, materialId, mesh, FMath::dot(offset, offset)));
+    m_SortedIndices.Add(index);
+}
+
+void DrawList::Sort()
+{
+    const MemSize count = m_SortedKeys.Num();
+    if (count < 2)
+        return;
+
+    m_KeyScratch.Resize(count);
+    m_IndexScratch.Resize(count);
+
+    // All eight histograms in one read of the keys.
+    uint32 histograms[8][256];
+    std::memset(histograms, 0, sizeof(histograms));
+    const uint64* keys = m_SortedKeys.Data();
+    for (MemSize i = 0; i < count; ++i)
+    {
+        const uint64 key = keys[i];
+        for (uint32 digit = 0; digit < 8; ++digit)
+            ++histograms[digit][(key >> (digit * 8)) & 0xFF];
+    }
+
+    uint64* srcKeys = m_SortedKeys.Data();
+    uint32* srcIndices = m_SortedIndices.Data();
+    uint64* dstKeys = m_KeyScratch.Data();
+    uint32* dstIndices = m_IndexScratch.Data();
+
+    for (uint32 digit = 0; digit < 8; ++digit)
+    {
+        uint32* histogram = histograms[digit];
+        const uint32 shift = digit * 8;
+
+        // Every key has the same value in this digit: order is unchanged.
+        if (histogram[(srcKeys[0] >> shift) & 0xFF] == count)
+            continue;
+
+        uint32 offset = 0;
+        for (uint32 bucket = 0; bucket < 256; ++bucket)
+        {
+            const uint32 n = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += n;
+        }
+
+        for (MemSize i = 0; i < count; ++i)
+        {
+            const uint32 slot = histogram[(srcKeys[i] >> shift) & 0xFF]++;
+            dstKeys[slot] = srcKeys[i];
+            dstIndices[slot] = srcIndices[i];
+        }
+
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcIndices, dstIndices);
+    }
+
+    // An odd number of scatter passes leaves the result in the scratch arrays.
+    if (srcKeys != m_SortedKeys.Data())
+    {
+        std::swap(m_SortedKeys, m_KeyScratch);
+        std::swap(m_SortedIndices, m_IndexScratch);
+    }
+}
@@ -0,0 +1,151 @@
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Rendering/Frustum.h"
+
+#include "Engine/Rendering/CameraView.h"
+
+#include <emmintrin.h> // SSE2
+
+ViewFrustum::ViewFrustum()
+{
+	for (int32 i = 0; i < kPaddedPlaneCount; ++i)
+	{
+		m_PlaneX[i] = 0.0f;
+		m_PlaneY[i] = 0.0f;
+		m_PlaneZ[i] = 0.0f;
+		m_PlaneW[i] = 1.0f;
+	}
+}
+
+ViewFrustum::ViewFrustum(const Mat4& viewProj)
+	: ViewFrustum()
+{
+	// glm is column-major: row r of the matrix is (m[0][r], m[1][r], m[2][r], m[3][r]).
+	auto row = [&viewProj](int32 r)
+	{
+		return Vector4(viewProj[0][r], viewProj[1][r], viewProj[2][r], viewProj[3][r]);
+	};
+
+	const Vector4 r0 = row(0);
+	const Vector4 r1 = row(1);
+	const Vector4 r2 = row(2);
+	const Vector4 r3 = row(3);
+
+	// Near uses w + z, which is the true near plane for a [-1, 1] depth range
+	// and slightly behind it for [0, 1] - conservative either way.
+	const Vector4 planes[kPlaneCount] =
+	{
+		r3 + r0, // left
+		r3 - r0, // right
+		r3 + r1, // bottom
+		r3 - r1, // top
+		r3 + r2, // near
+		r3 - r2, // far
+	};
+
+	for (int32 i = 0; i < kPlaneCount; ++i)
+	{
+		const Float length = FMath::length(Vector3(planes[i]));
+		const Float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+		m_PlaneX[i] = planes[i].x * invLength;
+		m_PlaneY[i] = planes[i].y * invLength;
+		m_PlaneZ[i] = planes[i].z * invLength;
+		m_PlaneW[i] = length > 0.0f ? planes[i].w * invLength : 1.0f;
+	}
+}
+
+ViewFrustum ViewFrustum::FromCamera(const CameraView& camera)
+{
+	return ViewFrustum(camera.Projection * camera.View);
+}
+
+Bool ViewFrustum::IntersectsSphere(const Vector3& center, Float radius) const
+{
+	const __m128 cx = _mm_set1_ps(center.x);
+	const __m128 cy = _mm_set1_ps(center.y);
+	const __m128 cz = _mm_set1_ps(center.z);
+	const __m128 negRadius = _mm_set1_ps(-radius);
+
+	int outside = 0;
+	for (int32 i = 0; i < kPaddedPlaneCount; i += 4)
+	{
+		__m128 dist = _mm_mul_ps(_mm_load_ps(m_PlaneX + i), cx);
+		dist = _mm_add_ps(dist, _mm_mul_ps(_mm_load_ps(m_PlaneY + i), cy));
+		dist = _mm_add_ps(dist, _mm_mul_ps(_mm_load_ps(m_PlaneZ + i), cz));
+		dist = _mm_add_ps(dist, _mm_load_ps(m_PlaneW + i));
+		outside |= _mm_movemask_ps(_mm_cmplt_ps(dist, negRadius));
+	}
+	return outside == 0;
+}
+
+Bool ViewFrustum::IntersectsBox(const Vector3& center, const Vector3& extents) const
+{
+	const __m128 cx = _mm_set1_ps(center.x);
+	const __m128 cy = _mm_set1_ps(center.y);
+	const __m128 cz = _mm_set1_ps(center.z);
+	const __m128 ex = _mm_set1_ps(extents.x);
+	const __m128 ey = _mm_set1_ps(extents.y);
+	const __m128 ez = _mm_set1_ps(extents.z);
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+	int outside = 0;
+	for (int32 i = 0; i < kPaddedPlaneCount; i += 4)
+	{
+		const __m128 px = _mm_load_ps(m_PlaneX + i);
+		const __m128 py = _mm_load_ps(m_PlaneY + i);
+		const __m128 pz = _mm_load_ps(m_PlaneZ + i);
+
+		__m128 dist = _mm_mul_ps(px, cx);
+		dist = _mm_add_ps(dist, _mm_mul_ps(py, cy));
+		dist = _mm_add_ps(dist, _mm_mul_ps(pz, cz));
+		dist = _mm_add_ps(dist, _mm_load_ps(m_PlaneW + i));
+
+		// Projected half-size of the box onto each plane normal.
+		__m128 reach = _mm_mul_ps(_mm_and_ps(px, absMask), ex);
+		reach = _mm_add_ps(reach, _mm_mul_ps(_mm_and_ps(py, absMask), ey));
+		reach = _mm_add_ps(reach, _mm_mul_ps(_mm_and_ps(pz, absMask), ez));
+
+		outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(dist, reach), _mm_setzero_ps()));
+	}
+	return outside == 0;
+}
+
+Bool ViewFrustum::Intersects(const BoxSphereBounds& worldBounds) const
+{
+	if (!worldBounds.IsValid())
+		return true;
+
+	return IntersectsSphere(worldBounds.Center, worldBounds.Radius) &&
+	       IntersectsBox(worldBounds.Center, worldBounds.Extents);
+}
+
+Bool ViewFrustum::IsVisible(const BoxSphereBounds& localBounds, const Mat4& localToWorld, CullingStats& stats) const
+{
+	if (Intersects(localBounds.TransformBy(localToWorld)))
+	{
+		++stats.Visible;
+		return true;
+	}
+
+	++stats.Culled;
+	return false;
+}
+
+Bool ViewFrustum::IntersectsScalar(const BoxSphereBounds& worldBounds) const
+{
+	if (!worldBounds.IsValid())
+		return true;
+
+	const Vector3& c = worldBounds.Center;
+	const Vector3& e = worldBounds.Extents;
+	for (int32 i = 0; i < kPlaneCount; ++i)
+	{
+		const Float dist = m_PlaneX[i] * c.x + m_PlaneY[i] * c.y + m_PlaneZ[i] * c.z + m_PlaneW[i];
+		if (dist < -worldBounds.Radius)
+			return false;
+
+		const Float reach = FMath::abs(m_PlaneX[i]) * e.x + FMath::abs(m_PlaneY[i]) * e.y + FMath::abs(m_PlaneZ[i]) * e.z;
+		if (dist + reach < 0.0f)
+			return false;
+	}
+	return true;
+}
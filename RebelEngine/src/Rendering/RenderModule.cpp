@@ -416,7 +416,12 @@ void RenderModule::InitPreviewTargets(uint32 width, uint32 height)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-void RenderModule::CollectSceneDraws(Scene& scene, OpenGLRenderAPI* ogl, AssetManager& assetManager)
+void RenderModule::CollectSceneDraws(
+    Scene& scene,
+    OpenGLRenderAPI* ogl,
+    AssetManager& assetManager,
+    const ViewFrustum& frustum,
+    CullingStats& stats)
 {
     auto& reg = scene.GetRegistry();
     auto view = reg.view<StaticMeshComponent*>();
@@ -429,46 +434,47 @@ void RenderModule::CollectSceneDraws(Scene& scene, OpenGLRenderAPI* ogl, AssetMa
             continue;
 
         SkeletalMeshAsset* skAsset =
-            dynamic_cast<SkeletalMeshAsset*>(assetManager.Load(skComp->Mesh.GetHandle()));
+            dynamic_cast<SkeletalMeshAsset*>(assetManager.GetOrLoadAsync(skComp->Mesh.GetHandle(), EAssetLoadPriority::High));
         if (!skAsset)
             continue;
 
         if (!skAsset->Handle.isValid())
             skAsset->Handle = ogl->AddStaticMesh(skAsset->Vertices, skAsset->Indices);
 
-        Mat4 model = skComp->GetWorldTransform();
+        Mat4 model = skComp->GetRenderTransform();
         const uint32 objectId = skComp->GetECSHandle() != entt::null ? ((uint32)skComp->GetECSHandle() + 1u) : 0u;
 
         if (skComp->bDrawSkeleton)
         {
             SkeletonAsset* skeleton =
-                dynamic_cast<SkeletonAsset*>(assetManager.Load(skAsset->m_Skeleton.GetHandle()));
+                dynamic_cast<SkeletonAsset*>(assetManager.GetOrLoadAsync(skAsset->m_Skeleton.GetHandle(), EAssetLoadPriority::High));
             if (skeleton && !skComp->GlobalPose.IsEmpty())
                 RenderSkeletalDebug(skeleton, model, skComp->GlobalPose);
         }
 
-        TArray<Mat4> previewSkinPalette;
         const TArray<Mat4>* skinPalette = &skComp->FinalPalette;
         if (skComp->FinalPalette.IsEmpty())
         {
+            // Not animated yet: draw the cached bind pose of the skeleton.
             SkeletonAsset* skeleton =
-                dynamic_cast<SkeletonAsset*>(assetManager.Load(skAsset->m_Skeleton.GetHandle()));
-            TArray<Mat4> localBindPose;
-            TArray<Mat4> globalBindPose;
-            if (skeleton &&
-                AnimationRuntime::BuildBindPoses(skeleton, localBindPose, globalBindPose) &&
-                AnimationRuntime::BuildSkinPalette(skeleton, globalBindPose, previewSkinPalette))
+                dynamic_cast<SkeletonAsset*>(assetManager.GetOrLoadAsync(skAsset->m_Skeleton.GetHandle(), EAssetLoadPriority::High));
+            if (skeleton && (skeleton->HasBindPoseCache() || skeleton->BuildBindPoseCache()))
             {
-                skinPalette = &previewSkinPalette;
+                skinPalette = &skeleton->GetBindSkinPalette();
 
                 if (skComp->bDrawSkeleton)
-                    RenderSkeletalDebug(skeleton, model, globalBindPose);
+                    RenderSkeletalDebug(skeleton, model, skeleton->GetGlobalBindPose());
             }
         }
 
         if (!skinPalette || skinPalette->IsEmpty())
             continue;
 
+        const BoxSphereBounds posedBounds =
+            SkinnedBounds::ComputePosedBounds(skAsset->BoneBounds, *skinPalette, skAsset->Bounds);
+        if (!frustum.IsVisible(posedBounds, model, stats))
+            continue;
+
         const uint32 boneBase = static_cast<uint32>(m_FrameBoneData.size());
         for (int32 i = 0; i < skinPalette->Num(); ++i)
             m_FrameBoneData.push_back((*skinPalette)[i]);
@@ -485,15 +491,19 @@ void RenderModule::CollectSceneDraws(Scene& scene, OpenGLRenderAPI* ogl, AssetMa
         if ((uint64)mc->Mesh.GetHandle() == 0)
             continue;
 
-        MeshAsset* mesh = dynamic_cast<MeshAsset*>(assetManager.Load(mc->Mesh.GetHandle()));
+        MeshAsset* mesh = dynamic_cast<MeshAsset*>(assetManager.GetOrLoadAsync(mc->Mesh.GetHandle(), EAssetLoadPriority::High));
         if (!mesh)
             continue;
 
         if (!mesh->Handle.isValid())
             mesh->Handle = ogl->AddStaticMesh(mesh->Vertices, mesh->Indices);
 
+        const Mat4 model = mc->GetRenderTransform();
+        if (!frustum.IsVisible(mesh->Bounds, model, stats))
+            continue;
+
         const uint32 objectId = mc->GetECSHandle() != entt::null ? ((uint32)mc->GetECSHandle() + 1u) : 0u;
-        ogl->SubmitDraw(mesh->Handle, mc->GetWorldTransform(), mc->Material.Id, objectId, 0);
+        ogl->SubmitDraw(mesh->Handle, model, mc->Material.Id, objectId, 0);
     }
 }
 
@@ -827,14 +837,17 @@ void RenderModule::Tick(float dt) {
 
     {
         //PROFILE_SCOPE("BeginRenderFrame")
-        ogl->BeginFrame();
+        ogl->BeginFrame(camera.Position);
 
         // index 0 is reserved identity bone for non-skinned draws
         m_FrameBoneData.clear();
         m_FrameBoneData.emplace_back(1.0f);
         m_FrameBoneBase.clear();
+        m_CullingStats.Reset();
     }
 
+    const ViewFrustum frustum = ViewFrustum::FromCamera(camera);
+
     {
         //PROFILE_SCOPE("RenderLoop")
         
@@ -857,7 +870,7 @@ void RenderModule::Tick(float dt) {
 
             // Load skeletal mesh asset
             SkeletalMeshAsset* skAsset =
-                dynamic_cast<SkeletalMeshAsset*>(assetManager.Load(skComp->Mesh.GetHandle()));
+                dynamic_cast<SkeletalMeshAsset*>(assetManager.GetOrLoadAsync(skComp->Mesh.GetHandle(), EAssetLoadPriority::High));
 
             if (!skAsset)
                 continue;
@@ -868,7 +881,7 @@ void RenderModule::Tick(float dt) {
                 skAsset->Handle = ogl->AddStaticMesh(skAsset->Vertices, skAsset->Indices);
             }
 
-            Mat4 model = skComp->GetWorldTransform();
+            Mat4 model = skComp->GetRenderTransform();
 
             const uint32 objectId =
                 skComp->GetECSHandle() != entt::null ? ((uint32)skComp->GetECSHandle() + 1u) : 0u;
@@ -876,7 +889,7 @@ void RenderModule::Tick(float dt) {
             if (skComp->bDrawSkeleton)
             {
                 SkeletonAsset* skeleton =
-                    dynamic_cast<SkeletonAsset*>(assetManager.Load(skAsset->m_Skeleton.GetHandle()));
+                    dynamic_cast<SkeletonAsset*>(assetManager.GetOrLoadAsync(skAsset->m_Skeleton.GetHandle(), EAssetLoadPriority::High));
                 if (skeleton && !skComp->GlobalPose.IsEmpty())
                     RenderSkeletalDebug(skeleton, model, skComp->GlobalPose);
             }
@@ -884,6 +897,11 @@ void RenderModule::Tick(float dt) {
             if (skComp->FinalPalette.IsEmpty())
                 continue;
 
+            const BoxSphereBounds posedBounds =
+                SkinnedBounds::ComputePosedBounds(skAsset->BoneBounds, skComp->FinalPalette, skAsset->Bounds);
+            if (!frustum.IsVisible(posedBounds, model, m_CullingStats))
+                continue;
+
             const uint32 boneBase = static_cast<uint32>(m_FrameBoneData.size());
             for (int32 i = 0; i < skComp->FinalPalette.Num(); ++i)
                 m_FrameBoneData.push_back(skComp->FinalPalette[i]);
@@ -902,7 +920,7 @@ void RenderModule::Tick(float dt) {
                 continue;
 
             
-            Mat4 model = mc->GetWorldTransform();
+            Mat4 model = mc->GetRenderTransform();
             const uint32 objectId = mc->GetECSHandle() != entt::null ? ((uint32)mc->GetECSHandle() + 1u) : 0u;
 
 
@@ -911,7 +929,7 @@ void RenderModule::Tick(float dt) {
                continue;
             }
             MeshAsset* mesh;
-            mesh = dynamic_cast<MeshAsset*>(assetManager.Load(mc->Mesh.GetHandle()));
+            mesh = dynamic_cast<MeshAsset*>(assetManager.GetOrLoadAsync(mc->Mesh.GetHandle(), EAssetLoadPriority::High));
             if (mesh)
             {
                 auto handle = mesh->Handle;
@@ -925,6 +943,10 @@ void RenderModule::Tick(float dt) {
             {
                 continue;
             }
+
+            if (!frustum.IsVisible(mesh->Bounds, model, m_CullingStats))
+                continue;
+
             ogl->SubmitDraw(mesh->Handle, model, mc->Material.Id, objectId, 0);
         }
 
@@ -1076,12 +1098,14 @@ void RenderModule::RenderScenePreview(
     glUniform3fv(m_uGroundColorLoc, 1, &m_SkyAmbient.GroundColor[0]);
     glUniform1f(m_uAmbientIntensityLoc, FMath::max(m_SkyAmbient.Intensity, 0.0f));
 
-    ogl->BeginFrame();
+    ogl->BeginFrame(camera.Position);
     m_FrameBoneData.clear();
     m_FrameBoneData.emplace_back(1.0f);
     m_FrameBoneBase.clear();
 
-    CollectSceneDraws(scene, ogl, assetModule->GetManager());
+    // Preview counts are throwaway; GetCullingStats() reports the main viewport.
+    CullingStats previewStats;
+    CollectSceneDraws(scene, ogl, assetModule->GetManager(), ViewFrustum::FromCamera(camera), previewStats);
 
     glBindFramebuffer(GL_FRAMEBUFFER, m_PreviewFBO);
     glViewport(0, 0, (GLsizei)width, (GLsizei)height);
@@ -244,8 +244,9 @@ void Actor::SetRootComponent(SceneComponent* newRoot)
 
 	if (m_RootComponent)
 	{
-		m_RootComponent->m_Parent = nullptr;
+		m_RootComponent->SetParentInternal(nullptr);
 		m_RootComponent->m_SceneRegistry = (m_Scene ? &m_Scene->GetRegistry() : nullptr);
+		m_RootComponent->BindTransformHierarchy(m_Scene ? &m_Scene->GetTransformHierarchy() : nullptr);
 	}
 }
 
@@ -324,8 +325,11 @@ void Actor::RegisterPrimitivePointerIfNeeded(EntityComponent* component)
     if (!primitive)
         return;
 
-    if (!registry->all_of<PrimitiveComponent*>(component->GetECSHandle()))
-        registry->emplace<PrimitiveComponent*>(component->GetECSHandle(), primitive);
+    if (registry->all_of<PrimitiveComponent*>(component->GetECSHandle()))
+        return;
+
+    registry->emplace<PrimitiveComponent*>(component->GetECSHandle(), primitive);
+    m_Scene->QueuePhysicsBodyCreation(component->GetECSHandle());
 }
 
 void Actor::HandleSceneComponentAdded(EntityComponent* component)
@@ -342,8 +346,9 @@ void Actor::HandleSceneComponentAdded(EntityComponent* component)
 
     if (sceneComponent != m_RootComponent)
     {
-        sceneComponent->m_Parent = m_RootComponent;
+        sceneComponent->SetParentInternal(m_RootComponent);
         sceneComponent->m_SceneRegistry = TryGetSceneRegistry();
+        sceneComponent->BindTransformHierarchy(m_Scene ? &m_Scene->GetTransformHierarchy() : nullptr);
     }
 }
 
@@ -134,6 +134,12 @@ void Scene::DestroyActor(Actor* actor)
     m_PendingDestroyActors.Emplace(actor);
 }
 
+void Scene::QueuePhysicsBodyCreation(entt::entity primitiveEntity)
+{
+    if (primitiveEntity != entt::null)
+        m_PendingPhysicsBodies.Add(primitiveEntity);
+}
+
 void Scene::FlushPendingActorDestroy()
 {
     for (Actor* actor : m_PendingDestroyActors)
@@ -241,6 +247,9 @@ void Scene::TickGroup(ActorTickGroup group, float dt)
         actor->Tick(dt);
         actor->TickComponents(dt);
     }
+
+    if (m_World)
+        m_World->FlushCharacterMovement();
 }
 
 void Scene::FinalizeTick()
@@ -280,28 +289,9 @@ void Scene::FinalizeTick()
 
 void Scene::UpdateTransforms()
 {
-    auto& reg = m_Registry;
-    auto view = reg.view<SceneComponent*>();
-
-    // First: update all roots (no parent)
-    for (auto entity : view)
-    {
-        // Root: parentWorld = identity
-        UpdateTransform(entity);
-        
-    }
-}
-
-void Scene::UpdateTransform(entt::entity entity)
-{
-    auto& reg = m_Registry;
-    auto& sc  = reg.get<SceneComponent*>(entity);
-
-    // Build local from Position / RotationQuat / Scale
-    Mat4 local = sc->GetLocalTransform();
-
-    // World = ParentWorld * Local
-    //sc->m_WorldTransform = local;
+    // Re-sorts by depth after structural changes, then resolves dirty entries
+    // one depth level at a time (large levels fan out to the JobSystem).
+    m_Transforms.Update();
 }
 
 
@@ -368,6 +358,7 @@ void Scene::Clear()
     m_PrePhysicsTickActors.Clear();
     m_PostPhysicsTickActors.Clear();
     m_PostUpdateTickActors.Clear();
+    m_PendingPhysicsBodies.Clear();
     m_bHasBegunPlay = false;
 
     m_Registry.clear();
@@ -0,0 +1,350 @@
+// TransformHierarchy.cpp
+#include "Engine/Framework/EnginePch.h"
+#include "Engine/Scene/TransformHierarchy.h"
+
+#include "Core/MultiThreading/JobSystem.h"
+
+// ---------- Entries ----------
+
+uint32 TransformHierarchy::Add(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+{
+	uint32 id = 0;
+	if (!m_FreeIds.IsEmpty())
+	{
+		id = m_FreeIds.Back();
+		m_FreeIds.PopBack();
+	}
+	else
+	{
+		id = static_cast<uint32>(m_DenseIndex.Num());
+		m_DenseIndex.Add(kInvalidId);
+		m_FirstChild.Add(kInvalidId);
+		m_NextSibling.Add(kInvalidId);
+		m_PrevSibling.Add(kInvalidId);
+	}
+
+	const uint32 dense = InsertIntoLevel(0);
+	m_LocalPosition[dense] = position;
+	m_LocalRotation[dense] = rotation;
+	m_LocalScale[dense] = scale;
+	m_WorldMatrix[dense] = Mat4(1.0f);
+	m_WorldPosition[dense] = position;
+	m_WorldRotation[dense] = rotation;
+	m_WorldScale[dense] = scale;
+	m_ParentId[dense] = kInvalidId;
+	m_Depth[dense] = 0;
+	m_Dirty[dense] = 1;
+	m_Ids[dense] = id;
+
+	m_DenseIndex[id] = dense;
+	m_FirstChild[id] = kInvalidId;
+	m_NextSibling[id] = kInvalidId;
+	m_PrevSibling[id] = kInvalidId;
+	return id;
+}
+
+void TransformHierarchy::Remove(uint32 id)
+{
+	while (m_FirstChild[id] != kInvalidId)
+	{
+		const uint32 child = m_FirstChild[id];
+		SetParent(child, kInvalidId);
+		MarkSubtreeDirty(child);
+	}
+
+	UnlinkChild(id);
+	RemoveFromLevel(m_DenseIndex[id]);
+
+	m_DenseIndex[id] = kInvalidId;
+	m_FreeIds.Add(id);
+}
+
+void TransformHierarchy::SetParent(uint32 id, uint32 parentId)
+{
+	if (m_ParentId[m_DenseIndex[id]] == parentId)
+		return;
+
+	// Dirty flags are left to the caller, which owns the child lists needed to
+	// invalidate the whole subtree.
+	const int32 oldDepth = static_cast<int32>(GetDepth(id));
+	UnlinkChild(id);
+	LinkChild(id, parentId);
+
+	const int32 newDepth = parentId == kInvalidId ? 0 : static_cast<int32>(GetDepth(parentId)) + 1;
+	const int32 delta = newDepth - oldDepth;
+	if (delta == 0)
+		return;
+
+	// Parents are visited before their children, so every entry lands one
+	// level below an already re-levelled parent.
+	TArray<uint32> pending;
+	pending.Add(id);
+	for (MemSize i = 0; i < pending.Num(); ++i)
+	{
+		const uint32 current = pending[i];
+		for (uint32 child = m_FirstChild[current]; child != kInvalidId; child = m_NextSibling[child])
+			pending.Add(child);
+
+		SetDepth(current, static_cast<uint32>(static_cast<int32>(GetDepth(current)) + delta));
+	}
+}
+
+void TransformHierarchy::SetLocal(uint32 id, const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+{
+	const uint32 dense = m_DenseIndex[id];
+	m_LocalPosition[dense] = position;
+	m_LocalRotation[dense] = rotation;
+	m_LocalScale[dense] = scale;
+}
+
+// ---------- World queries ----------
+
+Mat4 TransformHierarchy::GetWorldMatrix(uint32 id) const
+{
+	const uint32 dense = m_DenseIndex[id];
+	return m_Dirty[dense] ? EvaluateWorld(dense).Matrix : m_WorldMatrix[dense];
+}
+
+Vector3 TransformHierarchy::GetWorldPosition(uint32 id) const
+{
+	const uint32 dense = m_DenseIndex[id];
+	return m_Dirty[dense] ? EvaluateWorld(dense).Position : m_WorldPosition[dense];
+}
+
+Quaternion TransformHierarchy::GetWorldRotation(uint32 id) const
+{
+	const uint32 dense = m_DenseIndex[id];
+	return m_Dirty[dense] ? EvaluateWorld(dense).Rotation : m_WorldRotation[dense];
+}
+
+Vector3 TransformHierarchy::GetWorldScale(uint32 id) const
+{
+	const uint32 dense = m_DenseIndex[id];
+	return m_Dirty[dense] ? EvaluateWorld(dense).Scale : m_WorldScale[dense];
+}
+
+// ---------- Update ----------
+
+void TransformHierarchy::Update()
+{
+	const uint32 levelCount = GetLevelCount();
+	for (uint32 level = 0; level < levelCount; ++level)
+	{
+		const uint32 begin = m_LevelStart[level];
+		const uint32 end = m_LevelStart[level + 1];
+		const MemSize count = end - begin;
+
+		if (count < kParallelLevelThreshold)
+		{
+			ResolveLevel(begin, end);
+			continue;
+		}
+
+		// Entries of one level only read their parents (previous level, already
+		// resolved) and write their own slot, so chunks are independent.
+		Rebel::Core::Threading::JobSystem::Get().ParallelFor(count, kParallelGrain,
+			[this, begin](MemSize chunkBegin, MemSize chunkEnd)
+			{
+				ResolveLevel(begin + static_cast<uint32>(chunkBegin), begin + static_cast<uint32>(chunkEnd));
+			});
+	}
+}
+
+void TransformHierarchy::ResolveLevel(uint32 begin, uint32 end)
+{
+	for (uint32 i = begin; i < end; ++i)
+	{
+		if (m_Dirty[i])
+			ComputeWorld(i);
+	}
+}
+
+void TransformHierarchy::ComputeWorld(uint32 index)
+{
+	const WorldValues world = EvaluateWorld(index);
+	m_WorldMatrix[index] = world.Matrix;
+	m_WorldPosition[index] = world.Position;
+	m_WorldRotation[index] = world.Rotation;
+	m_WorldScale[index] = world.Scale;
+	m_Dirty[index] = 0;
+}
+
+TransformHierarchy::WorldValues TransformHierarchy::EvaluateWorld(uint32 index) const
+{
+	if (!m_Dirty[index])
+		return { m_WorldMatrix[index], m_WorldPosition[index], m_WorldRotation[index], m_WorldScale[index] };
+
+	const Vector3& position = m_LocalPosition[index];
+	const Quaternion& rotation = m_LocalRotation[index];
+	const Vector3& scale = m_LocalScale[index];
+
+	// T * R * S without the two intermediate matrix products.
+	Mat4 local = glm::mat4_cast(rotation);
+	local[0] *= scale.x;
+	local[1] *= scale.y;
+	local[2] *= scale.z;
+	local[3] = glm::vec4(position, 1.0f);
+
+	const uint32 parentId = m_ParentId[index];
+	if (parentId == kInvalidId)
+		return { local, position, rotation, scale };
+
+	// Clean parents return their cached values, so this only recurses through
+	// the dirty part of the chain.
+	const WorldValues parent = EvaluateWorld(m_DenseIndex[parentId]);
+	return {
+		parent.Matrix * local,
+		parent.Position + parent.Rotation * (parent.Scale * position),
+		parent.Rotation * rotation,
+		parent.Scale * scale
+	};
+}
+
+// ---------- Levels ----------
+
+// Grows the arrays by one and walks the hole from the end down to the last
+// slot of `depth`, moving the first entry of each deeper level to its end.
+uint32 TransformHierarchy::InsertIntoLevel(uint32 depth)
+{
+	if (m_LevelStart.IsEmpty())
+		m_LevelStart.Add(0);
+	while (GetLevelCount() <= depth)
+	{
+		const uint32 end = m_LevelStart.Back();
+		m_LevelStart.Add(end);
+	}
+
+	m_LocalPosition.Emplace();
+	m_LocalRotation.Emplace();
+	m_LocalScale.Emplace();
+	m_WorldMatrix.Emplace();
+	m_WorldPosition.Emplace();
+	m_WorldRotation.Emplace();
+	m_WorldScale.Emplace();
+	m_ParentId.Add(kInvalidId);
+	m_Depth.Add(0);
+	m_Dirty.Add(0);
+	m_Ids.Add(kInvalidId);
+
+	uint32 hole = Num() - 1;
+	++m_LevelStart.Back();
+	for (uint32 level = GetLevelCount() - 1; level > depth; --level)
+	{
+		const uint32 first = m_LevelStart[level];
+		if (first != hole)
+			MoveEntry(first, hole);
+		hole = first;
+		++m_LevelStart[level];
+	}
+	return hole;
+}
+
+// Mirror of InsertIntoLevel: the last entry of each level from the removed
+// one's depth down fills the hole, which ends up at the back and is dropped.
+void TransformHierarchy::RemoveFromLevel(uint32 index)
+{
+	const uint32 levelCount = GetLevelCount();
+	uint32 hole = index;
+	for (uint32 level = m_Depth[index]; level < levelCount; ++level)
+	{
+		const uint32 last = m_LevelStart[level + 1] - 1;
+		if (last != hole)
+			MoveEntry(last, hole);
+		hole = last;
+		--m_LevelStart[level + 1];
+	}
+
+	m_LocalPosition.PopBack();
+	m_LocalRotation.PopBack();
+	m_LocalScale.PopBack();
+	m_WorldMatrix.PopBack();
+	m_WorldPosition.PopBack();
+	m_WorldRotation.PopBack();
+	m_WorldScale.PopBack();
+	m_ParentId.PopBack();
+	m_Depth.PopBack();
+	m_Dirty.PopBack();
+	m_Ids.PopBack();
+
+	while (m_LevelStart.Num() > 1 && m_LevelStart[m_LevelStart.Num() - 2] == m_LevelStart.Back())
+		m_LevelStart.PopBack();
+}
+
+void TransformHierarchy::MoveEntry(uint32 from, uint32 to)
+{
+	m_LocalPosition[to] = m_LocalPosition[from];
+	m_LocalRotation[to] = m_LocalRotation[from];
+	m_LocalScale[to] = m_LocalScale[from];
+	m_WorldMatrix[to] = m_WorldMatrix[from];
+	m_WorldPosition[to] = m_WorldPosition[from];
+	m_WorldRotation[to] = m_WorldRotation[from];
+	m_WorldScale[to] = m_WorldScale[from];
+	m_ParentId[to] = m_ParentId[from];
+	m_Depth[to] = m_Depth[from];
+	m_Dirty[to] = m_Dirty[from];
+	m_Ids[to] = m_Ids[from];
+
+	m_DenseIndex[m_Ids[to]] = to;
+}
+
+void TransformHierarchy::SetDepth(uint32 id, uint32 depth)
+{
+	// Open the new slot first; the insert may shift the entry itself, so read
+	// its index afterwards. The stale copy is then removed from its old level.
+	const uint32 to = InsertIntoLevel(depth);
+	const uint32 from = m_DenseIndex[id];
+	MoveEntry(from, to);
+	m_Depth[to] = static_cast<uint16>(depth);
+	RemoveFromLevel(from);
+}
+
+// ---------- Child lists ----------
+
+void TransformHierarchy::LinkChild(uint32 id, uint32 parentId)
+{
+	m_ParentId[m_DenseIndex[id]] = parentId;
+	if (parentId == kInvalidId)
+		return;
+
+	const uint32 next = m_FirstChild[parentId];
+	m_NextSibling[id] = next;
+	m_PrevSibling[id] = kInvalidId;
+	if (next != kInvalidId)
+		m_PrevSibling[next] = id;
+	m_FirstChild[parentId] = id;
+}
+
+void TransformHierarchy::UnlinkChild(uint32 id)
+{
+	const uint32 dense = m_DenseIndex[id];
+	const uint32 parentId = m_ParentId[dense];
+	if (parentId == kInvalidId)
+		return;
+
+	const uint32 prev = m_PrevSibling[id];
+	const uint32 next = m_NextSibling[id];
+	if (prev != kInvalidId)
+		m_NextSibling[prev] = next;
+	else
+		m_FirstChild[parentId] = next;
+	if (next != kInvalidId)
+		m_PrevSibling[next] = prev;
+
+	m_ParentId[dense] = kInvalidId;
+	m_PrevSibling[id] = kInvalidId;
+	m_NextSibling[id] = kInvalidId;
+}
+
+void TransformHierarchy::MarkSubtreeDirty(uint32 id)
+{
+	TArray<uint32> pending;
+	pending.Add(id);
+	while (!pending.IsEmpty())
+	{
+		const uint32 current = pending.Back();
+		pending.PopBack();
+		MarkDirty(current);
+		for (uint32 child = m_FirstChild[current]; child != kInvalidId; child = m_NextSibling[child])
+			pending.Add(child);
+	}
+}
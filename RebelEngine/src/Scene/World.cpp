@@ -1,6 +1,7 @@
 ﻿#include "Engine/Framework/EnginePch.h"
 #include "Engine/Scene/World.h"
 
+#include "Engine/Gameplay/Framework/CharacterMovementComponent.h"
 #include "Engine/Gameplay/Framework/GameMode.h"
 #include "Engine/Framework/BaseEngine.h"
 #include "Engine/Framework/ModuleManager.h"
@@ -8,8 +9,15 @@
 #include "Engine/Physics/PhysicsSystem.h"
 #include "Engine/Gameplay/Framework/PlayerController.h"
 #include "Engine/Scene/Scene.h"
+#include "Core/MultiThreading/JobSystem.h"
 #include <algorithm>
 
+namespace
+{
+    // Queued characters handed to one job at a time; each runs a few dozen traces.
+    constexpr MemSize kCharacterMovementGrain = 4;
+}
+
 World::World(Scene* scene, ModuleManager* moduleManager)
     : m_Scene(scene)
     , m_ModuleManager(moduleManager)
@@ -85,6 +93,33 @@ void World::Tick(float dt, bool bIsPlaying, uint64 frameId)
     TickTimers(dt);
 }
 
+void World::QueueCharacterMovement(CharacterMovementComponent& movement)
+{
+    m_QueuedCharacterMovement.push_back(&movement);
+}
+
+void World::FlushCharacterMovement()
+{
+    if (m_QueuedCharacterMovement.empty())
+        return;
+
+    // Physics does not step during a tick group, so every job traces against
+    // the same state. A job touches only its own component: it reads shared
+    // actors and assets, and keeps the pose it moves local until the write-back.
+    CharacterMovementComponent* const* queued = m_QueuedCharacterMovement.data();
+    Rebel::Core::Threading::JobSystem::Get().ParallelFor(m_QueuedCharacterMovement.size(), kCharacterMovementGrain,
+        [queued](const MemSize begin, const MemSize end)
+        {
+            for (MemSize i = begin; i < end; ++i)
+                queued[i]->SimulateQueuedMovement();
+        });
+
+    for (CharacterMovementComponent* movement : m_QueuedCharacterMovement)
+        movement->ApplyQueuedMovement();
+
+    m_QueuedCharacterMovement.clear();
+}
+
 void World::SetTimer(TimerHandle& handle, std::function<void()> callback, const float intervalSeconds, const bool bLooping)
 {
     if (intervalSeconds <= 0.0f || !callback)
@@ -275,4 +310,65 @@ bool World::BoxTraceSingle(const Vector3& start, const Vector3& end, const Vecto
     return physics->BoxTraceSingle(start, end, halfExtents, rotation, outHit, params);
 }
 
+uint32 World::RunSceneQueries(const SceneQuery* queries, SceneQueryResult* outResults, uint32 count) const
+{
+    PhysicsSystem* physics = TryGetPhysics();
+    if (!physics)
+    {
+        for (uint32 i = 0; i < count; ++i)
+            outResults[i] = {};
+        return 0;
+    }
+
+    return physics->RunSceneQueries(queries, outResults, count);
+}
+
+bool World::OverlapSphereMulti(const Vector3& center, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+    PhysicsSystem* physics = TryGetPhysics();
+    if (!physics)
+    {
+        outEntities.clear();
+        return false;
+    }
+
+    return physics->OverlapSphereMulti(center, radius, outEntities, params);
+}
+
+bool World::OverlapCapsuleMulti(const Vector3& center, float halfHeight, float radius, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+    PhysicsSystem* physics = TryGetPhysics();
+    if (!physics)
+    {
+        outEntities.clear();
+        return false;
+    }
+
+    return physics->OverlapCapsuleMulti(center, halfHeight, radius, outEntities, params);
+}
+
+bool World::OverlapBoxMulti(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+    PhysicsSystem* physics = TryGetPhysics();
+    if (!physics)
+    {
+        outEntities.clear();
+        return false;
+    }
+
+    return physics->OverlapBoxMulti(center, halfExtents, rotation, outEntities, params);
+}
+
+bool World::QueryAABB(const Vector3& min, const Vector3& max, std::vector<EntityID>& outEntities, const TraceQueryParams& params) const
+{
+    PhysicsSystem* physics = TryGetPhysics();
+    if (!physics)
+    {
+        outEntities.clear();
+        return false;
+    }
+
+    return physics->QueryAABB(min, max, outEntities, params);
+}
+
 
@@ -0,0 +1,130 @@
+#include "catch_amalgamated.hpp"
+#include "Core/MultiThreading/JobSystem.h"
+
+#include <atomic>
+#include <vector>
+
+using Rebel::Core::Threading::JobCounter;
+using Rebel::Core::Threading::JobSystem;
+
+TEST_CASE("JobSystem runs every scheduled job before Wait returns", "[core][threading][jobs]")
+{
+    JobSystem jobs(4);
+    constexpr int32 jobCount = 10000;
+
+    std::atomic<int32> executed{0};
+    JobCounter counter;
+    for (int32 i = 0; i < jobCount; ++i)
+    {
+        jobs.Schedule([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+
+    jobs.Wait(counter);
+
+    REQUIRE(counter.IsDone());
+    REQUIRE(executed.load() == jobCount);
+}
+
+TEST_CASE("JobSystem jobs can schedule nested jobs on the same counter", "[core][threading][jobs]")
+{
+    JobSystem jobs(3);
+    constexpr int32 parentCount = 64;
+    constexpr int32 childrenPerParent = 32;
+
+    std::atomic<int32> executed{0};
+    JobCounter counter;
+    for (int32 i = 0; i < parentCount; ++i)
+    {
+        jobs.Schedule([&jobs, &executed, &counter]()
+        {
+            for (int32 child = 0; child < childrenPerParent; ++child)
+            {
+                jobs.Schedule([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+        }, &counter);
+    }
+
+    jobs.Wait(counter);
+
+    REQUIRE(executed.load() == parentCount * childrenPerParent);
+}
+
+TEST_CASE("JobSystem ParallelFor visits every index exactly once", "[core][threading][jobs][parallelfor]")
+{
+    JobSystem jobs(4);
+    constexpr MemSize count = 100003;
+
+    std::vector<int32> visits(count, 0);
+    jobs.ParallelFor(count, 1024, [&visits](MemSize begin, MemSize end)
+    {
+        for (MemSize i = begin; i < end; ++i)
+            ++visits[i];
+    });
+
+    bool bAllVisitedOnce = true;
+    for (MemSize i = 0; i < count; ++i)
+    {
+        if (visits[i] != 1)
+        {
+            bAllVisitedOnce = false;
+            break;
+        }
+    }
+
+    REQUIRE(bAllVisitedOnce);
+}
+
+TEST_CASE("JobSystem accepts jobs from threads it does not own", "[core][threading][jobs]")
+{
+    JobSystem jobs(2);
+    std::atomic<int32> executed{0};
+    JobCounter counter;
+
+    std::thread producer([&]()
+    {
+        for (int32 i = 0; i < 512; ++i)
+            jobs.Schedule([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+
+        jobs.Wait(counter);
+    });
+    producer.join();
+
+    REQUIRE(executed.load() == 512);
+}
+
+TEST_CASE("JobSystem tracks thread ownership per instance", "[core][threading][jobs]")
+{
+    JobSystem first(2);
+    JobSystem second(2);
+
+    // The constructing thread owns context 0 of both systems.
+    REQUIRE(first.GetCurrentThreadIndex() == 0);
+    REQUIRE(second.GetCurrentThreadIndex() == 0);
+
+    // A worker of one system is foreign to the other, and entering the other
+    // system does not change which one it belongs to.
+    std::atomic<int32> mismatches{0};
+    JobCounter outer;
+    for (int32 i = 0; i < 64; ++i)
+    {
+        first.Schedule([&]()
+        {
+            const int32 firstIndex = first.GetCurrentThreadIndex();
+            if (firstIndex < 0)
+                mismatches.fetch_add(1, std::memory_order_relaxed);
+
+            JobCounter inner;
+            second.Schedule([]() {}, &inner);
+            second.Wait(inner);
+
+            if (first.GetCurrentThreadIndex() != firstIndex)
+                mismatches.fetch_add(1, std::memory_order_relaxed);
+            if (firstIndex > 0 && second.GetCurrentThreadIndex() != -1)
+                mismatches.fetch_add(1, std::memory_order_relaxed);
+        }, &outer);
+    }
+    first.Wait(outer);
+
+    REQUIRE(mismatches.load() == 0);
+    REQUIRE(first.GetCurrentThreadIndex() == 0);
+}
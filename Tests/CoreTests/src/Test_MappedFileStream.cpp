@@ -0,0 +1,109 @@
+#include "catch_amalgamated.hpp"
+#include "Core/Core.h"
+
+#include <filesystem>
+
+namespace
+{
+    struct TestVertex
+    {
+        float Position[3];
+        uint32 Color;
+    };
+
+    std::filesystem::path WriteTestFile(const char* name, const TArray<TestVertex>& vertices, const String& label)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+
+        FileStream fs(path.string().c_str(), "wb");
+        BinaryWriter ar(fs);
+        const uint32 header = 0xC0FFEEu;
+        ar << header;
+        ar << vertices;
+        ar << label;
+        return path;
+    }
+
+    TArray<TestVertex> MakeVertices(uint32 count)
+    {
+        TArray<TestVertex> vertices;
+        for (uint32 i = 0; i < count; ++i)
+            vertices.Add({ { float(i), float(i) * 2.0f, float(i) * 3.0f }, i * 7u });
+        return vertices;
+    }
+}
+
+TEST_CASE("MappedFileStream reads what FileStream wrote", "[core][serialization][mapped]")
+{
+    const TArray<TestVertex> source = MakeVertices(1000);
+    const String label("a label longer than the small string buffer");
+    const std::filesystem::path path = WriteTestFile("rebel_mapped_copy.bin", source, label);
+
+    {
+        MappedFileStream fs(path.string().c_str());
+        REQUIRE(fs.IsOpen());
+
+        BinaryReader ar(fs);
+        uint32 header = 0;
+        TArray<TestVertex> vertices;
+        String readLabel;
+        ar >> header;
+        ar >> vertices;
+        ar >> readLabel;
+
+        REQUIRE(header == 0xC0FFEEu);
+        REQUIRE_FALSE(vertices.IsView());
+        REQUIRE_FALSE(fs.HasLentViews());
+        REQUIRE(vertices.Num() == source.Num());
+        REQUIRE(std::memcmp(vertices.Data(), source.Data(), source.Num() * sizeof(TestVertex)) == 0);
+        REQUIRE(readLabel == label);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Arrays borrow mapped bytes until explicitly detached", "[core][serialization][mapped]")
+{
+    const TArray<TestVertex> source = MakeVertices(256);
+    const std::filesystem::path path = WriteTestFile("rebel_mapped_view.bin", source, String("x"));
+
+    {
+        RSharedPtr<MappedFile> mapping;
+        TArray<TestVertex> vertices;
+        {
+            MappedFileStream fs(path.string().c_str(), true);
+            BinaryReader ar(fs);
+            uint32 header = 0;
+            ar >> header;
+            ar >> vertices;
+
+            REQUIRE(fs.HasLentViews());
+            mapping = fs.GetMapping();
+        }
+
+        // The mapping outlives the stream through the shared handle.
+        const TestVertex* mapped = reinterpret_cast<const TestVertex*>(mapping->GetData() + sizeof(uint32) * 2);
+        const TArray<TestVertex>& view = vertices;
+        REQUIRE(vertices.IsView());
+        REQUIRE(view.Data() == mapped);
+        REQUIRE(view[255].Color == 255u * 7u);
+
+        // Writers detach explicitly; the copy leaves the file untouched.
+        vertices.DetachView();
+        REQUIRE(view.Data() != mapped);
+        vertices[0].Color = 42u;
+        REQUIRE_FALSE(vertices.IsView());
+        REQUIRE(vertices[0].Color == 42u);
+        REQUIRE(mapped[0].Color == 0u);
+
+        // Growing a view copies as well.
+        TArray<TestVertex> grown;
+        grown.AdoptView(mapped, source.Num());
+        grown.Add(source[0]);
+        REQUIRE_FALSE(grown.IsView());
+        REQUIRE(grown.Num() == 257);
+        REQUIRE(grown[256].Color == 0u);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -1,5 +1,6 @@
 #include "catch_amalgamated.hpp"
 #include "Core/Containers/TMap.h"
+#include <string>
 
 TEST_CASE("TMap insert/remove stress test", "[core][containers][tmap]")
 {
@@ -27,3 +28,89 @@ TEST_CASE("TMap insert/remove stress test", "[core][containers][tmap]")
         REQUIRE(*value == i * 7);
     }
 }
+
+TEST_CASE("TMap handles sequential and high-bit integer keys", "[core][containers][tmap]")
+{
+    // std::hash is the identity for integers, so these keys only spread if the map remixes them.
+    TMap<Rebel::Core::uint64, int> map;
+    constexpr int N = 4096;
+
+    for (int i = 0; i < N; ++i)
+    {
+        REQUIRE(map.Add((static_cast<Rebel::Core::uint64>(i) + 1) << 32, i));
+        REQUIRE(map.Add(static_cast<Rebel::Core::uint64>(i), -i));
+    }
+
+    REQUIRE(map.Num() == static_cast<Rebel::Core::MemSize>(N * 2));
+    REQUIRE_FALSE(map.Add(static_cast<Rebel::Core::uint64>(7) << 32, 0));
+
+    for (int i = 0; i < N; ++i)
+    {
+        const int* high = map.Find((static_cast<Rebel::Core::uint64>(i) + 1) << 32);
+        const int* low = map.Find(static_cast<Rebel::Core::uint64>(i));
+        REQUIRE(high != nullptr);
+        REQUIRE(low != nullptr);
+        REQUIRE(*high == i);
+        REQUIRE(*low == -i);
+    }
+}
+
+TEST_CASE("TMap respects the configured max load factor", "[core][containers][tmap]")
+{
+    TMap<int, int> dense;
+    TMap<int, int> sparse(0.5f);
+
+    for (int i = 0; i < 800; ++i)
+    {
+        dense.Add(i, i);
+        sparse.Add(i, i);
+    }
+
+    REQUIRE(sparse.GetMaxLoadFactor() == 0.5f);
+    REQUIRE(static_cast<float>(dense.Num()) <= static_cast<float>(dense.Capacity()) * dense.GetMaxLoadFactor());
+    REQUIRE(static_cast<float>(sparse.Num()) <= static_cast<float>(sparse.Capacity()) * 0.5f);
+    REQUIRE(sparse.Capacity() > dense.Capacity());
+
+    TMap<int, int> reserved;
+    reserved.Reserve(1000);
+    const Rebel::Core::MemSize reservedCapacity = reserved.Capacity();
+    for (int i = 0; i < 1000; ++i)
+        reserved.Add(i, i);
+    REQUIRE(reserved.Capacity() == reservedCapacity);
+}
+
+TEST_CASE("TMap copy, move and iteration keep every element", "[core][containers][tmap]")
+{
+    TMap<std::string, int> map;
+    for (int i = 0; i < 300; ++i)
+        map.Add(std::to_string(i), i);
+
+    TMap<std::string, int> copy = map;
+    TMap<std::string, int> moved = std::move(map);
+
+    REQUIRE(map.Num() == 0);
+    REQUIRE(map.Find("1") == nullptr);
+    REQUIRE(copy.Num() == 300);
+    REQUIRE(moved.Num() == 300);
+
+    int sum = 0;
+    Rebel::Core::MemSize visited = 0;
+    for (const auto& pair : copy)
+    {
+        REQUIRE(pair.Key == std::to_string(pair.Value));
+        sum += pair.Value;
+        ++visited;
+    }
+    REQUIRE(visited == 300);
+    REQUIRE(sum == 299 * 300 / 2);
+
+    copy["1"] = 100;
+    REQUIRE(*copy.Find("1") == 100);
+    REQUIRE(*moved.Find("1") == 1);
+
+    moved.Clear();
+    REQUIRE(moved.IsEmpty());
+    REQUIRE(moved.Find("1") == nullptr);
+    REQUIRE(moved.Add("1", 5));
+    REQUIRE(*moved.Find("1") == 5);
+}
@@ -56,3 +56,32 @@ TEST_CASE("TMap heavy tombstone churn preserves lookup correctness", "[core][con
         }
     }
 }
+
+TEST_CASE("TMap compacts tombstones instead of growing under churn", "[core][containers][tmap][tombstone]")
+{
+    TMap<int32, int32> map;
+    constexpr int32 liveCount = 256;
+
+    for (int32 i = 0; i < liveCount; ++i)
+        REQUIRE(map.Add(i, i));
+
+    const Rebel::Core::MemSize capacity = map.Capacity();
+
+    // Keep the live set constant while cycling through many distinct keys.
+    for (int32 i = liveCount; i < liveCount * 64; ++i)
+    {
+        REQUIRE(map.Remove(i - liveCount));
+        REQUIRE(map.Add(i, i));
+    }
+
+    REQUIRE(map.Num() == static_cast<Rebel::Core::MemSize>(liveCount));
+    REQUIRE(map.Capacity() == capacity);
+    REQUIRE(map.NumTombstones() + map.Num() <= static_cast<Rebel::Core::MemSize>(capacity * map.GetMaxLoadFactor()));
+
+    for (int32 i = liveCount * 63; i < liveCount * 64; ++i)
+    {
+        const int32* value = map.Find(i);
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == i);
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Engine/Scene/Scene.h"
+#include "Engine/Scene/Actor.h"
+#include "Engine/Components/Components.h"
+#include "Engine/Physics/PhysicsSystem.h"
+
+// Scene setup shared by the physics tests. Every primitive gets its own actor
+// whose root sits at the requested position.
+namespace PhysicsTest
+{
+	inline constexpr float kFixedDt = 1.0f / 60.0f;
+
+	inline BoxComponent& SpawnBox(Scene& scene, const Vector3& position, const Vector3& halfExtent,
+		ERBBodyType bodyType, CollisionChannel channel = CollisionChannel::Any)
+	{
+		Actor& actor = scene.SpawnActor<Actor>();
+		actor.GetComponent<SceneComponent>().SetPosition(position);
+
+		auto& box = actor.AddObjectComponent<BoxComponent>();
+		box.BodyType = bodyType;
+		box.ObjectChannel = channel;
+		box.HalfExtent = halfExtent;
+		return box;
+	}
+
+	inline SphereComponent& SpawnSphere(Scene& scene, const Vector3& position, float radius,
+		ERBBodyType bodyType, CollisionChannel channel = CollisionChannel::Any)
+	{
+		Actor& actor = scene.SpawnActor<Actor>();
+		actor.GetComponent<SceneComponent>().SetPosition(position);
+
+		auto& sphere = actor.AddObjectComponent<SphereComponent>();
+		sphere.BodyType = bodyType;
+		sphere.ObjectChannel = channel;
+		sphere.Radius = radius;
+		return sphere;
+	}
+
+	inline void StepFrames(PhysicsSystem& physics, Scene& scene, int32 frames, float deltaTime = kFixedDt)
+	{
+		for (int32 frame = 0; frame < frames; ++frame)
+			physics.Step(scene, deltaTime);
+	}
+}
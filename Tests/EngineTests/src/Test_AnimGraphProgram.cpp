@@ -0,0 +1,243 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Animation/AnimGraphAsset.h"
+#include "Engine/Animation/AnimationAsset.h"
+#include "Engine/Animation/AnimationModule.h"
+#include "Engine/Animation/SkeletalMeshAsset.h"
+#include "Engine/Animation/SkeletonAsset.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Components/Components.h"
+#include "Engine/Scene/Actor.h"
+#include "Engine/Scene/Scene.h"
+
+namespace
+{
+	constexpr float kFrameDt = 1.0f / 60.0f;
+
+	const Rebel::Core::Reflection::PropertyInfo* FindLocomotionProperty(const char* name)
+	{
+		for (const Rebel::Core::Reflection::PropertyInfo& prop : LocomotionAnimInstance::StaticType()->Properties)
+		{
+			if (prop.Name == name)
+				return &prop;
+		}
+		return nullptr;
+	}
+
+	AnimGraphNode& AddOutput(AnimGraphAsset& graph)
+	{
+		AnimGraphNode& output = graph.AddNode(AnimGraphNodeKind::Output, "Output Pose");
+		graph.m_OutputNodeID = output.ID;
+		return output;
+	}
+
+	// Idle -> Run after 0.1s in Idle; Run -> Idle only while in air, which a
+	// headless component never is.
+	struct IdleRunGraph
+	{
+		uint64 StateMachineID = 0;
+		uint64 IdleID = 0;
+		uint64 RunID = 0;
+
+		void Build(AnimGraphAsset& graph, AssetHandle idleClip, AssetHandle runClip)
+		{
+			AnimStateMachine& stateMachine = graph.AddStateMachine("Locomotion");
+			StateMachineID = stateMachine.ID;
+			IdleID = graph.AddState(stateMachine, "Idle").ID;
+			RunID = graph.AddState(stateMachine, "Run").ID;
+
+			AddClip(graph, *graph.FindStateMachine(StateMachineID), IdleID, idleClip);
+			AddClip(graph, *graph.FindStateMachine(StateMachineID), RunID, runClip);
+
+			AnimStateMachine& sm = *graph.FindStateMachine(StateMachineID);
+			AnimTransition& toRun = graph.AddTransition(sm, IdleID, RunID);
+			toRun.BlendDuration = 0.0f;
+			AnimTransitionCondition& time = toRun.Conditions.Emplace();
+			time.Op = AnimConditionOp::StateTimeGreater;
+			time.FloatValue = 0.1f;
+
+			AnimTransition& toIdle = graph.AddTransition(sm, RunID, IdleID);
+			AnimTransitionCondition& inAir = toIdle.Conditions.Emplace();
+			inAir.Op = AnimConditionOp::BoolIsTrue;
+			inAir.PropertyName = "bIsInAir";
+
+			// Points at a state that does not exist; compiled out.
+			graph.AddTransition(sm, IdleID, 77);
+
+			AnimGraphNode& machineNode = graph.AddNode(AnimGraphNodeKind::StateMachine, "Locomotion");
+			machineNode.StateMachineID = StateMachineID;
+			const uint64 machineNodeID = machineNode.ID;
+			AddOutput(graph).InputPose = machineNodeID;
+		}
+
+		static void AddClip(AnimGraphAsset& graph, AnimStateMachine& sm, uint64 stateID, AssetHandle clip)
+		{
+			for (AnimState& state : sm.States)
+			{
+				if (state.ID != stateID)
+					continue;
+
+				AnimGraphNode& clipNode = graph.AddNode(state.StateGraph, AnimGraphNodeKind::AnimationClip, "Clip");
+				clipNode.AnimationClip = clip;
+				const uint64 clipNodeID = clipNode.ID;
+				graph.FindOutputNode(state.StateGraph)->InputPose = clipNodeID;
+			}
+		}
+	};
+}
+
+TEST_CASE("Anim graph compiles to a post-order program with resolved bindings", "[engine][animation]")
+{
+	AnimGraphAsset graph;
+	graph.m_AnimInstanceClass = LocomotionAnimInstance::StaticType();
+
+	AnimGraphNode& clip = graph.AddNode(AnimGraphNodeKind::AnimationClip, "Clip");
+	clip.ClipStartTime = -1.0f;
+	const uint64 clipID = clip.ID;
+
+	AnimGraphNode& blend = graph.AddNode(AnimGraphNodeKind::Blend, "Blend");
+	blend.InputA = clipID;
+	blend.InputB = 999; // dangling
+	blend.BlendAlphaMode = AnimBlendAlphaMode::FloatProperty;
+	blend.BlendParameterName = "Speed";
+	blend.BlendTime = 0.2f;
+	const uint64 blendID = blend.ID;
+
+	AnimGraphNode& loop = graph.AddNode(AnimGraphNodeKind::Blend, "Cycle");
+	loop.InputA = blendID;
+	loop.BlendParameterName = "NotAProperty";
+	const uint64 loopID = loop.ID;
+	graph.FindNode(loopID)->InputB = loopID; // cycles back to itself
+
+	AddOutput(graph).InputPose = loopID;
+	graph.Compile();
+
+	const AnimGraphProgram& program = graph.GetProgram();
+	REQUIRE(program.IsValid());
+	REQUIRE(program.InstanceType == LocomotionAnimInstance::StaticType());
+	REQUIRE(program.RootNodeCount == 5);
+
+	const AnimProgramNode* root = &program.Nodes[program.RootFirstNode];
+	REQUIRE(root[0].Op == AnimProgramOp::Clip);
+	REQUIRE(root[0].ClipStartTime == 0.0f);
+	REQUIRE(root[1].Op == AnimProgramOp::Missing);
+	REQUIRE(root[2].Op == AnimProgramOp::Blend);
+	REQUIRE(root[2].NodeID == blendID);
+	REQUIRE(root[3].Op == AnimProgramOp::Missing);
+	REQUIRE(root[4].Op == AnimProgramOp::Blend);
+	REQUIRE(root[4].NodeID == loopID);
+	REQUIRE(program.MaxPoseStackDepth >= 3);
+
+	// Speed is bound once, by offset; unknown names stay unbound.
+	const Rebel::Core::Reflection::PropertyInfo* speed = FindLocomotionProperty("Speed");
+	REQUIRE(speed);
+	REQUIRE(root[2].BlendProperty >= 0);
+	REQUIRE(program.Bindings[root[2].BlendProperty].Offset == speed->Offset);
+	REQUIRE(program.Bindings[root[2].BlendProperty].Type == Rebel::Core::Reflection::EPropertyType::Float);
+	REQUIRE(root[4].BlendProperty == -1);
+
+	// Only the smoothed blend gets a runtime slot.
+	REQUIRE(program.BlendSlotNodes.Num() == 1);
+	REQUIRE(root[2].BlendSlot == 0);
+	REQUIRE(root[4].BlendSlot == -1);
+
+	const uint32 firstRevision = program.Revision;
+	graph.Compile();
+	REQUIRE(graph.GetProgram().Revision != firstRevision);
+}
+
+TEST_CASE("Compiled state machine groups transitions by source state", "[engine][animation]")
+{
+	AnimGraphAsset graph;
+	IdleRunGraph layout;
+	layout.Build(graph, AssetHandle(), AssetHandle());
+	graph.Compile();
+
+	const AnimGraphProgram& program = graph.GetProgram();
+	REQUIRE(program.StateMachines.Num() == 1);
+	REQUIRE(program.States.Num() == 2);
+
+	const AnimProgramStateMachine& sm = program.StateMachines[0];
+	const int32 idle = sm.FirstState;
+	const int32 run = sm.FirstState + 1;
+	REQUIRE(program.States[idle].ID == layout.IdleID);
+	REQUIRE(sm.EntryState == idle);
+
+	// The transition to the missing state is dropped.
+	REQUIRE(program.States[idle].TransitionCount == 1);
+	REQUIRE(program.Transitions[program.States[idle].FirstTransition].ToState == run);
+	REQUIRE(program.States[idle].ClipCount == 1);
+
+	const AnimProgramTransition& toIdle = program.Transitions[program.States[run].FirstTransition];
+	REQUIRE(toIdle.ToState == idle);
+	REQUIRE(toIdle.ConditionCount == 1);
+	const AnimProgramCondition& inAir = program.Conditions[toIdle.FirstCondition];
+	REQUIRE(inAir.Property >= 0);
+	REQUIRE(program.Bindings[inAir.Property].Type == Rebel::Core::Reflection::EPropertyType::Bool);
+
+	REQUIRE(program.RootNodeCount == 1);
+	REQUIRE(program.Nodes[program.RootFirstNode].Op == AnimProgramOp::StateMachine);
+}
+
+TEST_CASE("Compiled anim graph drives state machines and survives a recompile", "[engine][animation]")
+{
+	AssetRegistry registry;
+	AssetManager assets{registry};
+
+	SkeletonAsset* skeleton = assets.Create<SkeletonAsset>();
+	skeleton->m_Parent.Add(-1);
+	skeleton->m_Parent.Add(0);
+	skeleton->m_InvBind.Add(Mat4(1.0f));
+	skeleton->m_InvBind.Add(Mat4(1.0f));
+	skeleton->m_BoneNames.Add("Root");
+	skeleton->m_BoneNames.Add("Child");
+	skeleton->BuildBindPoseCache();
+
+	SkeletalMeshAsset* mesh = assets.Create<SkeletalMeshAsset>();
+	mesh->m_Skeleton = AssetPtr<SkeletonAsset>(skeleton->ID);
+
+	AnimationAsset* idleClip = assets.Create<AnimationAsset>();
+	idleClip->m_DurationSeconds = 1.0f;
+	AnimationAsset* runClip = assets.Create<AnimationAsset>();
+	runClip->m_DurationSeconds = 0.5f;
+
+	AnimGraphAsset* graph = assets.Create<AnimGraphAsset>();
+	IdleRunGraph layout;
+	layout.Build(*graph, idleClip->ID, runClip->ID);
+
+	Scene world;
+	Actor& actor = world.SpawnActor<Actor>();
+	SkeletalMeshComponent& skComp = actor.AddObjectComponent<SkeletalMeshComponent>();
+	skComp.Mesh = AssetPtr<SkeletalMeshAsset>(mesh->ID);
+	skComp.AnimGraph = AssetPtr<AnimGraphAsset>(graph->ID);
+	skComp.bEnableRootMotion = true;
+
+	AnimationModule animation;
+	animation.SetSceneContext(&world);
+	animation.SetAssetManagerContext(&assets);
+
+	for (int32 frame = 0; frame < 3; ++frame)
+		animation.Tick(kFrameDt);
+
+	// Built in code, so the first update compiled it.
+	REQUIRE(graph->IsCompiled());
+	REQUIRE(skComp.GraphProgramRevision == graph->GetProgram().Revision);
+	REQUIRE(skComp.StateMachineRuntimes.Num() == 1);
+	REQUIRE(skComp.StateMachineRuntimes[0].StateMachineID == layout.StateMachineID);
+	REQUIRE(skComp.StateMachineRuntimes[0].CurrentStateID == layout.IdleID);
+	REQUIRE(skComp.FinalPalette.Num() == 2);
+
+	for (int32 frame = 0; frame < 10; ++frame)
+		animation.Tick(kFrameDt);
+
+	const AnimStateMachineRuntime& runtime = skComp.StateMachineRuntimes[0];
+	REQUIRE(runtime.CurrentStateID == layout.RunID);
+	REQUIRE(graph->GetProgram().States[runtime.CurrentStateIndex].ID == layout.RunID);
+	const float runTime = runtime.StateTime;
+
+	// An editor-style recompile keeps the running state and its time.
+	graph->Compile();
+	animation.Tick(kFrameDt);
+	REQUIRE(skComp.GraphProgramRevision == graph->GetProgram().Revision);
+	REQUIRE(skComp.StateMachineRuntimes[0].CurrentStateID == layout.RunID);
+	REQUIRE(skComp.StateMachineRuntimes[0].StateTime == Catch::Approx(runTime + kFrameDt));
+}
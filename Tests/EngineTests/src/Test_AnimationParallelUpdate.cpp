@@ -0,0 +1,213 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Animation/AnimationAsset.h"
+#include "Engine/Animation/AnimationModule.h"
+#include "Engine/Animation/SkeletalMeshAsset.h"
+#include "Engine/Animation/SkeletonAsset.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Components/Components.h"
+#include "Engine/Scene/Actor.h"
+#include "Engine/Scene/Scene.h"
+#include "Core/MultiThreading/JobSystem.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+	constexpr float kFrameDt = 1.0f / 60.0f;
+
+	// A scene of characters sharing one skeleton and one looping clip that
+	// animates every bone, driven headless through AnimationModule.
+	struct AnimatedCrowd
+	{
+		AssetRegistry Registry;
+		AssetManager Assets{Registry};
+		Scene World;
+		AnimationModule Animation;
+		TArray<Actor*> Actors;
+		TArray<SkeletalMeshComponent*> Components;
+
+		AnimatedCrowd(int32 characterCount, int32 boneCount, bool bEnableRootMotion = true)
+		{
+			SkeletonAsset* skeleton = Assets.Create<SkeletonAsset>();
+			Mat4 global(1.0f);
+			for (int32 bone = 0; bone < boneCount; ++bone)
+			{
+				global = glm::translate(global, Vector3(0.0f, 0.0f, 0.1f));
+				skeleton->m_Parent.Add(bone - 1);
+				skeleton->m_InvBind.Add(FMath::inverse(global));
+				String name = "Bone";
+				name += std::to_string(bone).c_str();
+				skeleton->m_BoneNames.Add(name);
+			}
+			skeleton->BuildBindPoseCache();
+
+			SkeletalMeshAsset* mesh = Assets.Create<SkeletalMeshAsset>();
+			mesh->m_Skeleton = AssetPtr<SkeletonAsset>(skeleton->ID);
+
+			AnimationAsset* clip = Assets.Create<AnimationAsset>();
+			clip->m_DurationSeconds = 1.0f;
+			for (int32 bone = 0; bone < boneCount; ++bone)
+			{
+				AnimationTrack track;
+				track.BoneIndex = bone;
+				for (int32 key = 0; key <= 30; ++key)
+				{
+					const float time = key / 30.0f;
+					const float angle = std::sin(time * 6.2831853f + bone * 0.25f) * 0.3f;
+					track.RotationKeys.Add({time, FMath::angleAxis(angle, Vector3(1.0f, 0.0f, 0.0f))});
+					track.PositionKeys.Add({time, Vector3(0.0f, 0.0f, 0.1f)});
+				}
+				clip->m_Tracks.Add(track);
+			}
+
+			for (int32 i = 0; i < characterCount; ++i)
+			{
+				Actor& actor = World.SpawnActor<Actor>();
+				SkeletalMeshComponent& skComp = actor.AddObjectComponent<SkeletalMeshComponent>();
+				skComp.Mesh = AssetPtr<SkeletalMeshAsset>(mesh->ID);
+				skComp.Animation = AssetPtr<AnimationAsset>(clip->ID);
+				skComp.bEnableRootMotion = bEnableRootMotion;
+				skComp.PlaybackSpeed = 0.5f + 0.01f * static_cast<float>(i % 50);
+				Actors.Add(&actor);
+				Components.Add(&skComp);
+			}
+
+			Animation.SetSceneContext(&World);
+			Animation.SetAssetManagerContext(&Assets);
+		}
+
+		double RunFrames(int32 frames)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (int32 frame = 0; frame < frames; ++frame)
+				Animation.Tick(kFrameDt);
+			const auto end = std::chrono::high_resolution_clock::now();
+			return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+		}
+	};
+}
+
+TEST_CASE("Parallel animation update matches the serial update", "[engine][animation][jobs]")
+{
+	AnimatedCrowd serial(40, 24);
+	AnimatedCrowd parallel(40, 24);
+	serial.Animation.SetParallelEvaluation(false);
+	parallel.Animation.SetParallelEvaluation(true);
+
+	serial.RunFrames(20);
+	parallel.RunFrames(20);
+
+	bool bSame = true;
+	for (int32 i = 0; i < serial.Components.Num(); ++i)
+	{
+		const SkeletalMeshComponent* a = serial.Components[i];
+		const SkeletalMeshComponent* b = parallel.Components[i];
+		REQUIRE(a->FinalPalette.Num() == 24);
+		REQUIRE(b->FinalPalette.Num() == 24);
+		bSame = bSame && a->PlaybackTime == b->PlaybackTime;
+		for (int32 bone = 0; bone < 24; ++bone)
+			bSame = bSame && a->FinalPalette[bone] == b->FinalPalette[bone];
+	}
+	REQUIRE(bSame);
+
+	// Different playback speeds really produce different poses.
+	REQUIRE(parallel.Components[0]->FinalPalette[23] != parallel.Components[1]->FinalPalette[23]);
+}
+
+TEST_CASE("Parallel animation update with visual root motion stripping", "[engine][animation][jobs]")
+{
+	// Root motion off runs the visual strip, which needs each owner's
+	// forward vector while their transforms are dirty.
+	AnimatedCrowd serial(40, 24, false);
+	AnimatedCrowd parallel(40, 24, false);
+	serial.Animation.SetParallelEvaluation(false);
+	parallel.Animation.SetParallelEvaluation(true);
+
+	for (int32 frame = 0; frame < 10; ++frame)
+	{
+		for (AnimatedCrowd* crowd : {&serial, &parallel})
+		{
+			for (Actor* actor : crowd->Actors)
+			{
+				actor->AddActorWorldOffset(Vector3(0.1f, 0.0f, 0.0f));
+				actor->AddActorWorldRotation(Vector3(0.0f, 0.0f, 2.0f));
+			}
+			crowd->Animation.Tick(kFrameDt);
+		}
+	}
+
+	bool bSame = true;
+	for (int32 i = 0; i < serial.Components.Num(); ++i)
+	{
+		const SkeletalMeshComponent* a = serial.Components[i];
+		const SkeletalMeshComponent* b = parallel.Components[i];
+		REQUIRE(a->FinalPalette.Num() == 24);
+		REQUIRE(b->FinalPalette.Num() == 24);
+		for (int32 bone = 0; bone < 24; ++bone)
+			bSame = bSame && a->FinalPalette[bone] == b->FinalPalette[bone];
+	}
+	REQUIRE(bSame);
+}
+
+TEST_CASE("Override clips resolve before parallel evaluation", "[engine][animation][jobs]")
+{
+	AnimatedCrowd crowd(16, 8);
+	crowd.Animation.SetParallelEvaluation(true);
+
+	// Even components play the loaded clip as an override; odd ones ask for
+	// a clip nobody registered, which fails its load and stops the override.
+	const AssetHandle clip = crowd.Components[0]->Animation.GetHandle();
+	for (int32 i = 0; i < crowd.Components.Num(); ++i)
+		crowd.Components[i]->PlayAnimation(i % 2 == 0 ? clip : AssetHandle(Rebel::Core::GUID()), true);
+
+	crowd.RunFrames(5);
+
+	for (int32 i = 0; i < crowd.Components.Num(); ++i)
+	{
+		const SkeletalMeshComponent* skComp = crowd.Components[i];
+		REQUIRE(skComp->FinalPalette.Num() == 8);
+		if (i % 2 == 0)
+		{
+			REQUIRE(skComp->bOverrideAnimationActive);
+			REQUIRE(skComp->OverridePlaybackTime > 0.0f);
+		}
+		else
+		{
+			REQUIRE_FALSE(skComp->bOverrideAnimationActive);
+		}
+	}
+}
+
+TEST_CASE("Animation update benchmark, serial vs job system (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 CharacterCount = 128;
+	constexpr int32 BoneCount = 64;
+	constexpr int32 Frames = 60;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	AnimatedCrowd crowd(CharacterCount, BoneCount);
+
+	// Warm up pose buffers and AnimInstances before timing.
+	crowd.RunFrames(2);
+
+	crowd.Animation.SetParallelEvaluation(false);
+	const double serialMs = crowd.RunFrames(Frames);
+
+	crowd.Animation.SetParallelEvaluation(true);
+	const double parallelMs = crowd.RunFrames(Frames);
+
+	REQUIRE(crowd.Components[0]->FinalPalette.Num() == BoneCount);
+
+	std::cout << "Animation update, " << CharacterCount << " characters x " << BoneCount << " bones, "
+	          << Rebel::Core::Threading::JobSystem::Get().GetThreadCount() << " threads\n";
+	std::cout << "Serial (ms/frame): " << serialMs << "\n";
+	std::cout << "Parallel (ms/frame): " << parallelMs << "\n";
+	std::cout << "Speedup: " << (parallelMs > 0.0 ? serialMs / parallelMs : 0.0) << "\n";
+}
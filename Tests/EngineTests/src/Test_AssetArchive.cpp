@@ -0,0 +1,220 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Assets/AssetArchive.h"
+#include "Engine/Assets/AssetFileHeader.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/MeshAsset.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	std::filesystem::path MakeArchiveDirectory(const char* name)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		return directory;
+	}
+
+	// Writes the mesh the way AssetManagerModule::SaveAssetToFile does.
+	String SaveLooseMesh(MeshAsset& mesh, const std::filesystem::path& directory, const char* name, int32 vertexCount)
+	{
+		mesh.ID = AssetHandle(Rebel::Core::GUID());
+		mesh.Path = String((directory / name).generic_string().c_str());
+		for (int32 i = 0; i < vertexCount; ++i)
+		{
+			Vertex vertex{};
+			vertex.Position = Vector3(static_cast<float>(i), 0.0f, 0.0f);
+			mesh.Vertices.Add(vertex);
+			mesh.Indices.Add(static_cast<uint32>(i));
+		}
+
+		FileStream fs((mesh.Path + ".rasset").c_str(), "wb");
+		BinaryWriter ar(fs);
+
+		AssetFileHeader header{};
+		header.AssetID = (uint64)mesh.ID;
+		header.TypeHash = Rebel::Core::Reflection::TypeHash(MeshAsset::StaticType()->Name.c_str());
+		ar.Write(header);
+		header.PayloadOffset = ar.Tell();
+		mesh.Serialize(ar);
+		ar.Seek(0);
+		ar.Write(header);
+		return mesh.Path;
+	}
+}
+
+TEST_CASE("Cooked archives have a sorted, searchable table of contents", "[engine][assets][archive]")
+{
+	const std::filesystem::path directory = MakeArchiveDirectory("rebel_archive_toc");
+	const String archivePath((directory / "Test.rpak").generic_string().c_str());
+
+	MeshAsset meshes[3];
+	TArray<String> paths;
+	paths.Add(SaveLooseMesh(meshes[0], directory, "A", 3));
+	paths.Add(SaveLooseMesh(meshes[1], directory, "B", 30));
+	paths.Add(SaveLooseMesh(meshes[2], directory, "C", 7));
+
+	REQUIRE(AssetArchive::Cook(archivePath, paths));
+
+	AssetArchive archive;
+	REQUIRE(archive.Open(archivePath));
+	REQUIRE(archive.GetEntryCount() == 3);
+
+	for (uint32 i = 1; i < archive.GetEntryCount(); ++i)
+		REQUIRE(archive.GetEntry(i - 1).AssetID < archive.GetEntry(i).AssetID);
+
+	for (const MeshAsset& mesh : meshes)
+	{
+		const AssetArchiveEntry* entry = archive.Find(mesh.ID);
+		REQUIRE(entry != nullptr);
+		REQUIRE(entry->Offset % 16 == 0);
+		REQUIRE(entry->TypeHash == Rebel::Core::Reflection::TypeHash(MeshAsset::StaticType()->Name.c_str()));
+		REQUIRE(archive.GetEntryPath(*entry) == mesh.Path);
+	}
+
+	REQUIRE(archive.Find(AssetHandle(Rebel::Core::GUID())) == nullptr);
+
+	// A failed cook keeps the previous archive intact.
+	archive.Close();
+	paths.Add(String((directory / "Missing").generic_string().c_str()));
+	REQUIRE_FALSE(AssetArchive::Cook(archivePath, paths));
+	REQUIRE(archive.Open(archivePath));
+	REQUIRE(archive.GetEntryCount() == 3);
+
+	archive.Close();
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("AssetManager loads packed assets from archive offsets", "[engine][assets][archive]")
+{
+	const std::filesystem::path directory = MakeArchiveDirectory("rebel_archive_load");
+	const String archivePath((directory / "Test.rpak").generic_string().c_str());
+
+	MeshAsset source;
+	TArray<String> paths;
+	paths.Add(SaveLooseMesh(source, directory, "Mesh", 64));
+	REQUIRE(AssetArchive::Cook(archivePath, paths));
+
+	// Only the archive is left to load from.
+	std::filesystem::remove(std::filesystem::path((source.Path + ".rasset").c_str()));
+
+	{
+		AssetArchive archive;
+		REQUIRE(archive.Open(archivePath));
+		const AssetArchiveEntry* entry = archive.Find(source.ID);
+		REQUIRE(entry != nullptr);
+
+		AssetRegistry registry;
+		AssetMeta meta;
+		meta.ID = source.ID;
+		meta.Type = MeshAsset::StaticType();
+		meta.Path = archive.GetEntryPath(*entry);
+		meta.FileSize = entry->Size;
+		meta.Archive = archive.GetMapping();
+		meta.ArchiveOffset = entry->Offset;
+		registry.Register(meta);
+
+		AssetManager assets{registry};
+		const MeshAsset* loaded = dynamic_cast<const MeshAsset*>(assets.Load(source.ID));
+		REQUIRE(loaded != nullptr);
+		REQUIRE(loaded->Path == source.Path);
+		REQUIRE(loaded->Vertices.Num() == source.Vertices.Num());
+		REQUIRE(loaded->Indices.Num() == source.Indices.Num());
+		for (MemSize i = 0; i < source.Indices.Num(); ++i)
+		{
+			REQUIRE(loaded->Indices[i] == source.Indices[i]);
+			REQUIRE(loaded->Vertices[i].Position == source.Vertices[i].Position);
+		}
+
+		// Blobs keep their loose-file alignment, so arrays are still borrowed.
+		AssetManager viewAssets{registry};
+		const MeshAsset* viewed = dynamic_cast<const MeshAsset*>(viewAssets.Load(source.ID));
+		REQUIRE(viewed->Indices.IsView());
+		REQUIRE(viewed->SourceMapping);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Registries resolve packed assets through the mounted TOC", "[engine][assets][archive]")
+{
+	const std::filesystem::path directory = MakeArchiveDirectory("rebel_archive_mount");
+	const String archivePath((directory / "Test.rpak").generic_string().c_str());
+
+	MeshAsset meshes[2];
+	TArray<String> paths;
+	paths.Add(SaveLooseMesh(meshes[0], directory, "A", 5));
+	paths.Add(SaveLooseMesh(meshes[1], directory, "B", 9));
+	REQUIRE(AssetArchive::Cook(archivePath, paths));
+
+	{
+		AssetArchive archive;
+		REQUIRE(archive.Open(archivePath));
+
+		AssetRegistry registry;
+		registry.MountArchive(&archive);
+
+		// Nothing is copied into the registry at mount time.
+		REQUIRE(registry.GetAll().Num() == 0);
+
+		const AssetMeta* meta = registry.Get(meshes[1].ID);
+		REQUIRE(meta != nullptr);
+		REQUIRE(meta->Type == MeshAsset::StaticType());
+		REQUIRE(meta->Path == meshes[1].Path);
+		REQUIRE(meta->Archive.Get() == archive.GetMapping().Get());
+		REQUIRE(meta->ArchiveOffset == archive.Find(meshes[1].ID)->Offset);
+		REQUIRE(registry.Get(meshes[1].ID) == meta);
+		REQUIRE(registry.Get(AssetHandle(Rebel::Core::GUID())) == nullptr);
+
+		// A loose entry with the same ID wins over the packed one.
+		AssetMeta loose = *meta;
+		loose.Archive.Reset();
+		loose.ArchiveOffset = 0;
+		registry.Register(loose);
+		REQUIRE(registry.Get(meshes[1].ID)->Archive.Get() == nullptr);
+
+		AssetManager assets{registry};
+		const MeshAsset* loaded = dynamic_cast<const MeshAsset*>(assets.Load(meshes[0].ID));
+		REQUIRE(loaded != nullptr);
+		REQUIRE(loaded->Vertices.Num() == 5);
+
+		registry.Clear();
+		REQUIRE(registry.Get(meshes[0].ID) == nullptr);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Archives with out-of-range entries are rejected on open", "[engine][assets][archive]")
+{
+	const std::filesystem::path directory = MakeArchiveDirectory("rebel_archive_corrupt");
+	const String archivePath((directory / "Test.rpak").generic_string().c_str());
+
+	MeshAsset mesh;
+	TArray<String> paths;
+	paths.Add(SaveLooseMesh(mesh, directory, "Mesh", 16));
+	REQUIRE(AssetArchive::Cook(archivePath, paths));
+
+	// Point the only entry's blob past the end of the file.
+	{
+		std::fstream file(archivePath.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+		AssetArchiveHeader header{};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		REQUIRE(file);
+
+		AssetArchiveEntry entry{};
+		file.seekg((std::streamoff)header.TocOffset);
+		file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+		entry.Size = std::filesystem::file_size(archivePath.c_str());
+		file.seekp((std::streamoff)header.TocOffset);
+		file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+	}
+
+	AssetArchive archive;
+	REQUIRE_FALSE(archive.Open(archivePath));
+	REQUIRE_FALSE(archive.IsOpen());
+
+	std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,203 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Assets/AssetFileHeader.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/MeshAsset.h"
+
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::filesystem::path MakeScratchDirectory(const char* name)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		return directory;
+	}
+
+	// Writes a loose mesh and registers it, the way a directory scan would.
+	AssetHandle AddLooseMesh(AssetRegistry& registry, const std::filesystem::path& directory, const char* name, int32 vertexCount)
+	{
+		MeshAsset mesh;
+		mesh.ID = AssetHandle(Rebel::Core::GUID());
+		mesh.Path = String((directory / name).generic_string().c_str());
+		for (int32 i = 0; i < vertexCount; ++i)
+		{
+			mesh.Vertices.Add(Vertex{});
+			mesh.Indices.Add(static_cast<uint32>(i));
+		}
+
+		{
+			FileStream fs((mesh.Path + ".rasset").c_str(), "wb");
+			BinaryWriter ar(fs);
+
+			AssetFileHeader header{};
+			header.AssetID = (uint64)mesh.ID;
+			header.TypeHash = Rebel::Core::Reflection::TypeHash(MeshAsset::StaticType()->Name.c_str());
+			ar.Write(header);
+			header.PayloadOffset = ar.Tell();
+			mesh.Serialize(ar);
+			ar.Seek(0);
+			ar.Write(header);
+		}
+
+		AssetMeta meta;
+		meta.ID = mesh.ID;
+		meta.Type = MeshAsset::StaticType();
+		meta.Path = mesh.Path;
+		meta.FileSize = std::filesystem::file_size(std::filesystem::path((mesh.Path + ".rasset").c_str()));
+		registry.Register(meta);
+		return mesh.ID;
+	}
+}
+
+TEST_CASE("Async asset loads are deduplicated and finish through FinalizeAsyncLoads", "[engine][assets][async]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_async_load");
+
+	AssetRegistry registry;
+	const AssetHandle rock = AddLooseMesh(registry, directory, "Rock", 16);
+
+	{
+		AssetManager assets{registry};
+
+		int32 callbacks = 0;
+		Asset* delivered = nullptr;
+		AssetLoadHandle first = assets.LoadAsync(rock, EAssetLoadPriority::Normal,
+			[&](Asset* asset) { ++callbacks; delivered = asset; });
+		AssetLoadHandle second = assets.LoadAsync(rock, EAssetLoadPriority::High,
+			[&](Asset*) { ++callbacks; });
+
+		REQUIRE(first.Get() == second.Get());
+		REQUIRE(first->GetPriority() == EAssetLoadPriority::High);
+		REQUIRE(assets.GetAsyncLoadCount() == 1);
+
+		assets.FlushAsyncLoads();
+
+		REQUIRE(first->IsReady());
+		REQUIRE(callbacks == 2);
+		REQUIRE(delivered == assets.Get(rock));
+
+		const MeshAsset* mesh = dynamic_cast<const MeshAsset*>(first->GetAsset());
+		REQUIRE(mesh != nullptr);
+		REQUIRE(mesh->Vertices.Num() == 16);
+		REQUIRE(assets.GetAsyncLoadCount() == 0);
+
+		// Already loaded: ready right away.
+		bool bCalled = false;
+		AssetLoadHandle again = assets.LoadAsync(rock, EAssetLoadPriority::Low, [&](Asset*) { bCalled = true; });
+		REQUIRE(again->IsReady());
+		REQUIRE(bCalled);
+
+		// Unknown assets fail without being queued.
+		AssetLoadHandle missing = assets.LoadAsync(AssetHandle(Rebel::Core::GUID()));
+		REQUIRE(missing->IsDone());
+		REQUIRE_FALSE(missing->IsReady());
+		REQUIRE(assets.GetAsyncLoadCount() == 0);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Async asset loads finalize in priority order", "[engine][assets][async]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_async_priority");
+
+	AssetRegistry registry;
+	const AssetHandle low = AddLooseMesh(registry, directory, "Low", 4);
+	const AssetHandle normal = AddLooseMesh(registry, directory, "Normal", 4);
+	const AssetHandle high = AddLooseMesh(registry, directory, "High", 4);
+
+	{
+		AssetManager assets{registry};
+
+		std::vector<AssetHandle> order;
+		auto record = [&order](Asset* asset) { order.push_back(asset->ID); };
+		AssetLoadHandle requests[] = {
+			assets.LoadAsync(low, EAssetLoadPriority::Low, record),
+			assets.LoadAsync(normal, EAssetLoadPriority::Normal, record),
+			assets.LoadAsync(high, EAssetLoadPriority::High, record)};
+
+		// Let every deserialization land first, so only finalize order is
+		// tested. Without workers FinalizeAsyncLoads deserializes in order.
+		if (Rebel::Core::Threading::JobSystem::Get().GetWorkerCount() > 0)
+		{
+			for (const AssetLoadHandle& request : requests)
+			{
+				while (request->GetState() != AssetLoadRequest::EState::Loaded)
+					std::this_thread::yield();
+			}
+		}
+
+		assets.FlushAsyncLoads();
+
+		REQUIRE(order.size() == 3);
+		REQUIRE(order[0] == high);
+		REQUIRE(order[1] == normal);
+		REQUIRE(order[2] == low);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Synchronous loads take over pending async requests", "[engine][assets][async]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_async_sync");
+
+	AssetRegistry registry;
+	const AssetHandle crate = AddLooseMesh(registry, directory, "Crate", 8);
+	const AssetHandle barrel = AddLooseMesh(registry, directory, "Barrel", 8);
+
+	{
+		AssetManager assets{registry};
+
+		Asset* delivered = nullptr;
+		AssetLoadHandle request = assets.LoadAsync(crate, EAssetLoadPriority::Low,
+			[&](Asset* asset) { delivered = asset; });
+
+		Asset* loaded = assets.Load(crate);
+		REQUIRE(loaded != nullptr);
+		REQUIRE(request->IsReady());
+		REQUIRE(request->GetAsset() == loaded);
+		REQUIRE(delivered == loaded);
+
+		// A worker that was already deserializing it must not add a second copy.
+		assets.FlushAsyncLoads();
+		REQUIRE(assets.Get(crate) == loaded);
+
+		// Per-frame callers see nothing until the load is finalized.
+		REQUIRE(assets.GetOrLoadAsync(barrel) == nullptr);
+		REQUIRE(assets.GetAsyncLoadCount() == 1);
+		assets.FlushAsyncLoads();
+		REQUIRE(assets.GetOrLoadAsync(barrel) != nullptr);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Async asset loads keep their registry entry across a rescan", "[engine][assets][async]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_async_rescan");
+
+	AssetRegistry registry;
+	const AssetHandle rock = AddLooseMesh(registry, directory, "Rock", 8);
+
+	{
+		AssetManager assets{registry};
+		AssetLoadHandle request = assets.LoadAsync(rock);
+
+		// A scan clears and refills the registry while the load is in flight.
+		registry.Clear();
+
+		assets.FlushAsyncLoads();
+
+		REQUIRE(request->IsReady());
+		const MeshAsset* mesh = dynamic_cast<const MeshAsset*>(request->GetAsset());
+		REQUIRE(mesh != nullptr);
+		REQUIRE(mesh->Vertices.Num() == 8);
+	}
+
+	std::filesystem::remove_all(directory);
+}
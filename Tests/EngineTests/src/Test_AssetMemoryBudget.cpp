@@ -0,0 +1,183 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Animation/AnimGraphAsset.h"
+#include "Engine/Assets/AssetFileHeader.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/AssetPtr.h"
+#include "Engine/Assets/MeshAsset.h"
+
+#include <filesystem>
+
+namespace
+{
+	std::filesystem::path MakeScratchDirectory(const char* name)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		return directory;
+	}
+
+	AssetHandle AddLooseMesh(AssetRegistry& registry, const std::filesystem::path& directory, const char* name, int32 vertexCount)
+	{
+		MeshAsset mesh;
+		mesh.ID = AssetHandle(Rebel::Core::GUID());
+		mesh.Path = String((directory / name).generic_string().c_str());
+		for (int32 i = 0; i < vertexCount; ++i)
+		{
+			mesh.Vertices.Add(Vertex{});
+			mesh.Indices.Add(static_cast<uint32>(i));
+		}
+
+		{
+			FileStream fs((mesh.Path + ".rasset").c_str(), "wb");
+			BinaryWriter ar(fs);
+
+			AssetFileHeader header{};
+			header.AssetID = (uint64)mesh.ID;
+			header.TypeHash = Rebel::Core::Reflection::TypeHash(MeshAsset::StaticType()->Name.c_str());
+			ar.Write(header);
+			header.PayloadOffset = ar.Tell();
+			mesh.Serialize(ar);
+			ar.Seek(0);
+			ar.Write(header);
+		}
+
+		AssetMeta meta;
+		meta.ID = mesh.ID;
+		meta.Type = MeshAsset::StaticType();
+		meta.Path = mesh.Path;
+		meta.FileSize = std::filesystem::file_size(std::filesystem::path((mesh.Path + ".rasset").c_str()));
+		registry.Register(meta);
+		return mesh.ID;
+	}
+}
+
+TEST_CASE("AssetPtr holders reference count their assets", "[engine][assets][memory]")
+{
+	AssetRegistry registry;
+	AssetManager assets{registry};
+	AssetPtrBase::SetReferenceTracker(&assets);
+
+	const AssetHandle id = AssetHandle(Rebel::Core::GUID());
+	{
+		AssetPtr<MeshAsset> first(id);
+		REQUIRE(assets.GetReferenceCount(id) == 1);
+		{
+			AssetPtr<MeshAsset> copy = first;
+			REQUIRE(assets.GetReferenceCount(id) == 2);
+
+			copy.SetHandle(AssetHandle(Rebel::Core::GUID()));
+			REQUIRE(assets.GetReferenceCount(id) == 1);
+		}
+
+		AssetPtr<MeshAsset> assigned;
+		assigned = first;
+		REQUIRE(assets.GetReferenceCount(id) == 2);
+	}
+	REQUIRE(assets.GetReferenceCount(id) == 0);
+
+	// References taken under a tracker are not released into the next one.
+	AssetPtr<MeshAsset> stale(id);
+	AssetPtrBase::SetReferenceTracker(nullptr);
+	AssetManager other{registry};
+	AssetPtrBase::SetReferenceTracker(&other);
+	stale.SetHandle(0);
+	REQUIRE(other.GetReferenceCount(id) == 0);
+	AssetPtrBase::SetReferenceTracker(nullptr);
+}
+
+TEST_CASE("Over budget, unreferenced assets are evicted least recently used first", "[engine][assets][memory]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_asset_budget");
+
+	AssetRegistry registry;
+	const AssetHandle held = AddLooseMesh(registry, directory, "Held", 64);
+	const AssetHandle recent = AddLooseMesh(registry, directory, "Recent", 64);
+	const AssetHandle stale = AddLooseMesh(registry, directory, "Stale", 64);
+
+	{
+		AssetManager assets{registry};
+		AssetPtrBase::SetReferenceTracker(&assets);
+		AssetPtr<MeshAsset> holder(held);
+
+		REQUIRE(assets.Load(held) != nullptr);
+		REQUIRE(assets.Load(recent) != nullptr);
+		REQUIRE(assets.Load(stale) != nullptr);
+		MeshAsset* inMemory = assets.Create<MeshAsset>();
+		inMemory->Vertices.Resize(64);
+		assets.Get(recent);
+
+		const AssetMemoryReport report = assets.GetResidentBytes();
+		REQUIRE(report.Types.Num() == 1);
+		REQUIRE(report.Types[0].Type == MeshAsset::StaticType());
+		REQUIRE(report.Types[0].Count == 4);
+		REQUIRE(report.Types[0].Bytes == report.TotalBytes);
+		REQUIRE(report.TotalBytes > 4 * 64 * sizeof(Vertex));
+
+		// No budget, no eviction.
+		REQUIRE(assets.EnforceMemoryBudget() == 0);
+
+		assets.SetMemoryBudget(report.TotalBytes - 1);
+		REQUIRE(assets.EnforceMemoryBudget() == 1);
+		REQUIRE_FALSE(assets.IsLoaded(stale));
+		REQUIRE(assets.IsLoaded(recent));
+		REQUIRE(assets.IsLoaded(held));
+
+		// Referenced and in-memory assets stay even when nothing else fits.
+		assets.SetMemoryBudget(1);
+		REQUIRE(assets.EnforceMemoryBudget() == 1);
+		REQUIRE_FALSE(assets.IsLoaded(recent));
+		REQUIRE(assets.IsLoaded(held));
+		REQUIRE(assets.Get(inMemory->ID) == inMemory);
+		REQUIRE(assets.GetResidentBytes().Types[0].Count == 2);
+
+		// Evicted assets reload into freed slots.
+		assets.SetMemoryBudget(0);
+		const MeshAsset* reloaded = dynamic_cast<const MeshAsset*>(assets.Load(stale));
+		REQUIRE(reloaded != nullptr);
+		REQUIRE(reloaded->Vertices.Num() == 64);
+
+		assets.Unload(held);
+		REQUIRE_FALSE(assets.IsLoaded(held));
+		REQUIRE(assets.GetResidentBytes().Types[0].Count == 2);
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Uploaded meshes and compiled graph clips are not evicted", "[engine][assets][memory]")
+{
+	const std::filesystem::path directory = MakeScratchDirectory("rebel_asset_budget_pinned");
+
+	AssetRegistry registry;
+	const AssetHandle uploaded = AddLooseMesh(registry, directory, "Uploaded", 64);
+	const AssetHandle clip = AddLooseMesh(registry, directory, "Clip", 64);
+	const AssetHandle idle = AddLooseMesh(registry, directory, "Idle", 64);
+
+	{
+		AssetManager assets{registry};
+		AssetPtrBase::SetReferenceTracker(&assets);
+
+		// Stands in for RenderModule's AddStaticMesh.
+		MeshAsset* mesh = dynamic_cast<MeshAsset*>(assets.Load(uploaded));
+		REQUIRE(mesh != nullptr);
+		mesh->Handle.indexCount = 64;
+
+		// Compiled program nodes reference their clip like any AssetPtr.
+		AnimProgramNode node;
+		node.AnimationClip = clip;
+		REQUIRE(assets.GetReferenceCount(clip) == 1);
+
+		REQUIRE(assets.Load(clip) != nullptr);
+		REQUIRE(assets.Load(idle) != nullptr);
+
+		assets.SetMemoryBudget(1);
+		REQUIRE(assets.EnforceMemoryBudget() == 1);
+		REQUIRE_FALSE(assets.IsLoaded(idle));
+		REQUIRE(assets.IsLoaded(clip));
+		REQUIRE(assets.Get(uploaded) == mesh);
+	}
+
+	AssetPtrBase::SetReferenceTracker(nullptr);
+	std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,176 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Assets/AssetFileHeader.h"
+#include "Engine/Assets/AssetManagerModule.h"
+#include "Engine/Assets/MeshAsset.h"
+
+#include <chrono>
+#include <filesystem>
+
+namespace
+{
+	// The module scans roots relative to the working directory, so each test
+	// runs inside its own scratch directory.
+	struct ScopedWorkingDirectory
+	{
+		std::filesystem::path Previous;
+		std::filesystem::path Directory;
+
+		explicit ScopedWorkingDirectory(const char* name)
+			: Previous(std::filesystem::current_path())
+			, Directory(std::filesystem::temp_directory_path() / name)
+		{
+			std::filesystem::remove_all(Directory);
+			std::filesystem::create_directories(Directory / "Assets" / "Meshes");
+			std::filesystem::current_path(Directory);
+		}
+
+		~ScopedWorkingDirectory()
+		{
+			std::filesystem::current_path(Previous);
+			std::error_code ec;
+			std::filesystem::remove_all(Directory, ec);
+		}
+	};
+
+	AssetHandle WriteMesh(const char* path, int32 vertexCount)
+	{
+		MeshAsset mesh;
+		mesh.ID = AssetHandle(Rebel::Core::GUID());
+		for (int32 i = 0; i < vertexCount; ++i)
+			mesh.Vertices.Add(Vertex{});
+
+		FileStream fs(path, "wb");
+		BinaryWriter ar(fs);
+
+		AssetFileHeader header{};
+		header.AssetID = (uint64)mesh.ID;
+		header.TypeHash = Rebel::Core::Reflection::TypeHash(MeshAsset::StaticType()->Name.c_str());
+		ar.Write(header);
+		header.PayloadOffset = ar.Tell();
+		mesh.Serialize(ar);
+		ar.Seek(0);
+		ar.Write(header);
+		return mesh.ID;
+	}
+
+	void WriteGarbage(const char* path)
+	{
+		FileStream fs(path, "wb");
+		const char text[] = "not an asset";
+		fs.Write(text, sizeof(text));
+	}
+
+	// Make sure a rewrite is visible even on file systems with coarse mtimes.
+	void BumpWriteTime(const char* path)
+	{
+		const auto time = std::filesystem::last_write_time(path);
+		std::filesystem::last_write_time(path, time + std::chrono::seconds(2));
+	}
+
+	void RequireSameRegistry(const AssetRegistry& a, const AssetRegistry& b)
+	{
+		REQUIRE(a.GetAll().Num() == b.GetAll().Num());
+		for (const auto& pair : a.GetAll())
+		{
+			const AssetMeta* other = b.Get(pair.Key);
+			REQUIRE(other != nullptr);
+			REQUIRE(other->Type == pair.Value.Type);
+			REQUIRE(other->Path == pair.Value.Path);
+			REQUIRE(other->FileSize == pair.Value.FileSize);
+		}
+	}
+}
+
+TEST_CASE("Cached asset scans match full header scans", "[engine][assets][registry]")
+{
+	ScopedWorkingDirectory scratch("rebel_registry_cache");
+
+	const AssetHandle rock = WriteMesh("Assets/Meshes/Rock.rasset", 8);
+	WriteMesh("Assets/Meshes/Tree.rasset", 32);
+	WriteMesh("Assets/Crate.rasset", 24);
+	WriteGarbage("Assets/Broken.rasset");
+
+	AssetManagerModule cached;
+	AssetManagerModule full;
+	full.SetRegistryCacheEnabled(false);
+
+	// Cold: the cache is built from a full scan.
+	cached.Init();
+	full.Init();
+	REQUIRE(std::filesystem::exists(AssetRegistryCache::DefaultPath));
+	REQUIRE(cached.GetRegistry().GetAll().Num() == 3);
+	RequireSameRegistry(cached.GetRegistry(), full.GetRegistry());
+
+	// Warm, from the cache file a fresh module (a new editor session) reads.
+	AssetManagerModule relaunched;
+	relaunched.Init();
+	RequireSameRegistry(relaunched.GetRegistry(), full.GetRegistry());
+
+	// Changed, added and deleted files are all picked up.
+	const AssetHandle newRock = WriteMesh("Assets/Meshes/Rock.rasset", 12);
+	BumpWriteTime("Assets/Meshes/Rock.rasset");
+	const AssetHandle bush = WriteMesh("Assets/Meshes/Bush.rasset", 4);
+	std::filesystem::remove("Assets/Crate.rasset");
+
+	relaunched.RescanAssets();
+	full.RescanAssets();
+	RequireSameRegistry(relaunched.GetRegistry(), full.GetRegistry());
+	REQUIRE(relaunched.GetRegistry().Get(rock) == nullptr);
+	REQUIRE(relaunched.GetRegistry().Get(newRock) != nullptr);
+	REQUIRE(relaunched.GetRegistry().Get(bush) != nullptr);
+
+	relaunched.Shutdown();
+	cached.Shutdown();
+	full.Shutdown();
+}
+
+TEST_CASE("A corrupt registry cache falls back to a full scan", "[engine][assets][registry]")
+{
+	ScopedWorkingDirectory scratch("rebel_registry_cache_corrupt");
+
+	WriteMesh("Assets/Meshes/Rock.rasset", 8);
+	WriteGarbage(AssetRegistryCache::DefaultPath);
+
+	AssetManagerModule module;
+	module.Init();
+	REQUIRE(module.GetRegistry().GetAll().Num() == 1);
+
+	AssetRegistryCache cache;
+	REQUIRE(cache.Load(AssetRegistryCache::DefaultPath));
+	REQUIRE(cache.Num() == 1);
+
+	module.Shutdown();
+}
+
+TEST_CASE("Roots packed into the mounted archive are not scanned", "[engine][assets][registry]")
+{
+	ScopedWorkingDirectory scratch("rebel_registry_archived_roots");
+
+	const AssetHandle rock = WriteMesh("Assets/Meshes/Rock.rasset", 8);
+	const AssetHandle crate = WriteMesh("Assets/Crate.rasset", 24);
+
+	{
+		AssetManagerModule cooker;
+		cooker.Init();
+		REQUIRE(cooker.CookArchive());
+		REQUIRE(cooker.GetArchive().CoversRoot("Assets"));
+		cooker.Shutdown();
+	}
+
+	// Shipped layout: packed assets come from the archive TOC, and the
+	// archived root is never walked.
+	AssetManagerModule shipped;
+	shipped.Init();
+	REQUIRE(shipped.GetRegistry().GetAll().Num() == 0);
+	REQUIRE(shipped.GetRegistry().Get(rock) != nullptr);
+	REQUIRE(shipped.GetRegistry().Get(crate) != nullptr);
+	REQUIRE(shipped.GetRegistry().Get(rock)->Archive.Get() != nullptr);
+
+	// Editor layout: loose files are scanned again and win over their
+	// packed copies.
+	shipped.SetScanArchivedRoots(true);
+	REQUIRE(shipped.GetRegistry().GetAll().Num() == 2);
+	REQUIRE(shipped.GetRegistry().Get(rock)->Archive.Get() == nullptr);
+
+	shipped.Shutdown();
+}
@@ -0,0 +1,192 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Rendering/DrawList.h"
+#include "Engine/Rendering/OpenGLRenderAPI.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	MeshHandle MakeMesh(uint32 firstIndex)
+	{
+		MeshHandle mesh;
+		mesh.firstIndex = firstIndex;
+		mesh.indexCount = 36;
+		return mesh;
+	}
+
+	// Shape of the old OpenGLRenderAPI::PendingDraw, sorted whole.
+	struct FatPendingDraw
+	{
+		MeshHandle mesh;
+		Mat4 model;
+		uint32 materialId;
+		uint32 objectId;
+		uint32 boneBase = 0;
+	};
+}
+
+TEST_CASE("DrawList sorts by material, then mesh, then front to back", "[engine][rendering][drawlist]")
+{
+	DrawList list;
+	list.Reset(Vector3(0.0f));
+
+	auto at = [](float z) { return glm::translate(Mat4(1.0f), Vector3(0.0f, 0.0f, z)); };
+
+	list.Add(MakeMesh(100), at(30.0f), 2, 1);
+	list.Add(MakeMesh(0), at(5.0f), 1, 2);
+	list.Add(MakeMesh(100), at(10.0f), 1, 3);
+	list.Add(MakeMesh(0), at(1.0f), 1, 4);
+	list.Add(MakeMesh(100), at(2.0f), 2, 5);
+	list.Sort();
+
+	const TArray<uint32>& order = list.GetSortedIndices();
+	REQUIRE(order.Num() == 5);
+
+	uint32 objectIds[5];
+	for (int32 i = 0; i < 5; ++i)
+		objectIds[i] = list.GetItems()[order[i]].ObjectId;
+
+	REQUIRE(objectIds[0] == 4); // material 1, mesh 0, nearest
+	REQUIRE(objectIds[1] == 2);
+	REQUIRE(objectIds[2] == 3); // material 1, mesh 100
+	REQUIRE(objectIds[3] == 5); // material 2, mesh 100, nearest
+	REQUIRE(objectIds[4] == 1);
+
+	// Transforms are never moved by the sort.
+	REQUIRE(list.GetTransforms()[0][3].z == Catch::Approx(30.0f));
+}
+
+TEST_CASE("DrawList radix sort matches a comparison sort", "[engine][rendering][drawlist]")
+{
+	constexpr uint32 DrawCount = 10000;
+
+	std::mt19937 rng(42u);
+	std::uniform_int_distribution<uint32> material(0, 31);
+	std::uniform_int_distribution<uint32> mesh(0, 200);
+	std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+
+	DrawList list;
+	list.Reset(Vector3(0.0f));
+	for (uint32 i = 0; i < DrawCount; ++i)
+	{
+		const Mat4 model = glm::translate(Mat4(1.0f), Vector3(coord(rng), coord(rng), coord(rng)));
+		list.Add(MakeMesh(mesh(rng) * 36), model, material(rng), i);
+	}
+
+	TArray<uint64> expected = list.GetSortedKeys();
+	std::stable_sort(expected.Data(), expected.Data() + expected.Num());
+
+	list.Sort();
+
+	const TArray<uint64>& keys = list.GetSortedKeys();
+	const TArray<uint32>& order = list.GetSortedIndices();
+	bool bKeysMatch = true;
+	bool bStable = true;
+	for (uint32 i = 0; i < DrawCount; ++i)
+	{
+		bKeysMatch = bKeysMatch && keys[i] == expected[i];
+		if (i > 0 && keys[i] == keys[i - 1])
+			bStable = bStable && order[i] > order[i - 1];
+	}
+	REQUIRE(bKeysMatch);
+	REQUIRE(bStable);
+}
+
+TEST_CASE("Draw sort benchmark at PerFrameDrawCap (Non-assertive)", "[benchmark]")
+{
+	constexpr uint32 DrawCount = static_cast<uint32>(OpenGLRenderAPI::PerFrameDrawCap);
+	constexpr int32 Iterations = 20;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	std::mt19937 rng(7u);
+	std::uniform_int_distribution<uint32> material(0, 63);
+	std::uniform_int_distribution<uint32> mesh(0, 511);
+	std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+
+	TArray<MeshHandle> meshes;
+	TArray<uint32> materials;
+	TArray<Mat4> models;
+	for (uint32 i = 0; i < DrawCount; ++i)
+	{
+		meshes.Add(MakeMesh(mesh(rng) * 36));
+		materials.Add(material(rng));
+		models.Add(glm::translate(Mat4(1.0f), Vector3(coord(rng), 0.0f, coord(rng))));
+	}
+
+	// Both paths end with the model matrices gathered in draw order, which is
+	// what the MDI upload needs.
+	TArray<Mat4> gathered;
+	gathered.Reserve(DrawCount);
+
+	double fatMs = 0.0;
+	{
+		TArray<FatPendingDraw> pending;
+		pending.Reserve(DrawCount);
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (int32 iter = 0; iter < Iterations; ++iter)
+		{
+			pending.Clear();
+			for (uint32 i = 0; i < DrawCount; ++i)
+			{
+				FatPendingDraw d;
+				d.mesh = meshes[i];
+				d.model = models[i];
+				d.materialId = materials[i];
+				d.objectId = i;
+				pending.Add(d);
+			}
+
+			std::sort(pending.Data(), pending.Data() + pending.Num(),
+				[](const FatPendingDraw& a, const FatPendingDraw& b) { return a.materialId < b.materialId; });
+
+			gathered.Clear();
+			for (uint32 i = 0; i < DrawCount; ++i)
+				gathered.Add(pending[i].model);
+		}
+		const auto end = std::chrono::high_resolution_clock::now();
+		fatMs = std::chrono::duration<double, std::milli>(end - start).count() / Iterations;
+	}
+
+	double keyMs = 0.0;
+	{
+		DrawList list;
+		list.Reserve(DrawCount);
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (int32 iter = 0; iter < Iterations; ++iter)
+		{
+			list.Reset(Vector3(0.0f));
+			for (uint32 i = 0; i < DrawCount; ++i)
+				list.Add(meshes[i], models[i], materials[i], i);
+
+			list.Sort();
+
+			const uint32* order = list.GetSortedIndices().Data();
+			const Mat4* transforms = list.GetTransforms().Data();
+			gathered.Clear();
+			for (uint32 i = 0; i < DrawCount; ++i)
+				gathered.Add(transforms[order[i]]);
+		}
+		const auto end = std::chrono::high_resolution_clock::now();
+		keyMs = std::chrono::duration<double, std::milli>(end - start).count() / Iterations;
+
+		const TArray<uint32>& order = list.GetSortedIndices();
+		bool bGrouped = true;
+		for (uint32 i = 1; i < DrawCount; ++i)
+			bGrouped = bGrouped && list.GetItems()[order[i - 1]].MaterialId <= list.GetItems()[order[i]].MaterialId;
+		REQUIRE(bGrouped);
+	}
+
+	std::cout << "Fat PendingDraw std::sort (ms/frame): " << fatMs << "\n";
+	std::cout << "Radix-sorted draw keys (ms/frame): " << keyMs << "\n";
+	std::cout << "Speedup: " << (keyMs > 0.0 ? fatMs / keyMs : 0.0) << "\n";
+}
@@ -0,0 +1,147 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Rendering/Bounds.h"
+#include "Engine/Rendering/Buffers.h"
+#include "Engine/Rendering/CameraView.h"
+#include "Engine/Rendering/Frustum.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	CameraView MakeTestCamera()
+	{
+		// At the origin looking down -Z, 60 degree vertical FOV.
+		CameraView camera{};
+		camera.Position = Vector3(0.0f);
+		camera.FOV = 60.0f;
+		camera.View = glm::lookAt(camera.Position, Vector3(0.0f, 0.0f, -1.0f), Vector3(0.0f, 1.0f, 0.0f));
+		camera.Projection = glm::perspective(glm::radians(camera.FOV), 16.0f / 9.0f, 0.1f, 500.0f);
+		return camera;
+	}
+
+	Vertex MakeVertex(const Vector3& position, uint8 bone)
+	{
+		Vertex v{};
+		v.Position = position;
+		v.BoneIndex[0] = bone;
+		v.BoneWeight[0] = 1.0f;
+		return v;
+	}
+}
+
+TEST_CASE("Mesh bounds are fitted to vertices and follow the model matrix", "[engine][rendering][culling]")
+{
+	TArray<Vertex> vertices;
+	vertices.Add(MakeVertex(Vector3(-1.0f, 0.0f, -2.0f), 0));
+	vertices.Add(MakeVertex(Vector3(3.0f, 2.0f, 2.0f), 0));
+
+	const BoxSphereBounds local = BoxSphereBounds::FromVertices(vertices);
+	REQUIRE(local.IsValid());
+	REQUIRE(local.Center.x == Catch::Approx(1.0f));
+	REQUIRE(local.Extents.z == Catch::Approx(2.0f));
+	REQUIRE(local.Radius == Catch::Approx(FMath::length(Vector3(2.0f, 1.0f, 2.0f))));
+
+	Mat4 model = glm::translate(Mat4(1.0f), Vector3(10.0f, 0.0f, 0.0f));
+	model = glm::scale(model, Vector3(2.0f));
+	const BoxSphereBounds world = local.TransformBy(model);
+	REQUIRE(world.Center.x == Catch::Approx(12.0f));
+	REQUIRE(world.Extents.x == Catch::Approx(4.0f));
+	REQUIRE(world.Radius == Catch::Approx(local.Radius * 2.0f));
+
+	REQUIRE_FALSE(BoxSphereBounds::FromVertices(TArray<Vertex>{}).IsValid());
+}
+
+TEST_CASE("View frustum keeps on-screen bounds and rejects off-screen ones", "[engine][rendering][culling]")
+{
+	const ViewFrustum frustum = ViewFrustum::FromCamera(MakeTestCamera());
+	const BoxSphereBounds unitBox = BoxSphereBounds::FromMinMax(Vector3(-0.5f), Vector3(0.5f));
+
+	auto at = [](const Vector3& p) { return glm::translate(Mat4(1.0f), p); };
+
+	CullingStats stats;
+	REQUIRE(frustum.IsVisible(unitBox, at(Vector3(0.0f, 0.0f, -10.0f)), stats));   // straight ahead
+	REQUIRE_FALSE(frustum.IsVisible(unitBox, at(Vector3(0.0f, 0.0f, 10.0f)), stats)); // behind
+	REQUIRE_FALSE(frustum.IsVisible(unitBox, at(Vector3(-100.0f, 0.0f, -10.0f)), stats)); // far left
+	REQUIRE_FALSE(frustum.IsVisible(unitBox, at(Vector3(0.0f, 0.0f, -600.0f)), stats)); // past far plane
+	REQUIRE(frustum.IsVisible(unitBox, at(Vector3(0.0f, 0.0f, -0.3f)), stats));     // straddles near plane
+
+	REQUIRE(stats.Visible == 2);
+	REQUIRE(stats.Culled == 3);
+
+	// Empty bounds (asset without vertices yet) are never culled.
+	REQUIRE(frustum.IsVisible(BoxSphereBounds{}, at(Vector3(0.0f, 0.0f, 10.0f)), stats));
+}
+
+TEST_CASE("Skinned bounds follow the posed skin palette", "[engine][rendering][culling][animation]")
+{
+	TArray<Vertex> vertices;
+	vertices.Add(MakeVertex(Vector3(-1.0f, 0.0f, 0.0f), 0));
+	vertices.Add(MakeVertex(Vector3(0.0f, 0.0f, 0.0f), 0));
+	vertices.Add(MakeVertex(Vector3(0.0f, 0.0f, 0.0f), 1));
+	vertices.Add(MakeVertex(Vector3(1.0f, 0.0f, 0.0f), 1));
+
+	const BoxSphereBounds bindBounds = BoxSphereBounds::FromVertices(vertices);
+	TArray<BoxSphereBounds> boneBounds;
+	SkinnedBounds::BuildBoneBounds(vertices, boneBounds);
+	REQUIRE(boneBounds.Num() == 2);
+
+	// Bone 1 swings its vertices 20 units up; the bind box would miss them.
+	TArray<Mat4> palette;
+	palette.Add(Mat4(1.0f));
+	palette.Add(glm::translate(Mat4(1.0f), Vector3(0.0f, 20.0f, 0.0f)));
+
+	const BoxSphereBounds posed = SkinnedBounds::ComputePosedBounds(boneBounds, palette, bindBounds);
+	REQUIRE(posed.GetMax().y == Catch::Approx(20.0f));
+	REQUIRE(posed.GetMin().x == Catch::Approx(-1.0f));
+	REQUIRE(posed.GetMax().x == Catch::Approx(1.0f));
+
+	// No palette yet: fall back to the bind pose.
+	const BoxSphereBounds fallback = SkinnedBounds::ComputePosedBounds(boneBounds, TArray<Mat4>{}, bindBounds);
+	REQUIRE(fallback.GetMax().y == Catch::Approx(bindBounds.GetMax().y));
+}
+
+TEST_CASE("Frustum culling over an open level (Non-assertive timing)", "[engine][rendering][culling][benchmark]")
+{
+	constexpr int32 DrawCount = 65536;
+	constexpr int32 Iterations = 20;
+
+	const ViewFrustum frustum = ViewFrustum::FromCamera(MakeTestCamera());
+	const BoxSphereBounds meshBounds = BoxSphereBounds::FromMinMax(Vector3(-1.0f), Vector3(1.0f));
+
+	// Objects scattered on a 800x800 plane around the camera, like an open level.
+	std::mt19937 rng(1234u);
+	std::uniform_real_distribution<float> coord(-400.0f, 400.0f);
+	TArray<Mat4> models;
+	models.Reserve(DrawCount);
+	for (int32 i = 0; i < DrawCount; ++i)
+		models.Add(glm::translate(Mat4(1.0f), Vector3(coord(rng), coord(rng) * 0.01f, coord(rng))));
+
+	uint32 scalarVisible = 0;
+	for (int32 i = 0; i < DrawCount; ++i)
+	{
+		if (frustum.IntersectsScalar(meshBounds.TransformBy(models[i])))
+			++scalarVisible;
+	}
+
+	CullingStats stats;
+	const auto start = std::chrono::high_resolution_clock::now();
+	for (int32 iter = 0; iter < Iterations; ++iter)
+	{
+		stats.Reset();
+		for (int32 i = 0; i < DrawCount; ++i)
+			frustum.IsVisible(meshBounds, models[i], stats);
+	}
+	const auto end = std::chrono::high_resolution_clock::now();
+	const double msPerFrame = std::chrono::duration<double, std::milli>(end - start).count() / Iterations;
+
+	REQUIRE(stats.GetTested() == static_cast<uint32>(DrawCount));
+	REQUIRE(stats.Visible == scalarVisible);
+	REQUIRE(stats.Culled > stats.Visible);
+
+	std::cout << "Culling " << DrawCount << " draws: " << msPerFrame << " ms/frame, "
+	          << stats.Visible << " visible, " << stats.Culled << " culled\n";
+}
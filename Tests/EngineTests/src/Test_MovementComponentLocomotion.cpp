@@ -17,7 +17,9 @@
 #include "Engine/Framework/ModuleManager.h"
 #undef private
 
+#include <chrono>
 #include <functional>
+#include <iostream>
 #include <sstream>
 #include <vector>
 
@@ -1422,3 +1424,178 @@ TEST_CASE("CharacterMovement world simulation chains step-up into ramp traversal
     REQUIRE(movement.GetState().bGrounded);
     REQUIRE(movement.GetState().Mode == MovementMode::Walking);
 }
+
+namespace
+{
+    struct CharacterLaneResult
+    {
+        Vector3 Position = Vector3(0.0f);
+        Vector3 Velocity = Vector3(0.0f);
+        float Yaw = 0.0f;
+        bool bGrounded = false;
+        MovementMode Mode = MovementMode::Falling;
+    };
+
+    // One character per lane walks over a low step and up a ramp; lanes are far
+    // enough apart that the characters never touch each other.
+    std::vector<CharacterLaneResult> SimulateCharacterLanes(const bool bParallelMovement, const int32 laneCount)
+    {
+        WorldSimulationContext context;
+        SpawnStaticBox(context, Vector3(0.0f, 0.0f, -0.5f), Vector3(20.0f, 20.0f, 0.5f));
+        SpawnStaticBox(context, Vector3(1.2f, 0.0f, 0.04f), Vector3(1.2f, 16.0f, 0.04f));
+
+        const Vector3 rampHalfExtent(6.0f, 16.0f, 0.12f);
+        const glm::quat rampRotation = RotationFromDegrees(Vector3(0.0f, -10.0f, 0.0f));
+        const Vector3 rampCenter = ComputeRampCenterFromLowPoint(Vector3(2.4f, 0.0f, 0.08f), rampHalfExtent, rampRotation);
+        SpawnStaticBox(context, rampCenter, rampHalfExtent, rampRotation);
+
+        std::vector<Character*> characters;
+        for (int32 lane = 0; lane < laneCount; ++lane)
+        {
+            const float y = (static_cast<float>(lane) - static_cast<float>(laneCount - 1) * 0.5f) * 1.5f;
+            characters.push_back(&SpawnCharacter(context, Vector3(-1.5f, y, 1.02f)));
+        }
+
+        context.BeginPlay();
+        context.WarmUpPhysics();
+
+        for (Character* character : characters)
+        {
+            CharacterMovementComponent& movement = GetMovement(*character);
+            ConfigureMovementForTests(movement);
+            movement.SetParallelMovement(bParallelMovement);
+        }
+
+        for (int32 frame = 0; frame < 63; ++frame)
+        {
+            for (size_t lane = 0; lane < characters.size(); ++lane)
+            {
+                // Settle first, then walk with a slight per-lane heading.
+                if (frame >= 8)
+                    characters[lane]->AddMovementInput(Vector3(1.0f, (lane % 2 == 0) ? 0.05f : -0.05f, 0.0f));
+            }
+
+            context.Tick(kWorldSimulationDt);
+        }
+
+        std::vector<CharacterLaneResult> results;
+        for (Character* character : characters)
+        {
+            const CharacterMovementComponent& movement = GetMovement(*character);
+            CharacterLaneResult& result = results.emplace_back();
+            result.Position = character->GetActorLocation();
+            result.Velocity = movement.GetState().Velocity;
+            result.Yaw = character->GetActorRotationEuler().z;
+            result.bGrounded = movement.GetState().bGrounded;
+            result.Mode = movement.GetState().Mode;
+        }
+        return results;
+    }
+}
+
+TEST_CASE("CharacterMovement parallel movement matches serial movement", "[engine][movement][locomotion][character][world][parallel]")
+{
+    constexpr int32 kLanes = 10;
+    const std::vector<CharacterLaneResult> serial = SimulateCharacterLanes(false, kLanes);
+    const std::vector<CharacterLaneResult> parallel = SimulateCharacterLanes(true, kLanes);
+    const std::vector<CharacterLaneResult> parallelAgain = SimulateCharacterLanes(true, kLanes);
+
+    REQUIRE(parallel.size() == serial.size());
+    for (size_t lane = 0; lane < serial.size(); ++lane)
+    {
+        // Same expectations as the single-character step-ramp simulation.
+        REQUIRE(parallel[lane].Position.x > 2.0f);
+        REQUIRE(parallel[lane].Position.z > 1.04f);
+        REQUIRE(parallel[lane].bGrounded);
+        REQUIRE(parallel[lane].Mode == MovementMode::Walking);
+
+        REQUIRE(parallel[lane].Position.x == Catch::Approx(serial[lane].Position.x).margin(1.0e-4f));
+        REQUIRE(parallel[lane].Position.y == Catch::Approx(serial[lane].Position.y).margin(1.0e-4f));
+        REQUIRE(parallel[lane].Position.z == Catch::Approx(serial[lane].Position.z).margin(1.0e-4f));
+        REQUIRE(parallel[lane].Velocity.x == Catch::Approx(serial[lane].Velocity.x).margin(1.0e-4f));
+        REQUIRE(parallel[lane].Yaw == Catch::Approx(serial[lane].Yaw).margin(1.0e-3f));
+        REQUIRE(parallel[lane].Mode == serial[lane].Mode);
+
+        // Job scheduling never changes the result.
+        REQUIRE(parallelAgain[lane].Position == parallel[lane].Position);
+        REQUIRE(parallelAgain[lane].Velocity == parallel[lane].Velocity);
+        REQUIRE(parallelAgain[lane].Yaw == parallel[lane].Yaw);
+    }
+}
+
+TEST_CASE("CharacterMovement parallel movement writes the pose back within the tick group", "[engine][movement][locomotion][character][world][parallel]")
+{
+    WorldSimulationContext context;
+    SpawnStaticBox(context, Vector3(0.0f, 0.0f, -0.5f), Vector3(20.0f, 20.0f, 0.5f));
+
+    Character& character = SpawnCharacter(context, Vector3(-5.0f, 0.0f, 1.02f));
+    context.BeginPlay();
+    context.WarmUpPhysics();
+
+    CharacterMovementComponent& movement = GetMovement(character);
+    ConfigureMovementForTests(movement);
+    movement.SetParallelMovement(true);
+    SettleCharacter(context, character);
+
+    context.TestScene.PrepareTick();
+    const Vector3 before = character.GetActorLocation();
+    character.AddMovementInput(Vector3(1.0f, 0.0f, 0.0f));
+    context.TestScene.TickGroup(ActorTickGroup::PrePhysics, kWorldSimulationDt);
+    context.TestScene.TickGroup(ActorTickGroup::PostPhysics, kWorldSimulationDt);
+    context.TestScene.TickGroup(ActorTickGroup::PostUpdate, kWorldSimulationDt);
+    context.TestScene.FinalizeTick();
+
+    REQUIRE(character.GetActorLocation().x > before.x);
+    REQUIRE(movement.GetState().Velocity.x > 0.0f);
+    REQUIRE(movement.HasMovementInputThisFrame());
+}
+
+TEST_CASE("CharacterMovement benchmark, 300 NPCs serial vs parallel (Non-assertive)", "[benchmark]")
+{
+    constexpr int32 kSide = 20;
+    constexpr int32 kCount = 300;
+    constexpr int32 kFrames = 60;
+
+#ifndef NDEBUG
+    std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+    auto run = [&](const bool bParallelMovement) -> double
+    {
+        WorldSimulationContext context;
+        SpawnStaticBox(context, Vector3(0.0f, 0.0f, -0.5f), Vector3(60.0f, 60.0f, 0.5f));
+
+        std::vector<Character*> characters;
+        for (int32 i = 0; i < kCount; ++i)
+        {
+            const float x = static_cast<float>(i % kSide) * 2.0f - 20.0f;
+            const float y = static_cast<float>(i / kSide) * 2.0f - 15.0f;
+            characters.push_back(&SpawnCharacter(context, Vector3(x, y, 1.02f)));
+        }
+
+        context.BeginPlay();
+        context.WarmUpPhysics();
+        for (Character* character : characters)
+        {
+            ConfigureMovementForTests(GetMovement(*character));
+            GetMovement(*character).SetParallelMovement(bParallelMovement);
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (int32 frame = 0; frame < kFrames; ++frame)
+        {
+            for (Character* character : characters)
+                character->AddMovementInput(Vector3(1.0f, 0.0f, 0.0f));
+            context.Tick(kWorldSimulationDt);
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<double, std::milli>(end - start).count() / kFrames;
+    };
+
+    const double serialMs = run(false);
+    const double parallelMs = run(true);
+
+    std::cout << "World tick with " << kCount << " walking NPCs, serial movement (ms/frame): " << serialMs << "\n";
+    std::cout << "Same with parallel movement (ms/frame): " << parallelMs << "\n";
+}
@@ -0,0 +1,117 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+TEST_CASE("Sleeping bodies are not written back", "[engine][physics][sync]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SpawnBox(scene, Vector3(0.0f), Vector3(5.0f, 5.0f, 0.5f), ERBBodyType::Static);
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 1.5f), Vector3(0.5f), ERBBodyType::Dynamic);
+
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetActiveBodyCount() == 1);
+
+	StepFrames(physics, scene, 300);
+	REQUIRE(physics.GetActiveBodyCount() == 0);
+	REQUIRE(crate.GetWorldPosition().z == Catch::Approx(1.0f).margin(0.05f));
+
+	// A sleeping body's component is left alone by the sync.
+	const Vector3 moved(3.0f, 0.0f, 1.0f);
+	crate.SetWorldPosition(moved);
+	physics.Step(scene, kFixedDt);
+	REQUIRE(crate.GetWorldPosition().x == Catch::Approx(moved.x));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Kinematic bodies follow their component and stop on arrival", "[engine][physics][sync]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& platform = SpawnBox(scene, Vector3(2.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Kinematic);
+	physics.Step(scene, kFixedDt);
+
+	const Vector3 start(0.0f);
+	const Vector3 end(10.0f, 0.0f, 0.0f);
+	TraceQueryParams params{};
+	TraceHit hit{};
+	REQUIRE(physics.LineTraceSingle(start, end, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(1.5f).margin(1e-3f));
+
+	platform.SetWorldPosition(Vector3(4.0f, 0.0f, 0.0f));
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.LineTraceSingle(start, end, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(3.5f).margin(1e-3f));
+
+	// No further input: the body must not keep its velocity.
+	StepFrames(physics, scene, 10);
+	REQUIRE(physics.LineTraceSingle(start, end, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(3.5f).margin(1e-3f));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Bodies whose component vanished are released by the sync", "[engine][physics][sync]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 5.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+	BoxComponent& platform = SpawnBox(scene, Vector3(3.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Kinematic);
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetBodyCount() == 2);
+
+	// Without a World, actors cannot reach the physics system on removal.
+	REQUIRE(crate.GetOwner()->RemoveObjectComponentInstance(&crate));
+	REQUIRE(platform.GetOwner()->RemoveObjectComponentInstance(&platform));
+
+	StepFrames(physics, scene, 2);
+	REQUIRE(physics.GetBodyCount() == 0);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Physics benchmark, mostly sleeping dynamic bodies (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 Side = 64;
+	constexpr int32 Frames = 120;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(200.0f, 200.0f, 0.5f), ERBBodyType::Static);
+	for (int32 i = 0; i < Side * Side; ++i)
+	{
+		const float x = static_cast<float>(i % Side) * 3.0f - 96.0f;
+		const float y = static_cast<float>(i / Side) * 3.0f - 96.0f;
+		SpawnBox(scene, Vector3(x, y, 0.5f), Vector3(0.5f), ERBBodyType::Dynamic);
+	}
+
+	// Let the grid settle and fall asleep.
+	StepFrames(physics, scene, 300);
+
+	const auto start = std::chrono::high_resolution_clock::now();
+	StepFrames(physics, scene, Frames);
+	const auto end = std::chrono::high_resolution_clock::now();
+	const double stepMs = std::chrono::duration<double, std::milli>(end - start).count() / Frames;
+
+	std::cout << "Physics step, " << Side * Side << " dynamic bodies, " << physics.GetActiveBodyCount()
+			  << " awake (ms/step): " << stepMs << "\n";
+
+	physics.Shutdown();
+}
@@ -0,0 +1,131 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+TEST_CASE("Registered primitives get bodies in one batch on the next step", "[engine][physics][bodies]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& floor = SpawnBox(scene, Vector3(0.0f), Vector3(0.5f), ERBBodyType::Static);
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 5.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+	REQUIRE(scene.GetPendingPhysicsBodies().Num() == 2);
+	REQUIRE_FALSE(crate.IsBodyCreated());
+
+	physics.Step(scene, kFixedDt);
+	REQUIRE(scene.GetPendingPhysicsBodies().IsEmpty());
+	REQUIRE(physics.GetBodyCount() == 2);
+	REQUIRE(floor.IsBodyCreated());
+	REQUIRE(crate.IsBodyCreated());
+
+	// Dynamic bodies were added awake, static ones are left where they are.
+	StepFrames(physics, scene, 10);
+	REQUIRE(crate.GetWorldPosition().z < 5.0f);
+	REQUIRE(floor.GetWorldPosition().z == 0.0f);
+	REQUIRE(physics.GetBodyCount() == 2);
+
+	// Late spawns join on the following step.
+	SpawnBox(scene, Vector3(3.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Kinematic);
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetBodyCount() == 3);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Destroyed bodies leave traces at once and the simulation next step", "[engine][physics][bodies]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& nearBox = SpawnBox(scene, Vector3(2.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Static);
+	SpawnBox(scene, Vector3(5.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Static);
+	physics.Step(scene, kFixedDt);
+
+	TraceQueryParams params{};
+	TraceHit hit{};
+	REQUIRE(physics.LineTraceSingle(Vector3(0.0f), Vector3(10.0f, 0.0f, 0.0f), hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(1.5f).margin(1e-3f));
+
+	physics.DestroyBodyForComponent(nearBox);
+	REQUIRE_FALSE(nearBox.IsBodyCreated());
+	REQUIRE(physics.GetBodyCount() == 2);
+	REQUIRE(physics.LineTraceSingle(Vector3(0.0f), Vector3(10.0f, 0.0f, 0.0f), hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(4.5f).margin(1e-3f));
+
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetBodyCount() == 1);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Primitives removed before the step never get a body", "[engine][physics][bodies]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& box = SpawnBox(scene, Vector3(0.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+	REQUIRE(box.GetOwner()->RemoveObjectComponentInstance(&box));
+
+	Actor& doomed = scene.SpawnActor<Actor>();
+	doomed.AddObjectComponent<SphereComponent>();
+	scene.DestroyActor(&doomed);
+
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetBodyCount() == 0);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Physics benchmark, bulk body creation and removal (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 BodyCount = 8192;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	TArray<BoxComponent*> boxes;
+	boxes.Reserve(BodyCount);
+	for (int32 i = 0; i < BodyCount; ++i)
+	{
+		const float x = static_cast<float>(i % 128) * 3.0f;
+		const float y = static_cast<float>(i / 128) * 3.0f;
+		const ERBBodyType type = (i % 16) == 0 ? ERBBodyType::Dynamic : ERBBodyType::Static;
+		boxes.Add(&SpawnBox(scene, Vector3(x, y, 0.5f), Vector3(0.5f), type));
+	}
+
+	const auto createStart = std::chrono::high_resolution_clock::now();
+	physics.Step(scene, kFixedDt);
+	const auto createEnd = std::chrono::high_resolution_clock::now();
+	REQUIRE(physics.GetBodyCount() == static_cast<uint32>(BodyCount));
+
+	const auto stepStart = std::chrono::high_resolution_clock::now();
+	physics.Step(scene, kFixedDt);
+	const auto stepEnd = std::chrono::high_resolution_clock::now();
+
+	for (BoxComponent* box : boxes)
+		physics.DestroyBodyForComponent(*box);
+
+	const auto removeStart = std::chrono::high_resolution_clock::now();
+	physics.Step(scene, kFixedDt);
+	const auto removeEnd = std::chrono::high_resolution_clock::now();
+	REQUIRE(physics.GetBodyCount() == 0);
+
+	const auto ms = [](auto start, auto end) { return std::chrono::duration<double, std::milli>(end - start).count(); };
+	std::cout << "First step creating " << BodyCount << " bodies (ms): " << ms(createStart, createEnd) << "\n";
+	std::cout << "Steady step (ms): " << ms(stepStart, stepEnd) << "\n";
+	std::cout << "Step removing " << BodyCount << " bodies (ms): " << ms(removeStart, removeEnd) << "\n";
+
+	physics.Shutdown();
+}
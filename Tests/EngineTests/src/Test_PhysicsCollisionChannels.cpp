@@ -0,0 +1,145 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	float DropPawnOnFloor(bool bPawnBlocksWorld)
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.Init();
+		physics.GetCollisionResponses().SetResponse(CollisionChannel::Pawn, CollisionChannel::WorldStatic, bPawnBlocksWorld);
+
+		SpawnBox(scene, Vector3(0.0f), Vector3(5.0f, 5.0f, 0.5f), ERBBodyType::Static, CollisionChannel::WorldStatic);
+		SphereComponent& sphere = SpawnSphere(scene, Vector3(0.0f, 0.0f, 3.0f), 0.5f, ERBBodyType::Dynamic, CollisionChannel::Pawn);
+
+		StepFrames(physics, scene, 120);
+
+		const float z = sphere.GetWorldPosition().z;
+		physics.Shutdown();
+		return z;
+	}
+}
+
+TEST_CASE("Collision response matrix is symmetric and Any always responds", "[engine][physics][channels]")
+{
+	CollisionResponseMatrix responses;
+	REQUIRE(responses.Responds(CollisionChannel::Pawn, CollisionChannel::WorldStatic));
+	REQUIRE_FALSE(responses.Responds(CollisionChannel::Camera, CollisionChannel::Pawn));
+	REQUIRE_FALSE(responses.Responds(CollisionChannel::Pawn, CollisionChannel::Camera));
+
+	responses.SetResponse(CollisionChannel::Pawn, CollisionChannel::WorldDynamic, false);
+	REQUIRE_FALSE(responses.Responds(CollisionChannel::WorldDynamic, CollisionChannel::Pawn));
+	REQUIRE(responses.Responds(CollisionChannel::Any, CollisionChannel::Pawn));
+
+	responses.SetAllResponses(CollisionChannel::Trigger, false);
+	REQUIRE_FALSE(responses.Responds(CollisionChannel::WorldStatic, CollisionChannel::Trigger));
+	REQUIRE_FALSE(responses.Responds(CollisionChannel::Trigger, CollisionChannel::Trigger));
+}
+
+TEST_CASE("Simulation honors the channel matrix", "[engine][physics][channels]")
+{
+	// Resting on the floor top (z = 0.5) with a 0.5 radius.
+	REQUIRE(DropPawnOnFloor(true) == Catch::Approx(1.0f).margin(0.05f));
+	REQUIRE(DropPawnOnFloor(false) < -1.0f);
+}
+
+TEST_CASE("Traces respond per channel against static and moving bodies", "[engine][physics][channels]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SpawnBox(scene, Vector3(5.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Static, CollisionChannel::WorldStatic);
+	SphereComponent& pawn = SpawnSphere(scene, Vector3(2.0f, 0.0f, 0.0f), 0.5f, ERBBodyType::Dynamic, CollisionChannel::Pawn);
+	pawn.BodyType = ERBBodyType::Kinematic;
+	physics.Step(scene, kFixedDt);
+
+	const Vector3 start(0.0f, 0.0f, 0.0f);
+	const Vector3 end(10.0f, 0.0f, 0.0f);
+
+	TraceQueryParams params{};
+	TraceHit hit{};
+
+	params.Channel = CollisionChannel::Any;
+	REQUIRE(physics.LineTraceSingle(start, end, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(1.5f).margin(1e-3f));
+
+	// Camera probes skip pawns by default and land on the static box.
+	params.Channel = CollisionChannel::Camera;
+	REQUIRE(physics.LineTraceSingle(start, end, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(4.5f).margin(1e-3f));
+	REQUIRE(physics.SphereTraceSingle(start, end, 0.1f, hit, params));
+	REQUIRE(hit.Distance == Catch::Approx(4.4f).margin(1e-2f));
+
+	physics.GetCollisionResponses().SetResponse(CollisionChannel::Camera, CollisionChannel::WorldStatic, false);
+	REQUIRE_FALSE(physics.LineTraceSingle(start, end, hit, params));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Physics benchmark, static props with a few movers (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 StaticCount = 4096;
+	constexpr int32 MoverCount = 48;
+	constexpr int32 Frames = 120;
+	constexpr int32 RayCount = 4096;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(200.0f, 200.0f, 0.5f), ERBBodyType::Static, CollisionChannel::WorldStatic);
+
+	// A 64 x 64 grid of crates and pillars.
+	for (int32 i = 0; i < StaticCount; ++i)
+	{
+		const float x = static_cast<float>(i % 64) * 6.0f - 190.0f;
+		const float y = static_cast<float>(i / 64) * 6.0f - 190.0f;
+		SpawnBox(scene, Vector3(x, y, 1.0f), Vector3(0.5f, 0.5f, 1.0f), ERBBodyType::Static, CollisionChannel::WorldStatic);
+	}
+
+	std::mt19937 rng(11u);
+	std::uniform_real_distribution<float> coord(-150.0f, 150.0f);
+	for (int32 i = 0; i < MoverCount; ++i)
+		SpawnSphere(scene, Vector3(coord(rng), coord(rng), 4.0f), 0.5f, ERBBodyType::Dynamic, CollisionChannel::Pawn);
+
+	// First step creates every body.
+	physics.Step(scene, kFixedDt);
+
+	const auto stepStart = std::chrono::high_resolution_clock::now();
+	StepFrames(physics, scene, Frames);
+	const auto stepEnd = std::chrono::high_resolution_clock::now();
+	const double stepMs = std::chrono::duration<double, std::milli>(stepEnd - stepStart).count() / Frames;
+
+	TraceQueryParams params{};
+	params.Channel = CollisionChannel::Camera;
+	int32 hits = 0;
+	const auto rayStart = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < RayCount; ++i)
+	{
+		const Vector3 from(coord(rng), coord(rng), 1.0f);
+		TraceHit hit{};
+		if (physics.LineTraceSingle(from, from + Vector3(20.0f, 0.0f, 0.0f), hit, params))
+			++hits;
+	}
+	const auto rayEnd = std::chrono::high_resolution_clock::now();
+	const double rayUs = std::chrono::duration<double, std::micro>(rayEnd - rayStart).count() / RayCount;
+
+	REQUIRE(hits > 0);
+
+	std::cout << "Physics step, " << StaticCount << " static + " << MoverCount << " movers (ms/step): " << stepMs << "\n";
+	std::cout << "Camera-channel ray (us/ray): " << rayUs << "\n";
+
+	physics.Shutdown();
+}
@@ -0,0 +1,126 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+using namespace PhysicsTest;
+
+namespace
+{
+	struct ContactLog
+	{
+		int32 Begins = 0;
+		int32 Persists = 0;
+		int32 Ends = 0;
+		PrimitiveComponent* LastOther = nullptr;
+		Vector3 LastNormal{0.0f};
+
+		void Bind(FPrimitiveContactDelegate& delegate)
+		{
+			delegate.Add([this](PrimitiveComponent&, const PrimitiveContact& contact)
+			{
+				switch (contact.Phase)
+				{
+				case EContactPhase::Begin: ++Begins; break;
+				case EContactPhase::Persist: ++Persists; break;
+				case EContactPhase::End: ++Ends; break;
+				}
+				LastOther = contact.Other;
+				LastNormal = contact.Normal;
+			});
+		}
+	};
+}
+
+TEST_CASE("Hit events begin once, persist while awake and end on removal", "[engine][physics][contacts]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& floor = SpawnBox(scene, Vector3(0.0f), Vector3(5.0f, 5.0f, 0.5f), ERBBodyType::Static);
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 2.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+	crate.bGenerateHitEvents = true;
+
+	ContactLog crateHits;
+	ContactLog floorHits;
+	crateHits.Bind(crate.OnHit);
+	floorHits.Bind(floor.OnHit);
+
+	StepFrames(physics, scene, 60);
+	REQUIRE(crateHits.Begins == 1);
+	REQUIRE(crateHits.Persists > 0);
+	REQUIRE(crateHits.Ends == 0);
+	REQUIRE(crateHits.LastOther == &floor);
+	REQUIRE(crateHits.LastNormal.z < -0.9f); // toward the floor
+
+	// The floor did not opt in.
+	REQUIRE(floorHits.Begins == 0);
+
+	// Once asleep the pair goes quiet.
+	StepFrames(physics, scene, 300);
+	REQUIRE(physics.GetActiveBodyCount() == 0);
+	const int32 persistsAsleep = crateHits.Persists;
+	StepFrames(physics, scene, 10);
+	REQUIRE(crateHits.Persists == persistsAsleep);
+
+	physics.DestroyBodyForComponent(floor);
+	physics.Step(scene, kFixedDt);
+	REQUIRE(crateHits.Ends == 1);
+	REQUIRE(crateHits.Begins == 1);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Triggers report begin and end overlaps to both sides", "[engine][physics][contacts]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& trigger = SpawnBox(scene, Vector3(0.0f), Vector3(2.0f, 2.0f, 0.5f), ERBBodyType::Static);
+	trigger.bIsTrigger = true;
+	SphereComponent& ball = SpawnSphere(scene, Vector3(0.0f, 0.0f, 2.0f), 0.25f, ERBBodyType::Dynamic, CollisionChannel::WorldDynamic);
+
+	ContactLog triggerBegin;
+	ContactLog triggerEnd;
+	ContactLog ballBegin;
+	ContactLog ballEnd;
+	triggerBegin.Bind(trigger.OnBeginOverlap);
+	triggerEnd.Bind(trigger.OnEndOverlap);
+	ballBegin.Bind(ball.OnBeginOverlap);
+	ballEnd.Bind(ball.OnEndOverlap);
+
+	// Falls through the trigger and out the bottom.
+	StepFrames(physics, scene, 90);
+	REQUIRE(ball.GetWorldPosition().z < -1.0f);
+
+	REQUIRE(triggerBegin.Begins == 1);
+	REQUIRE(triggerEnd.Ends == 1);
+	REQUIRE(triggerBegin.LastOther == &ball);
+	REQUIRE(ballBegin.Begins == 1);
+	REQUIRE(ballEnd.Ends == 1);
+	REQUIRE(ballBegin.LastOther == &trigger);
+
+	// Overlaps never persist and never fire hits.
+	REQUIRE(triggerBegin.Persists == 0);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Channels the matrix ignores raise no overlap events", "[engine][physics][contacts]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& trigger = SpawnBox(scene, Vector3(0.0f), Vector3(2.0f, 2.0f, 0.5f), ERBBodyType::Static);
+	trigger.ObjectChannel = CollisionChannel::Trigger;
+	SpawnSphere(scene, Vector3(0.0f, 0.0f, 2.0f), 0.25f, ERBBodyType::Dynamic, CollisionChannel::Camera);
+
+	ContactLog overlaps;
+	overlaps.Bind(trigger.OnBeginOverlap);
+
+	StepFrames(physics, scene, 90);
+	REQUIRE(overlaps.Begins == 0);
+
+	physics.Shutdown();
+}
@@ -1,13 +1,10 @@
 ﻿#include "catch_amalgamated.hpp"
-#include "Engine/Scene/Scene.h"
-#include "Engine/Scene/Actor.h"
-#include "Engine/Components/Components.h"
-#include "Engine/Physics/PhysicsSystem.h"
+#include "PhysicsTestHelpers.h"
+
+using namespace PhysicsTest;
 
 namespace
 {
-	constexpr float kFixedDt = 1.0f / 60.0f;
-
 	bool NearlyEqual(const Vector3& a, const Vector3& b, float eps = 1e-4f)
 	{
 		return std::abs(a.x - b.x) <= eps
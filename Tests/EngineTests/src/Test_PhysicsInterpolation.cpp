@@ -0,0 +1,134 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	constexpr float kPhysicsDt = 1.0f / 30.0f;
+	constexpr float kFrameDt = 1.0f / 120.0f;
+
+	Vector3 RenderPosition(const SceneComponent& component)
+	{
+		return Vector3(component.GetRenderTransform()[3]);
+	}
+}
+
+TEST_CASE("Rendered transforms blend between the last two physics steps", "[engine][physics][interpolation]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	physics.SetFixedDeltaTime(kPhysicsDt);
+
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 10.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+	auto& mesh = crate.GetOwner()->AddObjectComponent<SceneComponent>();
+	mesh.AttachTo(&crate, false);
+	mesh.SetPosition(Vector3(0.0f, 0.0f, 1.0f));
+
+	// Let the crate pick up speed so consecutive steps are far apart.
+	for (int32 frame = 0; frame < 10; ++frame)
+		physics.Step(scene, kPhysicsDt);
+	const float previousZ = crate.GetWorldPosition().z;
+	physics.Step(scene, kPhysicsDt);
+	const float currentZ = crate.GetWorldPosition().z;
+	REQUIRE(currentZ < previousZ - 0.1f);
+
+	// Each render frame is a quarter step; only the drawn pose moves.
+	for (int32 quarter = 1; quarter < 4; ++quarter)
+	{
+		physics.Step(scene, kFrameDt);
+		REQUIRE(physics.GetLastSubstepCount() == 0);
+
+		const float alpha = physics.GetInterpolationAlpha();
+		REQUIRE(alpha == Catch::Approx(0.25f * quarter).margin(1e-3f));
+		REQUIRE(crate.GetWorldPosition().z == currentZ);
+
+		const float expectedZ = previousZ + (currentZ - previousZ) * alpha;
+		REQUIRE(RenderPosition(crate).z == Catch::Approx(expectedZ).margin(1e-4f));
+		REQUIRE(RenderPosition(mesh).z == Catch::Approx(expectedZ + 1.0f).margin(1e-4f));
+		REQUIRE(mesh.GetWorldPosition().z == Catch::Approx(currentZ + 1.0f).margin(1e-4f));
+	}
+
+	// Turning it off draws the simulated pose again.
+	physics.SetInterpolation(false);
+	physics.Step(scene, kFrameDt);
+	REQUIRE_FALSE(crate.HasRenderOffset());
+	REQUIRE(RenderPosition(mesh).z == Catch::Approx(mesh.GetWorldPosition().z));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Bodies that fall asleep or go away stop being interpolated", "[engine][physics][interpolation]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	physics.SetFixedDeltaTime(kPhysicsDt);
+
+	SpawnBox(scene, Vector3(0.0f), Vector3(5.0f, 5.0f, 0.5f), ERBBodyType::Static);
+	BoxComponent& crate = SpawnBox(scene, Vector3(0.0f, 0.0f, 1.5f), Vector3(0.5f), ERBBodyType::Dynamic);
+	BoxComponent& ball = SpawnBox(scene, Vector3(4.0f, 0.0f, 5.0f), Vector3(0.25f), ERBBodyType::Dynamic);
+
+	physics.Step(scene, kPhysicsDt);
+	physics.Step(scene, kPhysicsDt * 0.5f);
+	REQUIRE(crate.HasRenderOffset());
+	REQUIRE(ball.HasRenderOffset());
+
+	physics.DestroyBodyForComponent(ball);
+	REQUIRE_FALSE(ball.HasRenderOffset());
+
+	for (int32 frame = 0; frame < 300 && physics.GetActiveBodyCount() > 0; ++frame)
+		physics.Step(scene, kPhysicsDt);
+	REQUIRE(physics.GetActiveBodyCount() == 0);
+
+	physics.Step(scene, kPhysicsDt);
+	REQUIRE_FALSE(crate.HasRenderOffset());
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Interpolation benchmark, 30 Hz interpolated vs 120 Hz physics (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 Side = 32;
+	constexpr int32 Frames = 144;
+	constexpr float RenderDt = 1.0f / 144.0f;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	auto run = [&](float physicsDt, bool bInterpolate) -> double
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.Init();
+		physics.SetFixedDeltaTime(physicsDt);
+		physics.SetInterpolation(bInterpolate);
+
+		SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(100.0f, 100.0f, 0.5f), ERBBodyType::Static);
+		for (int32 i = 0; i < Side * Side; ++i)
+		{
+			const float x = static_cast<float>(i % Side) * 2.0f - 32.0f;
+			const float y = static_cast<float>(i / Side) * 2.0f - 32.0f;
+			SpawnBox(scene, Vector3(x, y, 3.0f + static_cast<float>(i % 7)), Vector3(0.4f), ERBBodyType::Dynamic);
+		}
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (int32 frame = 0; frame < Frames; ++frame)
+			physics.Step(scene, RenderDt);
+		const auto end = std::chrono::high_resolution_clock::now();
+
+		physics.Shutdown();
+		return std::chrono::duration<double, std::milli>(end - start).count() / Frames;
+	};
+
+	const double fastMs = run(1.0f / 120.0f, false);
+	const double interpolatedMs = run(1.0f / 30.0f, true);
+
+	std::cout << "One second at 144 fps, " << Side * Side << " falling bodies, 120 Hz physics (ms/frame): " << fastMs << "\n";
+	std::cout << "Same at 30 Hz physics with interpolation (ms/frame): " << interpolatedMs << "\n";
+}
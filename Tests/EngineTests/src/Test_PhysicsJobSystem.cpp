@@ -0,0 +1,130 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+#include "Core/MultiThreading/JobSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	// Stacks of boxes on a floor, enough contacts for Jolt to split the step
+	// into many jobs.
+	TArray<BoxComponent*> SpawnStacks(Scene& scene, int32 side, int32 height)
+	{
+		SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(100.0f, 100.0f, 0.5f), ERBBodyType::Static);
+
+		TArray<BoxComponent*> boxes;
+		for (int32 i = 0; i < side * side; ++i)
+		{
+			const float x = static_cast<float>(i % side) * 2.0f - static_cast<float>(side);
+			const float y = static_cast<float>(i / side) * 2.0f - static_cast<float>(side);
+			for (int32 level = 0; level < height; ++level)
+				boxes.Add(&SpawnBox(scene, Vector3(x, y, 0.5f + static_cast<float>(level) * 1.01f), Vector3(0.5f), ERBBodyType::Dynamic));
+		}
+		return boxes;
+	}
+
+	TArray<Vector3> RunStacks(int32 frames)
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.Init();
+
+		TArray<BoxComponent*> boxes = SpawnStacks(scene, 8, 4);
+		StepFrames(physics, scene, frames);
+
+		TArray<Vector3> positions;
+		for (BoxComponent* box : boxes)
+			positions.Add(box->GetWorldPosition());
+
+		physics.Shutdown();
+		return positions;
+	}
+}
+
+TEST_CASE("Physics steps on the shared job system and stays deterministic", "[engine][physics][jobs]")
+{
+	const TArray<Vector3> first = RunStacks(90);
+	const TArray<Vector3> second = RunStacks(90);
+
+	REQUIRE(first.Num() == second.Num());
+	for (MemSize i = 0; i < first.Num(); ++i)
+	{
+		REQUIRE(first[i] == second[i]);
+		// Stacks stay standing; nothing tunnels through the floor.
+		REQUIRE(first[i].z > 0.0f);
+	}
+}
+
+TEST_CASE("Physics steps a small active scene and shuts down right after", "[engine][physics][jobs]")
+{
+	// Few bodies still need the full per-step contact scratch, and pool jobs
+	// queued by the last step may still be releasing when Shutdown runs.
+	for (int32 run = 0; run < 8; ++run)
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.Init();
+
+		SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(10.0f, 10.0f, 0.5f), ERBBodyType::Static);
+		BoxComponent& box = SpawnBox(scene, Vector3(0.0f, 0.0f, 2.0f), Vector3(0.5f), ERBBodyType::Dynamic);
+
+		StepFrames(physics, scene, 60);
+
+		REQUIRE(box.GetWorldPosition().z > 0.0f);
+		REQUIRE(box.GetWorldPosition().z < 2.0f);
+
+		physics.Shutdown();
+	}
+}
+
+TEST_CASE("Physics steps while other work shares the pool", "[engine][physics][jobs]")
+{
+	Rebel::Core::Threading::JobSystem& pool = Rebel::Core::Threading::JobSystem::Get();
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	TArray<BoxComponent*> boxes = SpawnStacks(scene, 8, 2);
+
+	std::atomic<int32> gameplayJobs{0};
+	Rebel::Core::Threading::JobCounter counter;
+	for (int32 i = 0; i < 256; ++i)
+		pool.Schedule([&gameplayJobs]() { gameplayJobs.fetch_add(1, std::memory_order_relaxed); }, &counter);
+
+	StepFrames(physics, scene, 30);
+	pool.Wait(counter);
+
+	REQUIRE(gameplayJobs.load() == 256);
+	for (BoxComponent* box : boxes)
+		REQUIRE(box->GetWorldPosition().z > 0.0f);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Physics benchmark, stacked boxes on the shared job system (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 Frames = 120;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	SpawnStacks(scene, 24, 4);
+
+	const auto start = std::chrono::high_resolution_clock::now();
+	StepFrames(physics, scene, Frames);
+	const auto end = std::chrono::high_resolution_clock::now();
+
+	std::cout << "Physics step, " << physics.GetBodyCount() << " bodies on "
+		<< Rebel::Core::Threading::JobSystem::Get().GetThreadCount() << " threads (ms/step): "
+		<< std::chrono::duration<double, std::milli>(end - start).count() / Frames << "\n";
+
+	physics.Shutdown();
+}
@@ -0,0 +1,237 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/MeshAsset.h"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	// cells x cells quads of the given size in the XY plane, centered on the
+	// origin, with an optional sine bump along both axes.
+	void BuildGrid(MeshAsset& mesh, int32 cells, float cellSize, float bump = 0.0f)
+	{
+		const int32 side = cells + 1;
+		const float half = static_cast<float>(cells) * cellSize * 0.5f;
+
+		mesh.Vertices.Clear();
+		mesh.Indices.Clear();
+		for (int32 i = 0; i < side * side; ++i)
+		{
+			const float x = static_cast<float>(i % side) * cellSize - half;
+			const float y = static_cast<float>(i / side) * cellSize - half;
+
+			Vertex vertex{};
+			vertex.Position = Vector3(x, y, bump * std::sin(x) * std::cos(y));
+			mesh.Vertices.Add(vertex);
+		}
+
+		for (int32 y = 0; y < cells; ++y)
+		{
+			for (int32 x = 0; x < cells; ++x)
+			{
+				const uint32 corner = static_cast<uint32>(y * side + x);
+				mesh.Indices.Add(corner);
+				mesh.Indices.Add(corner + 1);
+				mesh.Indices.Add(corner + side + 1);
+				mesh.Indices.Add(corner);
+				mesh.Indices.Add(corner + side + 1);
+				mesh.Indices.Add(corner + side);
+			}
+		}
+	}
+
+	// The corners of a unit cube; only the hull of these matters.
+	void BuildRock(MeshAsset& mesh)
+	{
+		for (int32 i = 0; i < 8; ++i)
+		{
+			Vertex vertex{};
+			vertex.Position = Vector3(i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f);
+			mesh.Vertices.Add(vertex);
+		}
+	}
+
+	StaticMeshComponent& SpawnMesh(Scene& scene, const MeshAsset& mesh, const Vector3& position, EMeshCollision collision)
+	{
+		Actor& actor = scene.SpawnActor<Actor>();
+		actor.GetComponent<SceneComponent>().SetPosition(position);
+
+		auto& component = actor.AddObjectComponent<StaticMeshComponent>();
+		component.Mesh = AssetPtr<MeshAsset>(mesh.ID);
+		component.Collision = collision;
+		return component;
+	}
+
+	float TraceDown(const PhysicsSystem& physics, float x, float y)
+	{
+		TraceQueryParams params{};
+		TraceHit hit{};
+		if (!physics.LineTraceSingle(Vector3(x, y, 5.0f), Vector3(x, y, -5.0f), hit, params))
+			return -1.0f;
+		return hit.Distance;
+	}
+
+	std::filesystem::path MakeCacheDirectory(const char* name)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		return directory;
+	}
+}
+
+TEST_CASE("Static meshes collide as triangle meshes and convex hulls", "[engine][physics][meshes]")
+{
+	AssetRegistry registry;
+	AssetManager assets{registry};
+
+	MeshAsset* grid = assets.Create<MeshAsset>();
+	BuildGrid(*grid, 8, 1.0f);
+	MeshAsset* rock = assets.Create<MeshAsset>();
+	BuildRock(*rock);
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.SetAssetManagerContext(&assets);
+	physics.Init();
+
+	SpawnMesh(scene, *grid, Vector3(0.0f), EMeshCollision::TriangleMesh);
+	SpawnMesh(scene, *grid, Vector3(20.0f, 0.0f, 0.0f), EMeshCollision::None);
+	StaticMeshComponent& wide = SpawnMesh(scene, *grid, Vector3(40.0f, 0.0f, 0.0f), EMeshCollision::TriangleMesh);
+	wide.SetScale(Vector3(2.0f, 2.0f, 1.0f));
+
+	// Moving bodies cannot use triangle meshes and fall back to the hull.
+	StaticMeshComponent& falling = SpawnMesh(scene, *rock, Vector3(1.5f, 1.5f, 3.0f), EMeshCollision::TriangleMesh);
+	falling.BodyType = ERBBodyType::Dynamic;
+	REQUIRE(falling.CreatePhysicsShape().Type == EPhysicsShapeType::ConvexHull);
+
+	physics.Step(scene, kFixedDt);
+	REQUIRE(physics.GetBodyCount() == 3);
+
+	const MeshShapeStats& stats = physics.GetMeshShapeStats();
+	REQUIRE(stats.Cooked == 2);
+	REQUIRE(stats.Shared == 1);
+	REQUIRE(stats.Restored == 0); // created assets have no file to cache next to
+
+	REQUIRE(TraceDown(physics, -2.5f, 3.5f) == Catch::Approx(5.0f).margin(1e-3f));
+	REQUIRE(TraceDown(physics, 20.0f, 0.0f) < 0.0f);
+	REQUIRE(TraceDown(physics, 47.0f, -7.0f) == Catch::Approx(5.0f).margin(1e-3f));
+
+	StepFrames(physics, scene, 120);
+	REQUIRE(falling.GetWorldPosition().z == Catch::Approx(0.5f).margin(0.05f));
+	REQUIRE(TraceDown(physics, 1.5f, 1.5f) == Catch::Approx(4.0f).margin(0.05f));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Cooked mesh shapes are restored from the shape cache", "[engine][physics][meshes]")
+{
+	const std::filesystem::path directory = MakeCacheDirectory("RebelMeshCollisionTest");
+	const std::filesystem::path cacheFile = directory / "Grid.mesh.rshape";
+
+	AssetRegistry registry;
+	AssetManager assets{registry};
+
+	MeshAsset* grid = assets.Create<MeshAsset>();
+	grid->Path = (directory / "Grid").string().c_str();
+	BuildGrid(*grid, 8, 1.0f);
+
+	auto simulate = [&](float expectedDistance) -> MeshShapeStats
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.SetAssetManagerContext(&assets);
+		physics.Init();
+
+		SpawnMesh(scene, *grid, Vector3(0.0f), EMeshCollision::TriangleMesh);
+		physics.Step(scene, kFixedDt);
+		REQUIRE(physics.GetBodyCount() == 1);
+		REQUIRE(TraceDown(physics, 0.5f, -1.5f) == Catch::Approx(expectedDistance).margin(1e-3f));
+
+		const MeshShapeStats stats = physics.GetMeshShapeStats();
+		physics.Shutdown();
+		return stats;
+	};
+
+	MeshShapeStats stats = simulate(5.0f);
+	REQUIRE(stats.Cooked == 1);
+	REQUIRE(stats.Restored == 0);
+	REQUIRE(std::filesystem::exists(cacheFile));
+
+	stats = simulate(5.0f);
+	REQUIRE(stats.Cooked == 0);
+	REQUIRE(stats.Restored == 1);
+
+	// Edited geometry no longer matches the cached hash.
+	for (Vertex& vertex : grid->Vertices)
+		vertex.Position.z += 1.0f;
+	stats = simulate(4.0f);
+	REQUIRE(stats.Cooked == 1);
+	REQUIRE(stats.Restored == 0);
+
+	// A damaged cache is cooked over as well.
+	std::filesystem::resize_file(cacheFile, std::filesystem::file_size(cacheFile) / 2);
+	stats = simulate(4.0f);
+	REQUIRE(stats.Cooked == 1);
+
+	stats = simulate(4.0f);
+	REQUIRE(stats.Restored == 1);
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Mesh collision benchmark, cooking vs restoring from the cache (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 Cells = 256;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	const std::filesystem::path directory = MakeCacheDirectory("RebelMeshCollisionBenchmark");
+
+	AssetRegistry registry;
+	AssetManager assets{registry};
+
+	MeshAsset* terrain = assets.Create<MeshAsset>();
+	terrain->Path = (directory / "Terrain").string().c_str();
+	BuildGrid(*terrain, Cells, 0.5f, 2.0f);
+
+	MeshAsset* boulder = assets.Create<MeshAsset>();
+	boulder->Path = (directory / "Boulder").string().c_str();
+	BuildGrid(*boulder, 64, 0.05f, 0.5f);
+
+	auto load = [&]() -> double
+	{
+		Scene scene;
+		PhysicsSystem physics;
+		physics.SetAssetManagerContext(&assets);
+		physics.Init();
+
+		SpawnMesh(scene, *terrain, Vector3(0.0f), EMeshCollision::TriangleMesh);
+		SpawnMesh(scene, *boulder, Vector3(0.0f, 0.0f, 5.0f), EMeshCollision::ConvexHull);
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		physics.Step(scene, kFixedDt);
+		const auto end = std::chrono::high_resolution_clock::now();
+		REQUIRE(physics.GetBodyCount() == 2);
+
+		physics.Shutdown();
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	};
+
+	const double cookMs = load();
+	const double restoreMs = load();
+
+	std::cout << "First step cooking a " << Cells * Cells * 2 << "-triangle mesh and a "
+			  << boulder->Vertices.Num() << "-point hull (ms): " << cookMs << "\n";
+	std::cout << "First step restoring both from the shape cache (ms): " << restoreMs << "\n";
+
+	std::filesystem::remove_all(directory);
+}
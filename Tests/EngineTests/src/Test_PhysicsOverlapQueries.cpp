@@ -0,0 +1,158 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	EntityID OwnerOf(const PrimitiveComponent& primitive)
+	{
+		return primitive.GetOwner()->GetHandle();
+	}
+}
+
+TEST_CASE("Overlap queries list each overlapping owner once", "[engine][physics][overlaps]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SphereComponent& a = SpawnSphere(scene, Vector3(1.0f, 0.0f, 0.0f), 0.5f, ERBBodyType::Static, CollisionChannel::WorldDynamic);
+	SphereComponent& b = SpawnSphere(scene, Vector3(-1.0f, 0.0f, 0.0f), 0.5f, ERBBodyType::Static, CollisionChannel::Pawn);
+	SphereComponent& distant = SpawnSphere(scene, Vector3(10.0f, 0.0f, 0.0f), 0.5f, ERBBodyType::Static, CollisionChannel::WorldDynamic);
+
+	// A second primitive on the same actor.
+	auto& extra = b.GetOwner()->AddObjectComponent<BoxComponent>();
+	extra.BodyType = ERBBodyType::Static;
+	extra.ObjectChannel = CollisionChannel::Pawn;
+	extra.HalfExtent = Vector3(0.25f);
+	physics.Step(scene, kFixedDt);
+
+	TraceQueryParams params{};
+	std::vector<EntityID> entities;
+
+	REQUIRE(physics.OverlapSphereMulti(Vector3(0.0f), 1.0f, entities, params));
+	REQUIRE(entities.size() == 2);
+	REQUIRE(entities[0] < entities[1]);
+	REQUIRE(std::find(entities.begin(), entities.end(), OwnerOf(a)) != entities.end());
+	REQUIRE(std::find(entities.begin(), entities.end(), OwnerOf(b)) != entities.end());
+
+	REQUIRE(physics.OverlapBoxMulti(Vector3(10.0f, 0.0f, 0.0f), Vector3(0.2f), Quaternion(1.0f, 0.0f, 0.0f, 0.0f), entities, params));
+	REQUIRE(entities.size() == 1);
+	REQUIRE(entities[0] == OwnerOf(distant));
+
+	// Lying along Z, the capsule misses both spheres on the X axis.
+	REQUIRE_FALSE(physics.OverlapCapsuleMulti(Vector3(0.0f), 2.0f, 0.3f, entities, params));
+	REQUIRE(entities.empty());
+
+	// Ignore lists and channels.
+	const EntityID ignored = OwnerOf(a);
+	params.IgnoreEntities = &ignored;
+	params.IgnoreEntityCount = 1;
+	REQUIRE(physics.OverlapSphereMulti(Vector3(0.0f), 1.0f, entities, params));
+	REQUIRE(entities.size() == 1);
+	REQUIRE(entities[0] == OwnerOf(b));
+
+	params = {};
+	params.Channel = CollisionChannel::Camera;
+	REQUIRE(physics.OverlapSphereMulti(Vector3(0.0f), 1.0f, entities, params));
+	REQUIRE(entities.size() == 1);
+	REQUIRE(entities[0] == OwnerOf(a));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("AABB queries test bounds in the broadphase only", "[engine][physics][overlaps]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	SphereComponent& ball = SpawnSphere(scene, Vector3(0.0f), 1.0f, ERBBodyType::Static, CollisionChannel::WorldDynamic);
+	SphereComponent& trigger = SpawnSphere(scene, Vector3(5.0f, 0.0f, 0.0f), 1.0f, ERBBodyType::Static, CollisionChannel::WorldDynamic);
+	trigger.bIsTrigger = true;
+	physics.Step(scene, kFixedDt);
+
+	TraceQueryParams params{};
+	std::vector<EntityID> entities;
+
+	// The corner of the ball's bounds, outside the ball itself.
+	const Vector3 cornerMin(0.8f, 0.8f, 0.8f);
+	const Vector3 cornerMax(0.95f, 0.95f, 0.95f);
+	REQUIRE(physics.QueryAABB(cornerMin, cornerMax, entities, params));
+	REQUIRE(entities.size() == 1);
+	REQUIRE(entities[0] == OwnerOf(ball));
+	REQUIRE_FALSE(physics.OverlapBoxMulti((cornerMin + cornerMax) * 0.5f, Vector3(0.075f), Quaternion(1.0f, 0.0f, 0.0f, 0.0f), entities, params));
+
+	// Swapped corners are fine; triggers need opting in.
+	REQUIRE(physics.QueryAABB(Vector3(6.0f), Vector3(-6.0f), entities, params));
+	REQUIRE(entities.size() == 1);
+	params.bTraceTriggers = true;
+	REQUIRE(physics.QueryAABB(Vector3(6.0f), Vector3(-6.0f), entities, params));
+	REQUIRE(entities.size() == 2);
+
+	// Released bodies drop out before the next step.
+	physics.DestroyBodyForComponent(ball);
+	REQUIRE_FALSE(physics.QueryAABB(Vector3(-2.0f), Vector3(2.0f), entities, params));
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Overlap benchmark, area queries against a crowd (Non-assertive)", "[benchmark]")
+{
+	constexpr int32 Side = 64;
+	constexpr int32 QueryCount = 2048;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	for (int32 i = 0; i < Side * Side; ++i)
+	{
+		const float x = static_cast<float>(i % Side) * 2.0f - 64.0f;
+		const float y = static_cast<float>(i / Side) * 2.0f - 64.0f;
+		SpawnSphere(scene, Vector3(x, y, 0.0f), 0.4f, ERBBodyType::Static, CollisionChannel::Pawn);
+	}
+	physics.Step(scene, kFixedDt);
+
+	TraceQueryParams params{};
+	std::vector<EntityID> entities;
+	size_t overlapFound = 0;
+	size_t boundsFound = 0;
+
+	const auto overlapStart = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < QueryCount; ++i)
+	{
+		const Vector3 center(static_cast<float>(i % 60) * 2.0f - 60.0f, static_cast<float>(i / 60) - 30.0f, 0.0f);
+		physics.OverlapSphereMulti(center, 4.0f, entities, params);
+		overlapFound += entities.size();
+	}
+	const auto overlapEnd = std::chrono::high_resolution_clock::now();
+
+	const auto boundsStart = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < QueryCount; ++i)
+	{
+		const Vector3 center(static_cast<float>(i % 60) * 2.0f - 60.0f, static_cast<float>(i / 60) - 30.0f, 0.0f);
+		physics.QueryAABB(center - Vector3(4.0f), center + Vector3(4.0f), entities, params);
+		boundsFound += entities.size();
+	}
+	const auto boundsEnd = std::chrono::high_resolution_clock::now();
+
+	REQUIRE(boundsFound >= overlapFound);
+
+	const auto us = [](auto start, auto end) { return std::chrono::duration<double, std::micro>(end - start).count() / QueryCount; };
+	std::cout << "Sphere overlap, " << Side * Side << " bodies (us/query): " << us(overlapStart, overlapEnd)
+			  << ", " << overlapFound / QueryCount << " found on average\n";
+	std::cout << "AABB query (us/query): " << us(boundsStart, boundsEnd)
+			  << ", " << boundsFound / QueryCount << " found on average\n";
+
+	physics.Shutdown();
+}
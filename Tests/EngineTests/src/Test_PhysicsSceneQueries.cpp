@@ -0,0 +1,199 @@
+#include "catch_amalgamated.hpp"
+#include "PhysicsTestHelpers.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace PhysicsTest;
+
+namespace
+{
+	// 16 x 16 pillars on a floor.
+	void BuildPillarField(Scene& scene)
+	{
+		SpawnBox(scene, Vector3(0.0f, 0.0f, -0.5f), Vector3(50.0f, 50.0f, 0.5f), ERBBodyType::Static);
+		for (int32 i = 0; i < 256; ++i)
+		{
+			const float x = static_cast<float>(i % 16) * 5.0f - 40.0f;
+			const float y = static_cast<float>(i / 16) * 5.0f - 40.0f;
+			SpawnBox(scene, Vector3(x, y, 1.0f), Vector3(0.5f, 0.5f, 1.0f), ERBBodyType::Static);
+		}
+	}
+
+	SceneQuery MakeRandomTrace(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> coord(-45.0f, 45.0f);
+		std::uniform_real_distribution<float> height(0.5f, 2.5f);
+
+		SceneQuery query;
+		query.Shape = static_cast<ESceneQueryShape>(rng() % 4);
+		query.Start = Vector3(coord(rng), coord(rng), height(rng));
+		query.End = Vector3(coord(rng), coord(rng), height(rng));
+		query.Radius = 0.2f;
+		query.HalfHeight = 0.6f;
+		query.HalfExtent = Vector3(0.2f, 0.3f, 0.4f);
+		query.Rotation = glm::angleAxis(0.5f, Vector3(0.0f, 0.0f, 1.0f));
+		return query;
+	}
+
+	bool RunSingle(const PhysicsSystem& physics, const SceneQuery& query, TraceHit& hit)
+	{
+		switch (query.Shape)
+		{
+		case ESceneQueryShape::Line:
+			return physics.LineTraceSingle(query.Start, query.End, hit, query.Params);
+		case ESceneQueryShape::Sphere:
+			return physics.SphereTraceSingle(query.Start, query.End, query.Radius, hit, query.Params);
+		case ESceneQueryShape::Capsule:
+			return physics.CapsuleTraceSingle(query.Start, query.End, query.HalfHeight, query.Radius, hit, query.Params);
+		case ESceneQueryShape::Box:
+			return physics.BoxTraceSingle(query.Start, query.End, query.HalfExtent, query.Rotation, hit, query.Params);
+		}
+		return false;
+	}
+}
+
+TEST_CASE("Batched traces match the single-call traces", "[engine][physics][queries]")
+{
+	constexpr uint32 QueryCount = 512;
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	BuildPillarField(scene);
+	physics.Step(scene, kFixedDt);
+
+	std::mt19937 rng(5u);
+	TArray<SceneQuery> queries;
+	queries.Resize(QueryCount);
+	for (SceneQuery& query : queries)
+		query = MakeRandomTrace(rng);
+
+	TArray<SceneQueryResult> results;
+	results.Resize(QueryCount);
+	const uint32 hits = physics.RunSceneQueries(queries.Data(), results.Data(), QueryCount);
+
+	uint32 expectedHits = 0;
+	uint32 mismatches = 0;
+	for (uint32 i = 0; i < QueryCount; ++i)
+	{
+		TraceHit hit{};
+		const bool bHit = RunSingle(physics, queries[i], hit);
+		expectedHits += bHit ? 1u : 0u;
+
+		const TraceHit& batched = results[i].Hit;
+		if (bHit != results[i].bHit ||
+			hit.HitEntity != batched.HitEntity ||
+			std::abs(hit.Distance - batched.Distance) > 1e-4f)
+		{
+			++mismatches;
+		}
+	}
+
+	REQUIRE(expectedHits > 0);
+	REQUIRE(hits == expectedHits);
+	REQUIRE(mismatches == 0);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Overlap queries find the body the shape sits in", "[engine][physics][queries]")
+{
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+
+	BoxComponent& crate = SpawnBox(scene, Vector3(4.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Static);
+	BoxComponent& trigger = SpawnBox(scene, Vector3(-4.0f, 0.0f, 0.0f), Vector3(0.5f), ERBBodyType::Static);
+	trigger.bIsTrigger = true;
+	physics.Step(scene, kFixedDt);
+
+	const EntityID crateEntity = crate.GetOwner()->GetHandle();
+
+	SceneQuery queries[6];
+	for (SceneQuery& query : queries)
+	{
+		query.Kind = ESceneQueryKind::Overlap;
+		query.Shape = ESceneQueryShape::Sphere;
+		query.Radius = 0.3f;
+	}
+
+	queries[0].Start = Vector3(4.6f, 0.0f, 0.0f);
+	queries[1].Start = Vector3(0.0f);
+	queries[2].Shape = ESceneQueryShape::Box;
+	queries[2].HalfExtent = Vector3(0.2f);
+	queries[2].Start = Vector3(4.0f, 0.0f, 0.6f);
+	queries[3].Start = Vector3(4.0f, 0.0f, 0.0f);
+	queries[3].Params.IgnoreEntities = &crateEntity;
+	queries[3].Params.IgnoreEntityCount = 1;
+	queries[4].Start = Vector3(-4.0f, 0.0f, 0.0f);
+	queries[5] = queries[4];
+	queries[5].Params.bTraceTriggers = true;
+
+	SceneQueryResult results[6];
+	REQUIRE(physics.RunSceneQueries(queries, results, 6) == 3);
+
+	REQUIRE(results[0].bHit);
+	REQUIRE(results[0].Hit.HitEntity == crateEntity);
+	REQUIRE(results[0].Hit.Normal.x > 0.9f);
+	REQUIRE_FALSE(results[1].bHit);
+	REQUIRE(results[2].bHit);
+	REQUIRE(results[2].Hit.Normal.z > 0.9f);
+	REQUIRE_FALSE(results[3].bHit);
+	REQUIRE_FALSE(results[4].bHit);
+	REQUIRE(results[5].bHit);
+	REQUIRE_FALSE(results[5].Hit.bBlockingHit);
+
+	// Lines have no volume to overlap with.
+	queries[0].Shape = ESceneQueryShape::Line;
+	REQUIRE(physics.RunSceneQueries(queries, results, 1) == 0);
+	REQUIRE_FALSE(results[0].bHit);
+
+	physics.Shutdown();
+}
+
+TEST_CASE("Scene query benchmark, batch vs one call per trace (Non-assertive)", "[benchmark]")
+{
+	constexpr uint32 QueryCount = 8192;
+
+#ifndef NDEBUG
+	std::cout << "[benchmark] Warning: non-Release build; timing values are not representative.\n";
+#endif
+
+	Scene scene;
+	PhysicsSystem physics;
+	physics.Init();
+	BuildPillarField(scene);
+	physics.Step(scene, kFixedDt);
+
+	std::mt19937 rng(9u);
+	TArray<SceneQuery> queries;
+	queries.Resize(QueryCount);
+	for (SceneQuery& query : queries)
+		query = MakeRandomTrace(rng);
+
+	TArray<SceneQueryResult> results;
+	results.Resize(QueryCount);
+
+	uint32 serialHits = 0;
+	const auto serialStart = std::chrono::high_resolution_clock::now();
+	for (uint32 i = 0; i < QueryCount; ++i)
+	{
+		TraceHit hit{};
+		serialHits += RunSingle(physics, queries[i], hit) ? 1u : 0u;
+	}
+	const auto serialEnd = std::chrono::high_resolution_clock::now();
+
+	const auto batchStart = std::chrono::high_resolution_clock::now();
+	const uint32 batchHits = physics.RunSceneQueries(queries.Data(), results.Data(), QueryCount);
+	const auto batchEnd = std::chrono::high_resolution_clock::now();
+
+	REQUIRE(batchHits == serialHits);
+
+	const auto ms = [](auto start, auto end) { return std::chrono::duration<double, std::milli>(end - start).count(); };
+	std::cout << QueryCount << " mixed traces, one call each (ms): " << ms(serialStart, serialEnd) << "\n";
+	std::cout << QueryCount << " mixed traces, batched (ms): " << ms(batchStart, batchEnd) << "\n";
+
+	physics.Shutdown();
+}
@@ -0,0 +1,102 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Animation/AnimationRuntime.h"
+#include "Engine/Animation/SkeletonAsset.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+	// Three-bone chain, each bone one unit above its parent.
+	void MakeChain(SkeletonAsset& skeleton)
+	{
+		Mat4 global(1.0f);
+		for (int32 bone = 0; bone < 3; ++bone)
+		{
+			global = glm::translate(global, Vector3(0.0f, 1.0f, 0.0f));
+			skeleton.m_Parent.Add(bone - 1);
+			skeleton.m_InvBind.Add(FMath::inverse(global));
+		}
+	}
+}
+
+TEST_CASE("Skeleton bind pose cache matches the per-frame bind pose build", "[engine][animation]")
+{
+	SkeletonAsset skeleton;
+	MakeChain(skeleton);
+
+	REQUIRE_FALSE(skeleton.HasBindPoseCache());
+	REQUIRE(skeleton.BuildBindPoseCache());
+	REQUIRE(skeleton.HasBindPoseCache());
+
+	TArray<Mat4> localBind;
+	TArray<Mat4> globalBind;
+	REQUIRE(AnimationRuntime::BuildBindPoses(&skeleton, localBind, globalBind));
+
+	REQUIRE(skeleton.GetLocalBindPose().Num() == 3);
+	REQUIRE(skeleton.GetGlobalBindPose().Num() == 3);
+	REQUIRE(skeleton.GetBindSkinPalette().Num() == 3);
+	for (int32 bone = 0; bone < 3; ++bone)
+	{
+		REQUIRE(skeleton.GetLocalBindPose()[bone][3].y == Catch::Approx(localBind[bone][3].y));
+		REQUIRE(skeleton.GetGlobalBindPose()[bone][3].y == Catch::Approx(globalBind[bone][3].y));
+
+		// Bind pose times inverse bind is the identity palette.
+		const Mat4& skin = skeleton.GetBindSkinPalette()[bone];
+		REQUIRE(skin[3].y == Catch::Approx(0.0f).margin(1e-5f));
+		REQUIRE(skin[1].y == Catch::Approx(1.0f));
+	}
+	REQUIRE(skeleton.GetGlobalBindPose()[2][3].y == Catch::Approx(3.0f));
+}
+
+TEST_CASE("Skeleton bind pose cache is dropped when the skeleton is emptied", "[engine][animation]")
+{
+	SkeletonAsset skeleton;
+	MakeChain(skeleton);
+	REQUIRE(skeleton.BuildBindPoseCache());
+
+	skeleton.m_Parent.Clear();
+	skeleton.m_InvBind.Clear();
+	REQUIRE_FALSE(skeleton.BuildBindPoseCache());
+	REQUIRE_FALSE(skeleton.HasBindPoseCache());
+	REQUIRE(skeleton.GetBindSkinPalette().IsEmpty());
+}
+
+TEST_CASE("Global pose is built in parent-first order for out-of-order skeletons", "[engine][animation]")
+{
+	// Children stored before their parents: 0 -> 2 -> 1 (root).
+	SkeletonAsset skeleton;
+	skeleton.m_Parent.Add(2);
+	skeleton.m_Parent.Add(-1);
+	skeleton.m_Parent.Add(1);
+	const Mat4 root = glm::translate(Mat4(1.0f), Vector3(1.0f, 0.0f, 0.0f));
+	const Mat4 middle = root * glm::translate(Mat4(1.0f), Vector3(0.0f, 2.0f, 0.0f));
+	const Mat4 leaf = middle * glm::translate(Mat4(1.0f), Vector3(0.0f, 0.0f, 3.0f));
+	skeleton.m_InvBind.Add(FMath::inverse(leaf));
+	skeleton.m_InvBind.Add(FMath::inverse(root));
+	skeleton.m_InvBind.Add(FMath::inverse(middle));
+
+	REQUIRE(skeleton.BuildBindPoseCache());
+
+	const TArray<int32>& order = skeleton.GetEvaluationOrder();
+	REQUIRE(order.Num() == 3);
+	REQUIRE(order[0] == 1);
+	REQUIRE(order[1] == 2);
+	REQUIRE(order[2] == 0);
+	REQUIRE(skeleton.GetEvaluationParents()[0] == -1);
+
+	TArray<Mat4> globalPose;
+	AnimationRuntime::BuildGlobalPose(&skeleton, skeleton.GetLocalBindPose(), globalPose);
+	REQUIRE(globalPose.Num() == 3);
+	REQUIRE(globalPose[0][3].x == Catch::Approx(1.0f));
+	REQUIRE(globalPose[0][3].y == Catch::Approx(2.0f));
+	REQUIRE(globalPose[0][3].z == Catch::Approx(3.0f));
+
+	// Without the cached order (hierarchy edited in place) the result is the same.
+	TArray<Mat4> chainWalked;
+	SkeletonAsset uncached;
+	uncached.m_Parent = skeleton.m_Parent;
+	uncached.m_InvBind = skeleton.m_InvBind;
+	AnimationRuntime::BuildGlobalPose(&uncached, skeleton.GetLocalBindPose(), chainWalked);
+	REQUIRE(chainWalked[0][3].z == Catch::Approx(3.0f));
+	REQUIRE(chainWalked[2][3].y == Catch::Approx(2.0f));
+}
@@ -0,0 +1,191 @@
+#include "catch_amalgamated.hpp"
+#include "Engine/Scene/Scene.h"
+#include "Engine/Scene/Actor.h"
+#include "Engine/Scene/TransformHierarchy.h"
+#include "Engine/Components/Components.h"
+
+namespace
+{
+    constexpr float kEps = 1e-4f;
+
+    void RequireVectorNear(const Vector3& lhs, const Vector3& rhs, float epsilon)
+    {
+        REQUIRE(lhs.x == Catch::Approx(rhs.x).margin(epsilon));
+        REQUIRE(lhs.y == Catch::Approx(rhs.y).margin(epsilon));
+        REQUIRE(lhs.z == Catch::Approx(rhs.z).margin(epsilon));
+    }
+}
+
+TEST_CASE("TransformHierarchy keeps parents ahead of children after reparenting", "[engine][scene][transform][hierarchy]")
+{
+    TransformHierarchy hierarchy;
+    const Quaternion identity(1.0f, 0.0f, 0.0f, 0.0f);
+
+    // Added child-first so the initial dense order is the wrong way round.
+    const uint32 leaf = hierarchy.Add(Vector3(0.0f, 0.0f, 1.0f), identity, Vector3(1.0f));
+    const uint32 middle = hierarchy.Add(Vector3(0.0f, 1.0f, 0.0f), identity, Vector3(1.0f));
+    const uint32 root = hierarchy.Add(Vector3(1.0f, 0.0f, 0.0f), identity, Vector3(2.0f));
+
+    hierarchy.SetParent(leaf, middle);
+    hierarchy.SetParent(middle, root);
+    hierarchy.Update();
+
+    REQUIRE(hierarchy.GetLevelCount() == 3);
+    REQUIRE(hierarchy.GetDepth(root) == 0);
+    REQUIRE(hierarchy.GetDepth(middle) == 1);
+    REQUIRE(hierarchy.GetDepth(leaf) == 2);
+    RequireVectorNear(hierarchy.GetWorldPosition(leaf), Vector3(1.0f, 2.0f, 2.0f), kEps);
+
+    // Removing the middle entry and re-rooting the leaf compacts the store.
+    hierarchy.SetParent(leaf, TransformHierarchy::kInvalidId);
+    hierarchy.MarkDirty(leaf);
+    hierarchy.Remove(middle);
+    hierarchy.Update();
+
+    REQUIRE(hierarchy.Num() == 2);
+    REQUIRE(hierarchy.GetLevelCount() == 1);
+    REQUIRE(hierarchy.GetDepth(leaf) == 0);
+    RequireVectorNear(hierarchy.GetWorldPosition(leaf), Vector3(0.0f, 0.0f, 1.0f), kEps);
+}
+
+TEST_CASE("TransformHierarchy re-levels a moved subtree in place", "[engine][scene][transform][hierarchy]")
+{
+    TransformHierarchy hierarchy;
+    const Quaternion identity(1.0f, 0.0f, 0.0f, 0.0f);
+
+    const uint32 a = hierarchy.Add(Vector3(1.0f, 0.0f, 0.0f), identity, Vector3(1.0f));
+    const uint32 b = hierarchy.Add(Vector3(0.0f, 1.0f, 0.0f), identity, Vector3(1.0f));
+    const uint32 c = hierarchy.Add(Vector3(0.0f, 0.0f, 1.0f), identity, Vector3(1.0f));
+    const uint32 other = hierarchy.Add(Vector3(5.0f, 0.0f, 0.0f), identity, Vector3(1.0f));
+    const uint32 otherChild = hierarchy.Add(Vector3(0.0f, 5.0f, 0.0f), identity, Vector3(1.0f));
+
+    hierarchy.SetParent(b, a);
+    hierarchy.SetParent(c, b);
+    hierarchy.SetParent(otherChild, other);
+
+    // Depths are patched by SetParent itself, no Update() needed.
+    REQUIRE(hierarchy.GetDepth(c) == 2);
+    REQUIRE(hierarchy.GetLevelCount() == 3);
+
+    hierarchy.Update();
+
+    // Moving b's subtree one level deeper grows the level count.
+    hierarchy.SetParent(b, otherChild);
+    hierarchy.MarkDirty(b);
+    hierarchy.MarkDirty(c);
+    REQUIRE(hierarchy.GetDepth(b) == 2);
+    REQUIRE(hierarchy.GetDepth(c) == 3);
+    REQUIRE(hierarchy.GetLevelCount() == 4);
+    REQUIRE(hierarchy.Num() == 5);
+
+    // Getters compose dirty entries without resolving them.
+    RequireVectorNear(hierarchy.GetWorldPosition(c), Vector3(5.0f, 6.0f, 1.0f), kEps);
+    REQUIRE(hierarchy.IsDirty(c));
+
+    hierarchy.Update();
+    REQUIRE_FALSE(hierarchy.IsDirty(c));
+    RequireVectorNear(hierarchy.GetWorldPosition(c), Vector3(5.0f, 6.0f, 1.0f), kEps);
+
+    // Removing an entry re-roots its children and invalidates them.
+    hierarchy.Remove(otherChild);
+    REQUIRE(hierarchy.GetDepth(b) == 0);
+    REQUIRE(hierarchy.GetDepth(c) == 1);
+    REQUIRE(hierarchy.GetLevelCount() == 2);
+    REQUIRE(hierarchy.IsDirty(b));
+    REQUIRE(hierarchy.IsDirty(c));
+
+    hierarchy.Update();
+    RequireVectorNear(hierarchy.GetWorldPosition(c), Vector3(0.0f, 1.0f, 1.0f), kEps);
+    RequireVectorNear(hierarchy.GetWorldPosition(a), Vector3(1.0f, 0.0f, 0.0f), kEps);
+}
+
+TEST_CASE("TransformHierarchy resolves wide levels in parallel", "[engine][scene][transform][hierarchy][parallel]")
+{
+    TransformHierarchy hierarchy;
+    const Quaternion identity(1.0f, 0.0f, 0.0f, 0.0f);
+    const Quaternion turn = glm::angleAxis(glm::radians(90.0f), Vector3(0.0f, 0.0f, 1.0f));
+
+    const uint32 root = hierarchy.Add(Vector3(10.0f, 0.0f, 0.0f), turn, Vector3(1.0f));
+
+    constexpr uint32 childCount = static_cast<uint32>(TransformHierarchy::kParallelLevelThreshold) * 3;
+    TArray<uint32> children;
+    children.Reserve(childCount);
+    for (uint32 i = 0; i < childCount; ++i)
+    {
+        const uint32 child = hierarchy.Add(Vector3(static_cast<float>(i) * 0.01f, 0.0f, 0.0f), identity, Vector3(1.0f));
+        hierarchy.SetParent(child, root);
+        children.Add(child);
+    }
+
+    hierarchy.Update();
+
+    bool bAllMatch = true;
+    for (uint32 i = 0; i < childCount; ++i)
+    {
+        // Rotating +X by 90 degrees about Z lands on +Y.
+        const Vector3 expected(10.0f, static_cast<float>(i) * 0.01f, 0.0f);
+        const Vector3 world = hierarchy.GetWorldPosition(children[i]);
+        const Vector3 matrixWorld = Vector3(hierarchy.GetWorldMatrix(children[i])[3]);
+        if (hierarchy.IsDirty(children[i]) ||
+            glm::length(world - expected) > 1e-3f ||
+            glm::length(matrixWorld - expected) > 1e-3f)
+        {
+            bAllMatch = false;
+            break;
+        }
+    }
+
+    REQUIRE(bAllMatch);
+}
+
+TEST_CASE("SceneComponents read world transforms from the scene store", "[engine][scene][transform][hierarchy]")
+{
+    Scene scene;
+    Actor& actor = scene.SpawnActor<Actor>();
+
+    auto& root = actor.GetComponent<SceneComponent>();
+    auto& child = actor.AddObjectComponent<SceneComponent>();
+
+    REQUIRE(root.GetTransformHierarchy() == &scene.GetTransformHierarchy());
+    REQUIRE(child.GetTransformHierarchy() == &scene.GetTransformHierarchy());
+
+    root.SetPosition(Vector3(2.0f, 0.0f, 0.0f));
+    child.SetPosition(Vector3(0.0f, 3.0f, 0.0f));
+    scene.UpdateTransforms();
+
+    REQUIRE(scene.GetTransformHierarchy().GetDepth(child.GetTransformId()) == 1);
+    RequireVectorNear(child.GetWorldPosition(), Vector3(2.0f, 3.0f, 0.0f), kEps);
+
+    // A standalone component has no store entry and still answers correctly.
+    SceneComponent standalone;
+    standalone.SetPosition(Vector3(4.0f, 5.0f, 6.0f));
+    REQUIRE(standalone.GetTransformHierarchy() == nullptr);
+    RequireVectorNear(standalone.GetWorldPosition(), Vector3(4.0f, 5.0f, 6.0f), kEps);
+
+    const uint32 before = scene.GetTransformHierarchy().Num();
+    REQUIRE(actor.RemoveObjectComponentInstance(&child));
+    REQUIRE(scene.GetTransformHierarchy().Num() == before - 1);
+}
+
+TEST_CASE("Leaving the scene store invalidates re-rooted children", "[engine][scene][transform][hierarchy]")
+{
+    Scene scene;
+    Actor& actor = scene.SpawnActor<Actor>();
+
+    auto& root = actor.GetComponent<SceneComponent>();
+    auto& child = actor.AddObjectComponent<SceneComponent>();
+    root.SetPosition(Vector3(2.0f, 0.0f, 0.0f));
+    child.SetPosition(Vector3(0.0f, 3.0f, 0.0f));
+    scene.UpdateTransforms();
+
+    TransformHierarchy& store = scene.GetTransformHierarchy();
+    REQUIRE_FALSE(store.IsDirty(child.GetTransformId()));
+
+    root.BindTransformHierarchy(nullptr);
+
+    // The child's entry is now a root; its cached world still includes the parent.
+    REQUIRE(store.GetDepth(child.GetTransformId()) == 0);
+    REQUIRE(store.IsDirty(child.GetTransformId()));
+    RequireVectorNear(store.GetWorldPosition(child.GetTransformId()), Vector3(0.0f, 3.0f, 0.0f), kEps);
+    RequireVectorNear(child.GetWorldPosition(), Vector3(2.0f, 3.0f, 0.0f), kEps);
+}
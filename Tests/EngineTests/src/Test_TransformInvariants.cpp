@@ -119,3 +119,71 @@ TEST_CASE("World transform does not drift under repeated updates", "[engine][sce
     RequireMatrixNear(current, baseline, kDriftEps);
 }
 
+
+TEST_CASE("Cached world transforms are invalidated through the hierarchy", "[engine][scene][transform][cache]")
+{
+    Scene scene;
+    Actor& actor = scene.SpawnActor<Actor>();
+
+    auto& root = actor.GetComponent<SceneComponent>();
+    auto& child = actor.AddObjectComponent<SceneComponent>();
+    auto& grandChild = actor.AddObjectComponent<SceneComponent>();
+    REQUIRE(grandChild.AttachTo(&child, false));
+
+    child.SetPosition(Vector3(1.0f, 0.0f, 0.0f));
+    grandChild.SetPosition(Vector3(0.0f, 2.0f, 0.0f));
+
+    scene.UpdateTransforms();
+    REQUIRE_FALSE(root.IsWorldTransformDirty());
+    REQUIRE_FALSE(child.IsWorldTransformDirty());
+    REQUIRE_FALSE(grandChild.IsWorldTransformDirty());
+
+    root.SetPosition(Vector3(10.0f, 0.0f, 0.0f));
+    REQUIRE(root.IsWorldTransformDirty());
+    REQUIRE(child.IsWorldTransformDirty());
+    REQUIRE(grandChild.IsWorldTransformDirty());
+
+    // Getters stay correct before the scene pass runs.
+    const Vector3 grandChildWorld = grandChild.GetWorldPosition();
+    REQUIRE(grandChildWorld.x == Catch::Approx(11.0f).margin(kDriftEps));
+    REQUIRE(grandChildWorld.y == Catch::Approx(2.0f).margin(kDriftEps));
+    REQUIRE_FALSE(child.IsWorldTransformDirty());
+
+    root.SetRotationEuler(Vector3(0.0f, 0.0f, 90.0f));
+    scene.UpdateTransforms();
+    REQUIRE_FALSE(grandChild.IsWorldTransformDirty());
+
+    const Mat4 expected = root.GetLocalTransform() * child.GetLocalTransform() * grandChild.GetLocalTransform();
+    RequireMatrixNear(grandChild.GetWorldTransform(), expected, kBasisEps);
+
+    const Vector3 matrixPosition = Vector3(grandChild.GetWorldTransform()[3]);
+    const Vector3 cachedPosition = grandChild.GetWorldPosition();
+    REQUIRE(matrixPosition.x == Catch::Approx(cachedPosition.x).margin(kBasisEps));
+    REQUIRE(matrixPosition.y == Catch::Approx(cachedPosition.y).margin(kBasisEps));
+    REQUIRE(matrixPosition.z == Catch::Approx(cachedPosition.z).margin(kBasisEps));
+}
+
+TEST_CASE("Reparenting keeps child lists and world transforms consistent", "[engine][scene][transform][cache]")
+{
+    Scene scene;
+    Actor& parentActor = scene.SpawnActor<Actor>();
+    Actor& childActor = scene.SpawnActor<Actor>();
+
+    auto& parentRoot = parentActor.GetComponent<SceneComponent>();
+    auto& childRoot = childActor.GetComponent<SceneComponent>();
+
+    parentRoot.SetPosition(Vector3(5.0f, 0.0f, 0.0f));
+    childRoot.SetPosition(Vector3(7.0f, 1.0f, 0.0f));
+
+    REQUIRE(childRoot.AttachTo(&parentRoot, true));
+    REQUIRE(parentRoot.GetChildren().Num() == 1);
+    REQUIRE(childRoot.GetWorldPosition().x == Catch::Approx(7.0f).margin(kDriftEps));
+
+    parentRoot.SetPosition(Vector3(6.0f, 0.0f, 0.0f));
+    scene.UpdateTransforms();
+    REQUIRE(childRoot.GetWorldPosition().x == Catch::Approx(8.0f).margin(kDriftEps));
+
+    REQUIRE(childRoot.Detach(true));
+    REQUIRE(parentRoot.GetChildren().Num() == 0);
+    REQUIRE(childRoot.GetWorldPosition().x == Catch::Approx(8.0f).margin(kDriftEps));
+}